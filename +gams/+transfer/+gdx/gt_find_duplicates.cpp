@@ -0,0 +1,361 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Duplicate records of domain code tuples
+ *
+ * Usage:
+ *   indices = gt_find_duplicates(columns, undefined, keep)
+ *   n = gt_find_duplicates(columns, undefined, 'count')
+ *
+ * columns is a non-empty cell of uint64 vectors (one per domain, all of same
+ * length) holding the domain codes of the records. If undefined(i) is true, code 0
+ * in column i is an undefined label and records with undefined labels are never
+ * duplicates. keep ('first' or 'last') selects the record that is not reported as
+ * duplicate. The returned indices are the rows of all other records in ascending
+ * order.
+ *
+ * Tuples are reduced to a single key (exact mixed radix key if the code ranges fit
+ * into 64 bits, hash otherwise) and grouped with open addressing hash tables.
+ * Large inputs are partitioned by key and processed by several threads.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "mex.h"
+#include "gclgms.h"
+
+#define ERRID "gams:transfer:cmex:gt_find_duplicates:"
+
+/** minimal number of records to use several threads */
+#define GT_DUPLICATES_PARALLEL_MIN 1000000
+
+/** maximal number of threads */
+#define GT_DUPLICATES_MAX_THREADS 16
+
+/** records and domain codes */
+typedef struct
+{
+    size_t          nrecs;          /** number of records */
+    size_t          dim;            /** number of domains */
+    const UINT64_T* codes[GLOBAL_MAX_INDEX_DIM]; /** domain codes per domain */
+    bool            undefined[GLOBAL_MAX_INDEX_DIM]; /** code 0 is undefined label */
+    bool            exact;          /** keys identify tuples (mixed radix key) */
+    bool            last;           /** keep last (true) or first (false) record */
+    std::vector<uint64_t> keys;     /** key of each record */
+    std::vector<uint8_t> skip;      /** record has undefined label */
+    std::vector<uint8_t> duplicate; /** record is duplicate */
+    std::atomic<bool> failed;       /** a thread ran out of memory */
+} GT_DUPLICATES;
+
+static inline uint64_t gt_duplicates_mix(
+    uint64_t        x               /** value */
+)
+{
+    /* splitmix64 finalizer */
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static bool gt_duplicates_equal(
+    const GT_DUPLICATES* dups,      /** duplicates data */
+    size_t          a,              /** record a */
+    size_t          b               /** record b */
+)
+{
+    if (dups->keys[a] != dups->keys[b])
+        return false;
+    if (dups->exact)
+        return true;
+    for (size_t j = 0; j < dups->dim; j++)
+        if (dups->codes[j][a] != dups->codes[j][b])
+            return false;
+    return true;
+}
+
+/** computes keys of records [start, end) */
+static void gt_duplicates_keys(
+    GT_DUPLICATES*  dups,           /** duplicates data */
+    const uint64_t* strides,        /** strides of mixed radix key (exact keys only) */
+    size_t          start,          /** first record */
+    size_t          end             /** end of records */
+)
+{
+    for (size_t i = start; i < end; i++)
+    {
+        uint64_t key = 0;
+        uint8_t skip = 0;
+        for (size_t j = 0; j < dups->dim; j++)
+        {
+            uint64_t code = dups->codes[j][i];
+            if (code == 0 && dups->undefined[j])
+                skip = 1;
+            if (dups->exact)
+                key += code * strides[j];
+            else
+                key = gt_duplicates_mix(key ^ (code + 0x9e3779b97f4a7c15ULL * (j + 1)));
+        }
+        dups->keys[i] = key;
+        dups->skip[i] = skip;
+    }
+}
+
+/** marks duplicates among records of partition part (of n_parts) */
+template <typename T>
+static void gt_duplicates_partition(
+    GT_DUPLICATES*  dups,           /** duplicates data */
+    size_t          part,           /** partition */
+    size_t          n_parts         /** number of partitions */
+)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < dups->nrecs; i++)
+        if (!dups->skip[i] && (n_parts == 1 || (gt_duplicates_mix(dups->keys[i]) >> 40) % n_parts == part))
+            n++;
+
+    size_t size = 16;
+    while (size < 2 * n)
+        size *= 2;
+    size_t mask = size - 1;
+    std::vector<T> table;
+    try
+    {
+        table.assign(size, 0);
+    }
+    catch (const std::exception&)
+    {
+        dups->failed = true;
+        return;
+    }
+
+    for (size_t k = 0; k < dups->nrecs; k++)
+    {
+        size_t i = dups->last ? dups->nrecs - 1 - k : k;
+        if (dups->skip[i])
+            continue;
+        uint64_t h = gt_duplicates_mix(dups->keys[i]);
+        if (n_parts > 1 && (h >> 40) % n_parts != part)
+            continue;
+
+        size_t slot = h & mask;
+        for (;;)
+        {
+            T pos = table[slot];
+            if (pos == 0)
+            {
+                table[slot] = (T) (i + 1);
+                break;
+            }
+            if (gt_duplicates_equal(dups, pos - 1, i))
+            {
+                dups->duplicate[i] = 1;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+}
+
+/** marks all duplicates (returns false if out of memory) */
+static bool gt_duplicates_find(
+    GT_DUPLICATES*  dups            /** duplicates data */
+)
+{
+    uint64_t strides[GLOBAL_MAX_INDEX_DIM];
+    size_t n_threads = 1;
+    std::vector<std::thread> threads;
+
+    /* exact mixed radix key if product of code ranges fits */
+    dups->exact = true;
+    uint64_t range = 1;
+    for (size_t j = 0; j < dups->dim; j++)
+    {
+        uint64_t max_code = 0;
+        for (size_t i = 0; i < dups->nrecs; i++)
+            if (dups->codes[j][i] > max_code)
+                max_code = dups->codes[j][i];
+        strides[j] = range;
+        if (max_code == UINT64_MAX || range > UINT64_MAX / (max_code + 1))
+        {
+            dups->exact = false;
+            break;
+        }
+        range *= max_code + 1;
+    }
+
+    if (dups->nrecs >= GT_DUPLICATES_PARALLEL_MIN)
+    {
+        n_threads = std::thread::hardware_concurrency();
+        if (n_threads < 1)
+            n_threads = 1;
+        if (n_threads > GT_DUPLICATES_MAX_THREADS)
+            n_threads = GT_DUPLICATES_MAX_THREADS;
+    }
+
+    try
+    {
+        dups->keys.resize(dups->nrecs);
+        dups->skip.resize(dups->nrecs);
+        dups->duplicate.assign(dups->nrecs, 0);
+
+        /* keys */
+        if (n_threads == 1)
+            gt_duplicates_keys(dups, strides, 0, dups->nrecs);
+        else
+        {
+            size_t chunk = (dups->nrecs + n_threads - 1) / n_threads;
+            for (size_t t = 0; t < n_threads; t++)
+            {
+                size_t start = t * chunk;
+                size_t end = start + chunk < dups->nrecs ? start + chunk : dups->nrecs;
+                threads.push_back(std::thread(gt_duplicates_keys, dups, strides, start, end));
+            }
+            for (size_t t = 0; t < threads.size(); t++)
+                threads[t].join();
+            threads.clear();
+        }
+
+        /* group records: one partition per thread */
+        if (n_threads == 1 && dups->nrecs < UINT32_MAX)
+            gt_duplicates_partition<uint32_t>(dups, 0, 1);
+        else if (n_threads == 1)
+            gt_duplicates_partition<uint64_t>(dups, 0, 1);
+        for (size_t t = 0; n_threads > 1 && t < n_threads; t++)
+        {
+            if (dups->nrecs < UINT32_MAX)
+                threads.push_back(std::thread(gt_duplicates_partition<uint32_t>, dups, t, n_threads));
+            else
+                threads.push_back(std::thread(gt_duplicates_partition<uint64_t>, dups, t, n_threads));
+        }
+        for (size_t t = 0; t < threads.size(); t++)
+            threads[t].join();
+    }
+    catch (const std::exception&)
+    {
+        for (size_t t = 0; t < threads.size(); t++)
+            if (threads[t].joinable())
+                threads[t].join();
+        return false;
+    }
+    return !dups->failed;
+}
+
+void mexFunction(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    char keep[6];
+    size_t n_dups;
+    bool success;
+    GT_DUPLICATES* dups = NULL;
+#ifdef WITH_R2018A_OR_NEWER
+    mxDouble* mx_indices = NULL;
+#else
+    double* mx_indices = NULL;
+#endif
+
+    /* check input arguments */
+    if (nlhs > 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of outputs (%d). 0 or 1 required.", nlhs);
+    if (nrhs != 3)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 3 required.", nrhs);
+    if (!mxIsCell(prhs[0]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need cell");
+    if (mxGetNumberOfElements(prhs[0]) > GLOBAL_MAX_INDEX_DIM)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has too many elements (max: %d).", GLOBAL_MAX_INDEX_DIM);
+    if (!mxIsLogical(prhs[1]) || mxGetNumberOfElements(prhs[1]) != mxGetNumberOfElements(prhs[0]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need logical of same length as argument 1");
+    if (!mxIsChar(prhs[2]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 3 has invalid type: need char");
+    /* over-long values would be truncated to a valid one otherwise */
+    if (mxGetString(prhs[2], keep, sizeof(keep)))
+        keep[0] = '\0';
+    if (strcmp(keep, "first") && strcmp(keep, "last") && strcmp(keep, "count"))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 3 must be one of the following: first, last, count.");
+
+    size_t dim = mxGetNumberOfElements(prhs[0]);
+    size_t nrecs = 0;
+    for (size_t j = 0; j < dim; j++)
+    {
+        const mxArray* mx_arr_codes = mxGetCell(prhs[0], j);
+        if (!mx_arr_codes || !mxIsUint64(mx_arr_codes))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need cell of uint64");
+        if (j > 0 && mxGetNumberOfElements(mx_arr_codes) != nrecs)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 elements must have equal length.");
+        nrecs = mxGetNumberOfElements(mx_arr_codes);
+    }
+
+    /* find duplicates */
+    dups = new GT_DUPLICATES;
+    dups->nrecs = nrecs;
+    dups->dim = dim;
+    dups->failed = false;
+    dups->last = !strcmp(keep, "last");
+    for (size_t j = 0; j < dim; j++)
+    {
+#ifdef WITH_R2018A_OR_NEWER
+        dups->codes[j] = mxGetUint64s(mxGetCell(prhs[0], j));
+#else
+        dups->codes[j] = (UINT64_T*) mxGetData(mxGetCell(prhs[0], j));
+#endif
+        dups->undefined[j] = mxGetLogicals(prhs[1])[j];
+    }
+    success = gt_duplicates_find(dups);
+
+    /* create output */
+    n_dups = 0;
+    for (size_t i = 0; success && i < dups->nrecs; i++)
+        n_dups += dups->duplicate[i];
+    if (success && !strcmp(keep, "count"))
+        plhs[0] = mxCreateDoubleScalar((double) n_dups);
+    else if (success)
+    {
+        plhs[0] = mxCreateDoubleMatrix(1, n_dups, mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+        mx_indices = mxGetDoubles(plhs[0]);
+#else
+        mx_indices = mxGetPr(plhs[0]);
+#endif
+        for (size_t i = 0, k = 0; i < dups->nrecs; i++)
+            if (dups->duplicate[i])
+                mx_indices[k++] = (double) (i + 1);
+    }
+    delete dups;
+
+    if (!success)
+        mexErrMsgIdAndTxt(ERRID"memory", "Out of memory.");
+}
@@ -0,0 +1,744 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Comparison of two GDX files
+ *
+ * Usage:
+ *   [summary, records] = gt_gdx_diff(filename1, filename2, symbols, atol, rtol)
+ *
+ * symbols: cellstr of symbols to be compared (empty: all symbols of both files).
+ * atol:    absolute tolerance per value field (double of length 5: level, marginal, lower,
+ *          upper, scale; parameters use level).
+ * rtol:    relative tolerance per value field (relative to the larger absolute value).
+ * summary: struct array with one element per symbol: name, symbol_type, dimension, status
+ *          ('equal', 'different', 'only_first', 'only_second' or 'incompatible' (symbol type or
+ *          dimension differ)), number_records ([first, second], NaN if missing),
+ *          number_only_first, number_only_second, number_changed and max_abs_diff,
+ *          max_rel_diff (per value field of matched records, special values excluded).
+ * records: struct with a field for each symbol with differing records: domain columns
+ *          (cellstr), change (cellstr: 'only_first', 'only_second' or 'changed') and a column
+ *          <value>_first and <value>_second per value field (element_text_* for sets). A
+ *          missing record holds the default values of the symbol type.
+ *
+ * Records of both files are sorted by their labels (case insensitive, through a common UEL
+ * order computed once) and merged in a single pass. Only one symbol is held in memory at a
+ * time. Special values are equal only to the same special value (eps included); tolerances
+ * apply to other values only: |a - b| <= atol or |a - b| <= rtol * max(|a|, |b|).
+ */
+
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "mex.h"
+
+#ifdef HAS_GDX_SOURCE
+#define NO_SET_LOAD_PATH_DEF
+#include "gdxcwrap.hpp"
+#else
+#include "gdxcc.h"
+#endif
+#include "gt_utils.h"
+#include "gt_mex.h"
+#include "gt_gdx_idx.h"
+
+#define ERRID "gams:transfer:cmex:gt_gdx_diff:"
+
+#ifdef WITH_R2018A_OR_NEWER
+#define GT_GET_DOUBLES(arr) mxGetDoubles(arr)
+#else
+#define GT_GET_DOUBLES(arr) mxGetPr(arr)
+#endif
+
+#define GT_DIFF_ONLY_FIRST 0
+#define GT_DIFF_ONLY_SECOND 1
+#define GT_DIFF_CHANGED 2
+
+static const char* change_names[] = {"only_first", "only_second", "changed"};
+static const char* value_names[] = {"level", "marginal", "lower", "upper", "scale"};
+static const char* type_names[] = {"set", "parameter", "variable", "equation", "alias"};
+
+/** GDX file opened for comparison */
+typedef struct
+{
+    gdxHandle_t     gdx;            /** GDX handle */
+    int             sym_count;      /** number of symbols */
+    int             uel_count;      /** number of UELs */
+    std::vector<int> ranks;         /** rank of UELs in common label order (index: UEL id) */
+    std::vector<int> acronyms;      /** acronym indices */
+} GT_DIFF_FILE;
+
+/** records of a symbol in a GDX file */
+typedef struct
+{
+    int             sym_id;         /** symbol id (0: not in file) */
+    std::string     name;           /** symbol name (as stored) */
+    std::string     text;           /** explanatory text */
+    int             type;           /** symbol type */
+    int             subtype;        /** symbol subtype */
+    size_t          dim;            /** symbol dimension */
+    size_t          nrecs;          /** number of records */
+    std::vector<int> keys;          /** label ranks of records (row major: nrecs x dim) */
+    std::vector<double> values;     /** raw GDX values of records (row major: nrecs x GMS_VAL_MAX) */
+    std::vector<size_t> order;      /** records in label order */
+    double          def_values[GMS_VAL_MAX]; /** raw GDX default values */
+} GT_DIFF_SYMBOL;
+
+/** comparison result of a symbol */
+typedef struct
+{
+    std::string     name;           /** symbol name */
+    int             type;           /** symbol type */
+    size_t          dim;            /** symbol dimension */
+    const char*     status;         /** status */
+    double          nrecs[2];       /** number of records (NaN: not in file) */
+    size_t          n_change[3];    /** number of records per change */
+    size_t          nvals;          /** number of value fields */
+    double          max_abs_diff[GMS_VAL_MAX]; /** maximum absolute difference per value field */
+    double          max_rel_diff[GMS_VAL_MAX]; /** maximum relative difference per value field */
+} GT_DIFF_SUMMARY;
+
+/** GDX handles of the running comparison (closed by next call if an error occurred) */
+static gdxHandle_t diff_gdx[2] = {NULL, NULL};
+
+static void gt_gdx_diff_close(void)
+{
+    for (int f = 0; f < 2; f++)
+    {
+        if (!diff_gdx[f])
+            continue;
+        gdxClose(diff_gdx[f]);
+        gdxFree(&diff_gdx[f]);
+        diff_gdx[f] = NULL;
+    }
+}
+
+/** returns label in lower case */
+static std::string gt_gdx_diff_lower(
+    const std::string& label        /** label */
+)
+{
+    std::string key = label;
+    for (size_t k = 0; k < key.size(); k++)
+        key[k] = (char) tolower((unsigned char) key[k]);
+    return key;
+}
+
+/** opens GDX file and reads its UELs and acronyms */
+static void gt_gdx_diff_open(
+    GT_DIFF_FILE*   file,           /** file */
+    gdxHandle_t*    gdx,            /** GDX handle (closed by next call if an error occurs) */
+    const char*     filename,       /** GDX filename */
+    std::vector<std::string>& uels  /** UELs (index: UEL id) */
+)
+{
+    int ival;
+    char buf[GMS_SSSIZE], acr_name[GMS_SSSIZE], acr_text[GMS_SSSIZE];
+
+    gt_gdx_init_read(gdx, filename);
+    file->gdx = *gdx;
+    if (!gdxSystemInfo(file->gdx, &file->sym_count, &file->uel_count))
+    {
+        gdxErrorStr(file->gdx, gdxGetLastError(file->gdx), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxSystemInfo", "GDX error (gdxSystemInfo): %s", buf);
+    }
+
+    uels.resize(file->uel_count+1);
+    for (int i = 1; i <= file->uel_count; i++)
+    {
+        if (!gdxUMUelGet(file->gdx, i, buf, &ival))
+        {
+            gdxErrorStr(file->gdx, gdxGetLastError(file->gdx), buf);
+            mexErrMsgIdAndTxt(ERRID"gdxUMUelGet", "GDX error (gdxUMUelGet): %s", buf);
+        }
+        uels[i] = buf;
+    }
+
+    file->acronyms.resize(std::max(gdxAcronymCount(file->gdx), 0));
+    for (size_t i = 0; i < file->acronyms.size(); i++)
+    {
+        gdxAcronymGetInfo(file->gdx, (int) i+1, acr_name, acr_text, &ival);
+        file->acronyms[i] = ival;
+    }
+}
+
+/** ranks the UELs of both files in a common (case insensitive) label order */
+static void gt_gdx_diff_rank_uels(
+    GT_DIFF_FILE*   files,          /** files (length: 2) */
+    std::vector<std::string>* uels, /** UELs of files (length: 2) */
+    std::vector<std::string>& labels /** labels of ranks (rank 0: UEL out of range) */
+)
+{
+    std::vector<std::string> keys[2];
+    std::vector<std::pair<int,int> > entries;
+
+    for (int f = 0; f < 2; f++)
+    {
+        keys[f].resize(uels[f].size());
+        for (size_t i = 1; i < uels[f].size(); i++)
+        {
+            keys[f][i] = gt_gdx_diff_lower(uels[f][i]);
+            entries.push_back(std::make_pair(f, (int) i));
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+        [&keys](const std::pair<int,int>& a, const std::pair<int,int>& b) {
+            return keys[a.first][a.second] < keys[b.first][b.second];
+        });
+
+    labels.assign(1, "");
+    for (int f = 0; f < 2; f++)
+        files[f].ranks.assign(files[f].uel_count+1, 0);
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const std::pair<int,int>& e = entries[i];
+        if (i == 0 || keys[e.first][e.second] != keys[entries[i-1].first][entries[i-1].second])
+            labels.push_back(uels[e.first][e.second]);
+        files[e.first].ranks[e.second] = (int) labels.size() - 1;
+    }
+}
+
+/** compares label ranks of two records */
+static inline int gt_gdx_diff_compare_keys(
+    const int*      a,              /** label ranks of first record */
+    const int*      b,              /** label ranks of second record */
+    size_t          dim             /** dimension */
+)
+{
+    for (size_t k = 0; k < dim; k++)
+        if (a[k] != b[k])
+            return a[k] < b[k] ? -1 : 1;
+    return 0;
+}
+
+/** returns true if values are equal within tolerances and updates maximum differences */
+static inline bool gt_gdx_diff_values_equal(
+    double          a,              /** raw GDX value of first file */
+    double          b,              /** raw GDX value of second file */
+    double          atol,           /** absolute tolerance */
+    double          rtol,           /** relative tolerance */
+    double*         max_abs_diff,   /** maximum absolute difference (in / out) */
+    double*         max_rel_diff    /** maximum relative difference (in / out) */
+)
+{
+    double diff, scale;
+
+    /* special values (and acronyms) */
+    if (fabs(a) >= GMS_SV_UNDEF || fabs(b) >= GMS_SV_UNDEF)
+        return a == b;
+
+    diff = fabs(a - b);
+    scale = std::max(fabs(a), fabs(b));
+    *max_abs_diff = std::max(*max_abs_diff, diff);
+    if (scale > 0)
+        *max_rel_diff = std::max(*max_rel_diff, diff / scale);
+    return diff <= atol || diff <= rtol * scale;
+}
+
+/** reads info of symbol (if in file) */
+static void gt_gdx_diff_symbol_info(
+    GT_DIFF_FILE*   file,           /** file */
+    const char*     name,           /** symbol name */
+    GT_DIFF_SYMBOL* symbol          /** symbol */
+)
+{
+    int ival, dim, nrecs;
+    char buf[GMS_SSSIZE], sym_name[GMS_SSSIZE], text[GMS_SSSIZE];
+
+    symbol->sym_id = 0;
+    symbol->nrecs = 0;
+    if (!gdxFindSymbol(file->gdx, name, &symbol->sym_id))
+    {
+        symbol->sym_id = 0;
+        return;
+    }
+    if (!gdxSymbolInfo(file->gdx, symbol->sym_id, sym_name, &dim, &symbol->type))
+    {
+        gdxErrorStr(file->gdx, gdxGetLastError(file->gdx), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxSymbolInfo", "GDX error (gdxSymbolInfo): %s", buf);
+    }
+    if (!gdxSymbolInfoX(file->gdx, symbol->sym_id, &nrecs, &symbol->subtype, text))
+    {
+        gdxErrorStr(file->gdx, gdxGetLastError(file->gdx), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxSymbolInfoX", "GDX error (gdxSymbolInfoX): %s", buf);
+    }
+    mxAssert(dim >= 0 && dim <= GLOBAL_MAX_INDEX_DIM, "Invalid dimension of symbol.");
+    mxAssert(nrecs >= 0, "Invalid number of records");
+    symbol->name = sym_name;
+    symbol->text = text;
+    symbol->dim = (size_t) dim;
+    symbol->nrecs = (size_t) nrecs;
+    ival = symbol->type == GMS_DT_ALIAS ? GMS_DT_SET : symbol->type;
+    gt_utils_type_default_values(ival, symbol->subtype, false, symbol->def_values);
+}
+
+/** reads records of symbol and sorts them by labels */
+static void gt_gdx_diff_symbol_read(
+    GT_DIFF_FILE*   file,           /** file */
+    GT_DIFF_SYMBOL* symbol          /** symbol */
+)
+{
+    int nrecs, lastdim;
+    char buf[GMS_SSSIZE];
+    gdxUelIndex_t gdx_uel_index;
+    gdxValues_t gdx_values;
+    size_t dim = symbol->dim;
+    const int* keys;
+
+    if (!gdxDataReadRawStart(file->gdx, symbol->sym_id, &nrecs))
+    {
+        gdxErrorStr(file->gdx, gdxGetLastError(file->gdx), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxDataReadRawStart", "GDX error (gdxDataReadRawStart): %s", buf);
+    }
+    symbol->nrecs = (size_t) std::max(nrecs, 0);
+    symbol->keys.resize(symbol->nrecs * dim);
+    symbol->values.resize(symbol->nrecs * GMS_VAL_MAX);
+    for (size_t i = 0; i < symbol->nrecs; i++)
+    {
+        if (!gdxDataReadRaw(file->gdx, gdx_uel_index, gdx_values, &lastdim))
+        {
+            gdxErrorStr(file->gdx, gdxGetLastError(file->gdx), buf);
+            mexErrMsgIdAndTxt(ERRID"gdxDataReadRaw", "GDX error (gdxDataReadRaw): %s", buf);
+        }
+        for (size_t k = 0; k < dim; k++)
+        {
+            int uel = gdx_uel_index[k];
+            symbol->keys[i*dim+k] = (uel < 1 || uel > file->uel_count) ? 0 : file->ranks[uel];
+        }
+        memcpy(&symbol->values[i*GMS_VAL_MAX], gdx_values, GMS_VAL_MAX * sizeof(double));
+    }
+    gdxDataReadDone(file->gdx);
+
+    /* records are stored in UEL id order of the file: sort only if it differs from label order */
+    symbol->order.resize(symbol->nrecs);
+    for (size_t i = 0; i < symbol->nrecs; i++)
+        symbol->order[i] = i;
+    keys = symbol->keys.data();
+    auto less = [keys, dim](size_t a, size_t b) {
+        return gt_gdx_diff_compare_keys(&keys[a*dim], &keys[b*dim], dim) < 0;
+    };
+    if (!std::is_sorted(symbol->order.begin(), symbol->order.end(), less))
+        std::sort(symbol->order.begin(), symbol->order.end(), less);
+}
+
+/** returns explanatory text of set element */
+static void gt_gdx_diff_elem_text(
+    GT_DIFF_FILE*   file,           /** file */
+    double          text_id,        /** raw text id */
+    char*           text            /** text (length: GMS_SSSIZE) */
+)
+{
+    int node, id = (int) round(text_id);
+    if (id <= 0 || !gdxGetElemText(file->gdx, id, text, &node))
+        strcpy(text, "");
+}
+
+/** creates records struct of differing records */
+static mxArray* gt_gdx_diff_records(
+    GT_DIFF_FILE*   files,          /** files (length: 2) */
+    GT_DIFF_SYMBOL* symbols,        /** symbol in files (length: 2) */
+    const std::vector<std::string>& labels, /** labels of ranks */
+    const std::vector<int>& changes,   /** change per differing record */
+    const std::vector<size_t>& recs,   /** record index per file per differing record (n x 2) */
+    size_t          nvals,          /** number of value fields */
+    const char**    names           /** value field names */
+)
+{
+    int dom_type;
+    size_t n = changes.size(), dim = symbols[0].dim;
+    char buf[GMS_SSSIZE];
+    gdxStrIndexPtrs_t domain_labels_ptr;
+    gdxStrIndex_t domain_labels;
+    bool unique_labels = true;
+    mxArray* mx_arr_records = mxCreateStructMatrix(1, 1, 0, NULL);
+    mxArray* mx_arr;
+    double* mx_values;
+
+    GDXSTRINDEXPTRS_INIT(domain_labels, domain_labels_ptr);
+
+    /* domain labels (as read) of the first file */
+    dom_type = gdxSymbolGetDomainX(files[0].gdx, symbols[0].sym_id, domain_labels_ptr);
+    if (dom_type < 1 || dom_type > 3)
+    {
+        gdxErrorStr(files[0].gdx, gdxGetLastError(files[0].gdx), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxSymbolGetDomainX", "GDX error (gdxSymbolGetDomainX): %s", buf);
+    }
+    for (size_t j = 0; j < dim; j++)
+    {
+        if (!strcmp(domain_labels_ptr[j], "*"))
+            strcpy(domain_labels_ptr[j], "uni");
+        for (size_t k = 0; unique_labels && k < j; k++)
+            if (!strcmp(domain_labels_ptr[j], domain_labels_ptr[k]))
+                unique_labels = false;
+    }
+    if (!unique_labels)
+        for (size_t j = 0; j < dim; j++)
+        {
+            sprintf(buf, "_%d", (int) j+1);
+            strcat(domain_labels_ptr[j], buf);
+        }
+
+    /* domain columns */
+    for (size_t j = 0; j < dim; j++)
+    {
+        mx_arr = mxCreateCellMatrix(n, 1);
+        for (size_t i = 0; i < n; i++)
+        {
+            int f = changes[i] == GT_DIFF_ONLY_SECOND ? 1 : 0;
+            const int* keys = &symbols[f].keys[recs[2*i+f] * dim];
+            mxSetCell(mx_arr, i, mxCreateString(labels[keys[j]].c_str()));
+        }
+        mxAddField(mx_arr_records, domain_labels_ptr[j]);
+        mxSetField(mx_arr_records, 0, domain_labels_ptr[j], mx_arr);
+    }
+
+    /* change column */
+    mx_arr = mxCreateCellMatrix(n, 1);
+    for (size_t i = 0; i < n; i++)
+        mxSetCell(mx_arr, i, mxCreateString(change_names[changes[i]]));
+    mxAddField(mx_arr_records, "change");
+    mxSetField(mx_arr_records, 0, "change", mx_arr);
+
+    /* value columns of both files (defaults for missing records) */
+    for (int f = 0; f < 2; f++)
+    {
+        const char* suffix = f == 0 ? "_first" : "_second";
+        int missing = f == 0 ? GT_DIFF_ONLY_SECOND : GT_DIFF_ONLY_FIRST;
+
+        if (symbols[0].type == GMS_DT_SET)
+        {
+            mx_arr = mxCreateCellMatrix(n, 1);
+            for (size_t i = 0; i < n; i++)
+            {
+                if (changes[i] == missing)
+                    strcpy(buf, "");
+                else
+                    gt_gdx_diff_elem_text(&files[f],
+                        symbols[f].values[recs[2*i+f]*GMS_VAL_MAX+GMS_VAL_LEVEL], buf);
+                mxSetCell(mx_arr, i, mxCreateString(buf));
+            }
+            sprintf(buf, "element_text%s", suffix);
+            mxAddField(mx_arr_records, buf);
+            mxSetField(mx_arr_records, 0, buf, mx_arr);
+            continue;
+        }
+
+        for (size_t k = 0; k < nvals; k++)
+        {
+            mx_arr = mxCreateDoubleMatrix(n, 1, mxREAL);
+            mx_values = GT_GET_DOUBLES(mx_arr);
+            for (size_t i = 0; i < n; i++)
+            {
+                double value = changes[i] == missing ? symbols[f].def_values[k] :
+                    symbols[f].values[recs[2*i+f]*GMS_VAL_MAX+k];
+                mx_values[i] = gt_utils_sv_gams2matlab(value, (int) files[f].acronyms.size(),
+                    files[f].acronyms.data());
+            }
+            sprintf(buf, "%s%s", names[k], suffix);
+            mxAddField(mx_arr_records, buf);
+            mxSetField(mx_arr_records, 0, buf, mx_arr);
+        }
+    }
+
+    return mx_arr_records;
+}
+
+/** compares symbol in both files and adds differing records to records struct */
+static void gt_gdx_diff_symbol(
+    GT_DIFF_FILE*   files,          /** files (length: 2) */
+    GT_DIFF_SYMBOL* symbols,        /** symbol in files (length: 2) */
+    const std::vector<std::string>& labels, /** labels of ranks */
+    const double*   atol,           /** absolute tolerances (length: GMS_VAL_MAX) */
+    const double*   rtol,           /** relative tolerances (length: GMS_VAL_MAX) */
+    GT_DIFF_SUMMARY* summary,       /** summary (in / out) */
+    mxArray*        mx_arr_records  /** records struct (in / out) */
+)
+{
+    size_t i1 = 0, i2 = 0, dim = symbols[0].dim;
+    char text1[GMS_SSSIZE], text2[GMS_SSSIZE];
+    const char* names[GMS_VAL_MAX] = {"value"};
+    std::vector<int> changes;
+    std::vector<size_t> recs;
+
+    /* aliases: compare aliased sets (explanatory text: "Aliased with <set>") */
+    if (symbols[0].type == GMS_DT_ALIAS)
+    {
+        summary->status = gt_gdx_diff_lower(symbols[0].text) == gt_gdx_diff_lower(symbols[1].text) ?
+            "equal" : "different";
+        return;
+    }
+
+    switch (symbols[0].type)
+    {
+        case GMS_DT_SET:
+            summary->nvals = 0;
+            break;
+        case GMS_DT_PAR:
+            summary->nvals = 1;
+            break;
+        default:
+            summary->nvals = GMS_VAL_MAX;
+            for (size_t k = 0; k < GMS_VAL_MAX; k++)
+                names[k] = value_names[k];
+            break;
+    }
+
+    /* merge records of both files in label order */
+    for (int f = 0; f < 2; f++)
+    {
+        gt_gdx_diff_symbol_read(&files[f], &symbols[f]);
+        summary->nrecs[f] = (double) symbols[f].nrecs;
+    }
+    while (i1 < symbols[0].nrecs || i2 < symbols[1].nrecs)
+    {
+        size_t r1 = i1 < symbols[0].nrecs ? symbols[0].order[i1] : 0;
+        size_t r2 = i2 < symbols[1].nrecs ? symbols[1].order[i2] : 0;
+        int cmp, change = -1;
+
+        if (i1 == symbols[0].nrecs)
+            cmp = 1;
+        else if (i2 == symbols[1].nrecs)
+            cmp = -1;
+        else
+            cmp = gt_gdx_diff_compare_keys(&symbols[0].keys[r1*dim], &symbols[1].keys[r2*dim], dim);
+
+        if (cmp < 0)
+        {
+            change = GT_DIFF_ONLY_FIRST;
+            i1++;
+        }
+        else if (cmp > 0)
+        {
+            change = GT_DIFF_ONLY_SECOND;
+            i2++;
+        }
+        else
+        {
+            const double* v1 = &symbols[0].values[r1*GMS_VAL_MAX];
+            const double* v2 = &symbols[1].values[r2*GMS_VAL_MAX];
+            bool equal = true;
+
+            if (symbols[0].type == GMS_DT_SET)
+            {
+                gt_gdx_diff_elem_text(&files[0], v1[GMS_VAL_LEVEL], text1);
+                gt_gdx_diff_elem_text(&files[1], v2[GMS_VAL_LEVEL], text2);
+                equal = !strcmp(text1, text2);
+            }
+            for (size_t k = 0; k < summary->nvals; k++)
+                equal &= gt_gdx_diff_values_equal(v1[k], v2[k], atol[k], rtol[k],
+                    &summary->max_abs_diff[k], &summary->max_rel_diff[k]);
+            if (!equal)
+                change = GT_DIFF_CHANGED;
+            i1++;
+            i2++;
+        }
+        if (change < 0)
+            continue;
+
+        summary->n_change[change]++;
+        changes.push_back(change);
+        recs.push_back(r1);
+        recs.push_back(r2);
+    }
+
+    summary->status = changes.empty() ? "equal" : "different";
+    if (changes.empty())
+        return;
+    mxAddField(mx_arr_records, summary->name.c_str());
+    mxSetField(mx_arr_records, 0, summary->name.c_str(),
+        gt_gdx_diff_records(files, symbols, labels, changes, recs, summary->nvals, names));
+}
+
+/** creates summary struct array */
+static mxArray* gt_gdx_diff_summary(
+    const std::vector<GT_DIFF_SUMMARY>& summaries /** summaries */
+)
+{
+    const char* fields[] = {"name", "symbol_type", "dimension", "status", "number_records",
+        "number_only_first", "number_only_second", "number_changed", "max_abs_diff", "max_rel_diff"};
+    mxArray* mx_arr_summary = mxCreateStructMatrix(summaries.size(), 1, 10, fields);
+    mxArray* mx_arr;
+
+    for (size_t i = 0; i < summaries.size(); i++)
+    {
+        const GT_DIFF_SUMMARY& s = summaries[i];
+        mxSetFieldByNumber(mx_arr_summary, i, 0, mxCreateString(s.name.c_str()));
+        mxSetFieldByNumber(mx_arr_summary, i, 1, mxCreateString(type_names[s.type]));
+        mxSetFieldByNumber(mx_arr_summary, i, 2, mxCreateDoubleScalar((double) s.dim));
+        mxSetFieldByNumber(mx_arr_summary, i, 3, mxCreateString(s.status));
+        mx_arr = mxCreateDoubleMatrix(1, 2, mxREAL);
+        memcpy(GT_GET_DOUBLES(mx_arr), s.nrecs, 2 * sizeof(double));
+        mxSetFieldByNumber(mx_arr_summary, i, 4, mx_arr);
+        for (int k = 0; k < 3; k++)
+            mxSetFieldByNumber(mx_arr_summary, i, 5 + k, mxCreateDoubleScalar((double) s.n_change[k]));
+        mx_arr = mxCreateDoubleMatrix(1, s.nvals, mxREAL);
+        memcpy(GT_GET_DOUBLES(mx_arr), s.max_abs_diff, s.nvals * sizeof(double));
+        mxSetFieldByNumber(mx_arr_summary, i, 8, mx_arr);
+        mx_arr = mxCreateDoubleMatrix(1, s.nvals, mxREAL);
+        memcpy(GT_GET_DOUBLES(mx_arr), s.max_rel_diff, s.nvals * sizeof(double));
+        mxSetFieldByNumber(mx_arr_summary, i, 9, mx_arr);
+    }
+
+    return mx_arr_summary;
+}
+
+void mexFunction(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    char buf[GMS_SSSIZE];
+    char gdx_filenames[2][GMS_SSSIZE];
+    double atol[GMS_VAL_MAX], rtol[GMS_VAL_MAX];
+    GT_DIFF_FILE files[2];
+    GT_DIFF_SYMBOL symbols[2];
+    std::vector<std::string> uels[2], labels, names;
+    std::vector<GT_DIFF_SUMMARY> summaries;
+    mxArray* mx_arr_records = NULL;
+
+    mexAtExit(gt_gdx_diff_close);
+    gt_gdx_diff_close();
+
+    /* check input / outputs */
+    gt_mex_check_arguments_num_range(1, 2, nlhs, 5, nrhs);
+    gt_mex_check_argument_str(prhs, 0, gdx_filenames[0]);
+    gt_mex_check_argument_str(prhs, 1, gdx_filenames[1]);
+    gt_mex_check_argument_cell(prhs, 2);
+    for (int j = 3; j < 5; j++)
+    {
+        if (!mxIsDouble(prhs[j]) || mxIsComplex(prhs[j]) || mxIsSparse(prhs[j]) ||
+            mxGetNumberOfElements(prhs[j]) != GMS_VAL_MAX)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument #%d has invalid type: need double "
+                "vector of length %d", j, GMS_VAL_MAX);
+        memcpy(j == 3 ? atol : rtol, GT_GET_DOUBLES(prhs[j]), GMS_VAL_MAX * sizeof(double));
+    }
+
+    /* open files and order UELs of both files */
+    for (int f = 0; f < 2; f++)
+    {
+        gt_gdx_diff_open(&files[f], &diff_gdx[f], gdx_filenames[f], uels[f]);
+    }
+    gt_gdx_diff_rank_uels(files, uels, labels);
+    uels[0].clear();
+    uels[1].clear();
+
+    /* symbols to be compared: given or all (of first, then of second file) */
+    if (mxGetNumberOfElements(prhs[2]) > 0)
+    {
+        for (size_t i = 0; i < mxGetNumberOfElements(prhs[2]); i++)
+        {
+            const mxArray* mx_arr = mxGetCell(prhs[2], i);
+            if (!mx_arr || !mxIsChar(mx_arr))
+                mexErrMsgIdAndTxt(ERRID"symbol", "Symbol name must be of type 'char'.");
+            mxGetString(mx_arr, buf, GMS_SSSIZE);
+            names.push_back(buf);
+        }
+    }
+    else
+    {
+        std::unordered_set<std::string> known;
+        for (int f = 0; f < 2; f++)
+            for (int i = 1; i <= files[f].sym_count; i++)
+            {
+                int dim, type;
+                if (!gdxSymbolInfo(files[f].gdx, i, buf, &dim, &type))
+                {
+                    gdxErrorStr(files[f].gdx, gdxGetLastError(files[f].gdx), buf);
+                    mexErrMsgIdAndTxt(ERRID"gdxSymbolInfo", "GDX error (gdxSymbolInfo): %s", buf);
+                }
+                if (known.insert(gt_gdx_diff_lower(buf)).second)
+                    names.push_back(buf);
+            }
+    }
+
+    /* compare symbols */
+    mx_arr_records = mxCreateStructMatrix(1, 1, 0, NULL);
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        GT_DIFF_SUMMARY summary;
+        int f;
+
+        for (f = 0; f < 2; f++)
+            gt_gdx_diff_symbol_info(&files[f], names[i].c_str(), &symbols[f]);
+        if (!symbols[0].sym_id && !symbols[1].sym_id)
+        {
+            mexWarnMsgIdAndTxt(ERRID"symbol", "Symbol %s not found in GDX files. ", names[i].c_str());
+            continue;
+        }
+
+        f = symbols[0].sym_id ? 0 : 1;
+        summary.name = symbols[f].name;
+        summary.type = symbols[f].type;
+        summary.dim = symbols[f].dim;
+        summary.nvals = 0;
+        for (int k = 0; k < 2; k++)
+            summary.nrecs[k] = symbols[k].sym_id ? (double) symbols[k].nrecs : mxGetNaN();
+        for (int k = 0; k < 3; k++)
+            summary.n_change[k] = 0;
+        for (int k = 0; k < GMS_VAL_MAX; k++)
+        {
+            summary.max_abs_diff[k] = 0.0;
+            summary.max_rel_diff[k] = 0.0;
+        }
+
+        if (!symbols[1].sym_id)
+        {
+            summary.status = "only_first";
+            summary.n_change[GT_DIFF_ONLY_FIRST] = symbols[0].nrecs;
+        }
+        else if (!symbols[0].sym_id)
+        {
+            summary.status = "only_second";
+            summary.n_change[GT_DIFF_ONLY_SECOND] = symbols[1].nrecs;
+        }
+        else if (symbols[0].type != symbols[1].type || symbols[0].dim != symbols[1].dim)
+            summary.status = "incompatible";
+        else
+            gt_gdx_diff_symbol(files, symbols, labels, atol, rtol, &summary, mx_arr_records);
+
+        for (f = 0; f < 2; f++)
+        {
+            std::vector<int>().swap(symbols[f].keys);
+            std::vector<double>().swap(symbols[f].values);
+            std::vector<size_t>().swap(symbols[f].order);
+        }
+        summaries.push_back(summary);
+    }
+
+    gt_gdx_diff_close();
+
+    plhs[0] = gt_gdx_diff_summary(summaries);
+    if (nlhs > 1)
+        plhs[1] = mx_arr_records;
+    else
+        mxDestroyArray(mx_arr_records);
+}
@@ -158,6 +158,89 @@ void gt_gdx_register_uels(
     }
 }
 
+void gt_gdx_copy_records(
+    gdxHandle_t     gdx,            /** GDX handle (write mode, string write started) */
+    gdxHandle_t     gdx_src,        /** source GDX handle (read mode) */
+    int             src_sym_nr,     /** symbol number in source GDX */
+    const char*     name,           /** name of symbol */
+    size_t          dim,            /** dimension of symbol */
+    int             type,           /** GDX symbol type */
+    bool            eps_to_zero,    /** flag to write GAMS EPS as 0 */
+    char**          uel_labels      /** labels of source UEL ids (in / out; NULL: not looked up yet) */
+)
+{
+    int nrecs, lastdim, node, text_id, ival;
+    char buf[GMS_SSSIZE], rec_name[GMS_SSSIZE];
+    const char* keys[GLOBAL_MAX_INDEX_DIM];
+    gdxUelIndex_t gdx_uel_index;
+    gdxValues_t gdx_values;
+
+    if (!gdxDataReadRawStart(gdx_src, src_sym_nr, &nrecs))
+    {
+        gdxErrorStr(gdx_src, gdxGetLastError(gdx_src), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxDataReadRawStart", "GDX error (gdxDataReadRawStart): %s", buf);
+    }
+
+    for (int i = 0; i < nrecs; i++)
+    {
+        if (!gdxDataReadRaw(gdx_src, gdx_uel_index, gdx_values, &lastdim))
+        {
+            gdxErrorStr(gdx_src, gdxGetLastError(gdx_src), buf);
+            mexErrMsgIdAndTxt(ERRID"gdxDataReadRaw", "GDX error (gdxDataReadRaw): %s", buf);
+        }
+
+        /* set element texts are stored by text id, which is file specific */
+        if (type == GMS_DT_SET && gdx_values[GMS_VAL_LEVEL] > 0)
+        {
+            if (!gdxGetElemText(gdx_src, (int) gdx_values[GMS_VAL_LEVEL], buf, &node))
+                gdx_values[GMS_VAL_LEVEL] = 0;
+            else if (!gdxAddSetText(gdx, buf, &text_id))
+            {
+                gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
+                mexErrMsgIdAndTxt(ERRID"gdxAddSetText", "GDX error (gdxAddSetText): %s", buf);
+            }
+            else
+                gdx_values[GMS_VAL_LEVEL] = text_id;
+        }
+        else if (eps_to_zero && type != GMS_DT_SET)
+        {
+            for (size_t k = 0; k < GMS_VAL_MAX; k++)
+                if (gdx_values[k] == GMS_SV_EPS)
+                    gdx_values[k] = 0.0;
+        }
+
+        /* source UEL labels (looked up once per UEL) */
+        for (size_t j = 0; j < dim; j++)
+        {
+            int uel = gdx_uel_index[j];
+            if (!uel_labels[uel])
+            {
+                if (!gdxUMUelGet(gdx_src, uel, buf, &ival))
+                {
+                    gdxErrorStr(gdx_src, gdxGetLastError(gdx_src), buf);
+                    mexErrMsgIdAndTxt(ERRID"gdxUMUelGet", "GDX error (gdxUMUelGet): %s", buf);
+                }
+                uel_labels[uel] = (char*) mxMalloc(strlen(buf) + 1);
+                strcpy(uel_labels[uel], buf);
+            }
+            keys[j] = uel_labels[uel];
+        }
+
+        if (!gdxDataWriteStr(gdx, keys, gdx_values))
+        {
+            gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
+            gt_gdx_get_record_name(gdx_src, name, dim, true, gdx_uel_index, rec_name);
+            mexErrMsgIdAndTxt(ERRID"gdxDataWriteStr", "GDX error in record %s: %s", rec_name, buf);
+        }
+    }
+
+    if (!gdxDataReadDone(gdx_src))
+    {
+        gdxErrorStr(gdx_src, gdxGetLastError(gdx_src), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxDataReadDone", "GDX error (gdxDataReadDone): %s", buf);
+    }
+}
+
 void gt_gdx_addalias(
     gdxHandle_t     gdx,            /** GDX handle */
     const char*     name,           /** name of alias symbol */
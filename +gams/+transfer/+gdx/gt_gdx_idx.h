@@ -71,6 +71,18 @@ void gt_gdx_register_uels(
     int*            uel_ids         /** array of uel ids returned by GDX */
 );
 
+/** copies records of symbol from source GDX by UEL label (call after gdxDataWriteStrStart) */
+void gt_gdx_copy_records(
+    gdxHandle_t     gdx,            /** GDX handle (write mode) */
+    gdxHandle_t     gdx_src,        /** source GDX handle (read mode) */
+    int             src_sym_nr,     /** symbol number in source GDX */
+    const char*     name,           /** name of symbol */
+    size_t          dim,            /** dimension of symbol */
+    int             type,           /** GDX symbol type */
+    bool            eps_to_zero,    /** flag to write GAMS EPS as 0 */
+    char**          uel_labels      /** labels of source UEL ids (in / out; NULL: not looked up yet) */
+);
+
 /** adds an alias to GDX */
 void gt_gdx_addalias(
     gdxHandle_t     gdx,            /** GDX handle */
@@ -27,6 +27,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <inttypes.h>
+#include <vector>
 
 #include "mex.h"
 
@@ -44,6 +45,113 @@
 
 #define GET_DOM_MAP(dim,idx) ((dom_symid[dim] <= 0) ? idx-1 : dom_uel_dim_maps[dom_symid[dim]][idx])
 
+/*
+ * Sessions keep a GDX file open between calls together with the data derived from it
+ * that does not depend on the symbols read (acronyms, maps of domain sets):
+ *
+ *   handle = gt_gdx_read('open', filename)
+ *   symbols = gt_gdx_read(handle, ...)
+ *   gt_gdx_read('close', handle)
+ *
+ * Reading with a file name instead of a handle uses a temporary session. The MEX file
+ * is locked as long as any session is open. A session left over by a failed open or read
+ * with a file name is closed by the next call (or when the MEX file is cleared).
+ */
+
+/** GDX file opened for reading */
+typedef struct
+{
+    gdxHandle_t     gdx;            /** GDX handle */
+    int             sym_count;      /** number of symbols */
+    int             uel_count;      /** number of UELs */
+    int             n_acronyms;     /** number of acronyms */
+    std::vector<int> acronyms;      /** acronym indices */
+    std::vector<std::vector<int> > dom_uel_dim_maps; /** map of UELs into domain set records per
+                                                        symbol (empty: not read yet) */
+    bool            busy;           /** true while reading (still true after a failed read) */
+} GT_GDX_SESSION;
+
+/** registry of sessions: handle - 1 is the index (NULL: closed) */
+static std::vector<GT_GDX_SESSION*> sessions;
+static size_t n_sessions = 0;
+
+/** session being opened or read by file name (not registered; closed by the next call) */
+static GT_GDX_SESSION* temp_session = NULL;
+
+/** opens GDX file and reads symbol independent data */
+static void gt_gdx_session_open(
+    GT_GDX_SESSION** session_out,   /** session (set before any error can occur) */
+    const char*     filename        /** GDX filename */
+)
+{
+    int ival;
+    char buf[GMS_SSSIZE], acr_name[GMS_SSSIZE], acr_text[GMS_SSSIZE];
+    GT_GDX_SESSION* session = new GT_GDX_SESSION;
+
+    *session_out = session;
+    session->gdx = NULL;
+    session->busy = false;
+    gt_gdx_init_read(&session->gdx, filename);
+    if (!gdxSystemInfo(session->gdx, &session->sym_count, &session->uel_count))
+    {
+        gdxErrorStr(session->gdx, gdxGetLastError(session->gdx), buf);
+        mexErrMsgIdAndTxt(ERRID"gdxSystemInfo", "GDX error (gdxSystemInfo): %s", buf);
+    }
+    session->dom_uel_dim_maps.resize(session->sym_count+1);
+
+    session->n_acronyms = gdxAcronymCount(session->gdx);
+    session->acronyms.resize(session->n_acronyms > 0 ? session->n_acronyms : 0);
+    for (int i = 0; i < session->n_acronyms; i++)
+    {
+        gdxAcronymGetInfo(session->gdx, i+1, acr_name, acr_text, &ival);
+        session->acronyms[i] = ival;
+    }
+}
+
+static void gt_gdx_session_close(
+    GT_GDX_SESSION* session         /** session */
+)
+{
+    if (session->gdx)
+    {
+        gdxClose(session->gdx);
+        gdxFree(&session->gdx);
+    }
+    delete session;
+}
+
+static void gt_gdx_session_close_temp(void)
+{
+    if (!temp_session)
+        return;
+    gt_gdx_session_close(temp_session);
+    temp_session = NULL;
+}
+
+static void gt_gdx_session_at_exit(void)
+{
+    gt_gdx_session_close_temp();
+    for (size_t i = 0; i < sessions.size(); i++)
+        if (sessions[i])
+            gt_gdx_session_close(sessions[i]);
+    sessions.clear();
+    n_sessions = 0;
+}
+
+static size_t gt_gdx_session_get_handle(
+    const mxArray*  mx_arr_handle,  /** session handle */
+    int             arg_position    /** argument position */
+)
+{
+    if (!mxIsDouble(mx_arr_handle) || mxGetNumberOfElements(mx_arr_handle) != 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument #%d has invalid type: need session handle",
+            arg_position);
+    double handle = mxGetScalar(mx_arr_handle);
+    if (handle < 1 || handle > sessions.size() || !sessions[(size_t) handle - 1])
+        mexErrMsgIdAndTxt(ERRID"handle", "Invalid GDX session handle.");
+    return (size_t) handle - 1;
+}
+
 void mexFunction(
     int             nlhs,
     mxArray*        plhs[],
@@ -54,7 +162,8 @@ void mexFunction(
     int sym_id, format, orig_format, type, subtype, lastdim, ival, sym_count, num_out_of_bounds;
     int n_acronyms, uel_count, dom_type;
     size_t dim, nrecs, nvals, n_dom_fields;
-    bool support_categorical, support_setget, read_records, unique_labels;
+    bool support_categorical, support_setget, read_records, unique_labels, temporary_session;
+    char op[8];
     bool orig_values_flag[GMS_VAL_MAX], values_flag[GMS_VAL_MAX];
     char buf[GMS_SSSIZE], gdx_filename[GMS_SSSIZE];
     char name[GMS_SSSIZE], text[GMS_SSSIZE];
@@ -66,7 +175,6 @@ void mexFunction(
     gdxUelIndex_t gdx_uel_index;
     gdxUelIndex_t dom_symid;
     gdxValues_t gdx_values;
-    int** dom_uel_dim_maps = NULL;
     int* dom_uels_used[GLOBAL_MAX_INDEX_DIM] = {NULL};
     int* acronyms = NULL;
     bool* sym_enabled = NULL;
@@ -91,13 +199,57 @@ void mexFunction(
     mxArray* mx_arr_dom_uels[GLOBAL_MAX_INDEX_DIM] = {NULL};
     mxArray* mx_arr_values[GMS_VAL_MAX] = {NULL};
     mxArray** mx_arr_dom_idx = NULL;
+    mxArray* mx_arr_profile = NULL;
+    GT_PROFILE profile;
+    GT_ARENA scratch;
+    GT_GDX_SESSION* session = NULL;
 
     GDXSTRINDEXPTRS_INIT(domains, domains_ptr);
     GDXSTRINDEXPTRS_INIT(domain_labels, domain_labels_ptr);
 
+    mexAtExit(gt_gdx_session_at_exit);
+    gt_gdx_session_close_temp();
+
+    /* open or close session */
+    if (nrhs == 2 && mxIsChar(prhs[0]))
+    {
+        mxGetString(prhs[0], op, 8);
+        if (!strcmp(op, "open"))
+        {
+            size_t idx = 0;
+            gt_mex_check_argument_str(prhs, 1, gdx_filename);
+            gt_gdx_session_open(&temp_session, gdx_filename);
+            session = temp_session;
+            temp_session = NULL;
+            while (idx < sessions.size() && sessions[idx])
+                idx++;
+            if (idx == sessions.size())
+                sessions.push_back(NULL);
+            sessions[idx] = session;
+            if (n_sessions++ == 0)
+                mexLock();
+            plhs[0] = mxCreateDoubleScalar((double) (idx + 1));
+        }
+        else if (!strcmp(op, "close"))
+        {
+            size_t idx = gt_gdx_session_get_handle(prhs[1], 1);
+            gt_gdx_session_close(sessions[idx]);
+            sessions[idx] = NULL;
+            if (--n_sessions == 0)
+                mexUnlock();
+        }
+        else
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument #0 must be one of the following: open, close.");
+        return;
+    }
+
     /* check input / outputs */
-    gt_mex_check_arguments_num(1, nlhs, 7, nrhs);
-    gt_mex_check_argument_str(prhs, 0, gdx_filename);
+    gt_mex_check_arguments_num_range(1, 2, nlhs, 7, nrhs);
+    temporary_session = mxIsChar(prhs[0]);
+    if (temporary_session)
+        gt_mex_check_argument_str(prhs, 0, gdx_filename);
+    else
+        session = sessions[gt_gdx_session_get_handle(prhs[0], 0)];
     gt_mex_check_argument_cell(prhs, 1);
     gt_mex_check_argument_int(prhs, 2, GT_FILTER_NONE, 1, &orig_format);
     gt_mex_check_argument_bool(prhs, 3, 1, &read_records);
@@ -105,23 +257,45 @@ void mexFunction(
     gt_mex_check_argument_bool(prhs, 5, 1, &support_categorical);
     gt_mex_check_argument_bool(prhs, 6, 1, &support_setget);
     if (orig_format != GT_FORMAT_STRUCT && orig_format != GT_FORMAT_DENSEMAT &&
-        orig_format != GT_FORMAT_SPARSEMAT && orig_format != GT_FORMAT_TABLE)
+        orig_format != GT_FORMAT_SPARSEMAT && orig_format != GT_FORMAT_TABLE &&
+        orig_format != GT_FORMAT_SPARSETENSOR)
         mexErrMsgIdAndTxt(ERRID"format", "Invalid record format.");
 
-    /* create output data */
+    /* create output data (optional second output: profile) */
     plhs[0] = mxCreateStructMatrix(1, 1, 0, NULL);
+    if (nlhs > 1)
+    {
+        mx_arr_profile = mxCreateStructMatrix(1, 1, 0, NULL);
+        plhs[1] = mx_arr_profile;
+    }
 
-    /* start GDX */
-    gt_gdx_init_read(&gdx, gdx_filename);
-    if (!gdxSystemInfo(gdx, &sym_count, &uel_count))
+    /* start GDX (or continue session) */
+    if (temporary_session)
     {
-        gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
-        mexErrMsgIdAndTxt(ERRID"gdxSystemInfo", "GDX error (gdxSystemInfo): %s", buf);
+        gt_gdx_session_open(&temp_session, gdx_filename);
+        session = temp_session;
     }
+    else if (session->busy)
+    {
+        /* previous read of session failed: reset read state and domain maps */
+        gdxDataReadDone(session->gdx);
+        gdxGetLastError(session->gdx);
+        for (size_t i = 0; i < session->dom_uel_dim_maps.size(); i++)
+            session->dom_uel_dim_maps[i].clear();
+    }
+    session->busy = true;
+    gdx = session->gdx;
+    sym_count = session->sym_count;
+    uel_count = session->uel_count;
+    n_acronyms = session->n_acronyms;
+    acronyms = session->acronyms.data();
+    std::vector<std::vector<int> >& dom_uel_dim_maps = session->dom_uel_dim_maps;
 
-    dom_uel_dim_maps = (int**) mxCalloc(sym_count+1, sizeof(int*));
     sym_enabled = (bool*) mxCalloc(sym_count+1, sizeof(bool));
 
+    /* temporary data of a symbol (released at once for each symbol) */
+    gt_arena_init(&scratch, 64 * 1024, 16 * 1024 * 1024);
+
     /* get symbol ids */
     if (mxGetNumberOfElements(prhs[1]) == 0)
     {
@@ -149,29 +323,22 @@ void mexFunction(
     }
 
     /* check for acronyms */
-    n_acronyms = gdxAcronymCount(gdx);
     if (n_acronyms > 0)
-    {
-        char acr_name[GMS_SSSIZE], acr_text[GMS_SSSIZE];
-
         mexWarnMsgIdAndTxt(ERRID"found_acronyms", "GDX file contains acronyms. "
             "Acronyms are not supported and are set to GAMS NA.");
-        acronyms = (int*) mxCalloc(n_acronyms, sizeof(int));
-        for (int i = 0; i < n_acronyms; i++)
-        {
-            gdxAcronymGetInfo(gdx, i+1, acr_name, acr_text, &ival);
-            acronyms[i] = ival;
-        }
-    }
 
     for (int i = 0; i < sym_count+1; i++)
     {
         if (!sym_enabled[i])
             continue;
         sym_id = i;
+        gt_mex_profile_start(&profile, mx_arr_profile != NULL, GT_PHASE_SYMBOL);
 
         /* reset data */
+        gt_arena_reset(&scratch);
         mx_arr_uels = NULL;
+        mx_arr_dom_idx = NULL;
+        mx_dom_idx = NULL;
         for (size_t j = 0; j < GMS_VAL_MAX; j++)
         {
             col_nnz[j] = NULL;
@@ -246,6 +413,7 @@ void mexFunction(
             case GT_FORMAT_TABLE:
                 break;
             case GT_FORMAT_DENSEMAT:
+            case GT_FORMAT_SPARSETENSOR:
                 if (type == GMS_DT_SET)
                     format = GT_FORMAT_STRUCT;
                 break;
@@ -295,6 +463,7 @@ void mexFunction(
         mx_arr_records = mxCreateStructMatrix(1, 1, 0, NULL);
 
         /* get domain information */
+        gt_mex_profile_phase(&profile, GT_PHASE_DOMAIN);
         for (size_t j = 0; j < GLOBAL_MAX_INDEX_DIM; j++)
             mx_dom_nrecs[j] = 1;
         for (size_t j = 0; j < dim; j++)
@@ -320,15 +489,13 @@ void mexFunction(
             mx_dom_nrecs[j] = (mwSize) dom_nrecs;
 
             /* create storage for tracking domain uels usage */
-            dom_uels_used[j] = (int*) mxCalloc(mx_dom_nrecs[j], sizeof(int));
+            dom_uels_used[j] = (int*) gt_arena_calloc(&scratch, mx_dom_nrecs[j], sizeof(int));
 
             /* check if we have domain information already; otherwise cache map */
-            if (dom_symid[j] > 0 || !dom_uel_dim_maps[dom_symid[j]])
+            if (dom_uel_dim_maps[dom_symid[j]].empty())
             {
                 /* create storage for domain uels map (domain into universe) */
-                dom_uel_dim_maps[dom_symid[j]] = (int*) mxCalloc(uel_count+1, sizeof(int));
-                for (int k = 0; k < uel_count+1; k++)
-                    dom_uel_dim_maps[dom_symid[j]][k] = -1;
+                dom_uel_dim_maps[dom_symid[j]].assign(uel_count+1, -1);
 
                 /* read domain records */
                 for (size_t k = 0; k < mx_dom_nrecs[j]; k++)
@@ -356,26 +523,45 @@ void mexFunction(
             else
                 sizes[j] = mxGetNaN();
 
+        /* linear tensor indices must be exact in doubles */
+        if (format == GT_FORMAT_SPARSETENSOR)
+        {
+            size_t shape[GLOBAL_MAX_INDEX_DIM];
+            for (size_t j = 0; j < dim; j++)
+                shape[j] = (size_t) mx_dom_nrecs[j];
+            gt_utils_check_tensor_shape(name, dim, shape);
+        }
+
         /* get default values dependent on type */
         gt_utils_type_default_values(type, subtype, true, def_values);
 
         /* create format dependent data (e.g. number of nonzeros, domain fields) */
+        gt_mex_profile_phase(&profile, GT_PHASE_RECORDS);
         switch (format)
         {
             case GT_FORMAT_STRUCT:
             case GT_FORMAT_TABLE:
-                mx_arr_dom_idx = (mxArray**) mxCalloc(dim, sizeof(*mx_arr_dom_idx));
+                mx_arr_dom_idx = (mxArray**) gt_arena_calloc(&scratch, dim, sizeof(*mx_arr_dom_idx));
+#ifdef WITH_R2018A_OR_NEWER
+                mx_dom_idx = (mxUint64**) gt_arena_calloc(&scratch, dim, sizeof(*mx_dom_idx));
+#else
+                mx_dom_idx = (UINT64_T**) gt_arena_calloc(&scratch, dim, sizeof(*mx_dom_idx));
+#endif
+                break;
+
+            case GT_FORMAT_SPARSETENSOR:
+                mx_arr_dom_idx = (mxArray**) gt_arena_calloc(&scratch, 1, sizeof(*mx_arr_dom_idx));
 #ifdef WITH_R2018A_OR_NEWER
-                mx_dom_idx = (mxUint64**) mxCalloc(dim, sizeof(*mx_dom_idx));
+                mx_dom_idx = (mxUint64**) gt_arena_calloc(&scratch, 1, sizeof(*mx_dom_idx));
 #else
-                mx_dom_idx = (UINT64_T**) mxCalloc(dim, sizeof(*mx_dom_idx));
+                mx_dom_idx = (UINT64_T**) gt_arena_calloc(&scratch, 1, sizeof(*mx_dom_idx));
 #endif
                 break;
 
             case GT_FORMAT_SPARSEMAT:
                 for (size_t j = 0; j < GMS_VAL_MAX; j++)
                     if (values_flag[j])
-                        col_nnz[j] = (mwIndex*) mxCalloc(mx_dom_nrecs[1], sizeof(mwIndex));
+                        col_nnz[j] = (mwIndex*) gt_arena_calloc(&scratch, mx_dom_nrecs[1], sizeof(mwIndex));
 
                 if (!gdxDataReadRawStart(gdx, sym_id, &ival))
                 {
@@ -434,8 +620,7 @@ void mexFunction(
             gt_mex_addsymbol(plhs[0], name, text, type, subtype, format, dim, sizes,
                 (const char**) domains_ptr, (const char**) domain_labels_ptr, dom_type, nrecs, 0,
                 mx_arr_records, NULL);
-            for (size_t j = 0; j < dim; j++)
-                mxFree(dom_uels_used[j]);
+            gt_mex_profile_add(mx_arr_profile, name, &profile);
             continue;
         }
 
@@ -587,6 +772,60 @@ void mexFunction(
                             mx_values[k][mx_flat_idx[k]] = gt_utils_sv_gams2matlab(gdx_values[k], n_acronyms, acronyms);
                 }
                 break;
+
+            case GT_FORMAT_SPARSETENSOR:
+                for (size_t j = 0, jj = 0; j < nrecs; j++)
+                {
+                    bool out_of_bounds = false;
+
+                    /* read values */
+                    if (!gdxDataReadRaw(gdx, gdx_uel_index, gdx_values, &lastdim))
+                    {
+                        gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
+                        mexErrMsgIdAndTxt(ERRID"gdxDataReadRaw", "GDX error (gdxDataReadRaw): %s", buf);
+                    }
+
+                    /* get linear (column-major) index in tensor and store domain labels */
+                    mx_dom_idx[0][jj] = 0;
+                    for (size_t k1 = dim, k; k1 > 0; k1--)
+                    {
+                        k = k1 - 1;
+                        if (gdx_uel_index[k] < 1 || gdx_uel_index[k] > uel_count)
+                        {
+                            out_of_bounds = true;
+                            break;
+                        }
+                        idx = GET_DOM_MAP(k, gdx_uel_index[k]);
+                        mx_dom_idx[0][jj] = mx_dom_idx[0][jj] * mx_dom_nrecs[k] + idx;
+                        dom_uels_used[k][idx] = true;
+                    }
+                    if (out_of_bounds)
+                    {
+                        num_out_of_bounds++;
+                        continue;
+                    }
+                    mx_dom_idx[0][jj]++;
+
+                    /* parse values */
+                    for (size_t k = 0; k < GMS_VAL_MAX; k++)
+                        if (values_flag[k])
+                            mx_values[k][jj] = gt_utils_sv_gams2matlab(gdx_values[k], n_acronyms, acronyms);
+                    jj++;
+                }
+
+                /* ignored records are dropped */
+                if (num_out_of_bounds > 0)
+                {
+                    nrecs -= num_out_of_bounds;
+                    mxSetM(mx_arr_dom_idx[0], nrecs);
+                    for (size_t k = 0; k < GMS_VAL_MAX; k++)
+                        if (values_flag[k])
+                        {
+                            mxSetM(mx_arr_values[k], nrecs);
+                            nvals -= num_out_of_bounds;
+                        }
+                }
+                break;
         }
 
         if (!gdxDataReadDone(gdx))
@@ -605,6 +844,7 @@ void mexFunction(
             {
                 case GT_FORMAT_DENSEMAT:
                 case GT_FORMAT_SPARSEMAT:
+                case GT_FORMAT_SPARSETENSOR:
                     strcat(msg, " These records will be ignored.");
             }
             mexWarnMsgIdAndTxt(ERRID"symbol:record_out_of_bounds", msg);
@@ -614,6 +854,7 @@ void mexFunction(
         if (type == GMS_DT_SET && values_flag[GMS_VAL_LEVEL])
         {
             mxArray* mx_arr_text = mxCreateCellMatrix(nrecs, 1);
+            gt_mex_profile_phase(&profile, GT_PHASE_TEXT);
 
             /* get set element explanatory text */
             for (size_t j = 0; j < mxGetNumberOfElements(mx_arr_values[GMS_VAL_LEVEL]); j++)
@@ -628,6 +869,7 @@ void mexFunction(
             }
 
             /* convert text into categorical */
+            gt_mex_profile_phase(&profile, GT_PHASE_CATEGORICAL);
             if (support_categorical)
                 gt_mex_categorical(&mx_arr_text);
 
@@ -636,6 +878,7 @@ void mexFunction(
         }
 
         /* collect uels (only used UELs in case of table like formats) */
+        gt_mex_profile_phase(&profile, GT_PHASE_UELS);
         bool collect_only_used_uels = false;
         bool uels_to_categorical = support_categorical;
         switch (format)
@@ -656,6 +899,7 @@ void mexFunction(
                     dom_uels_used[j][k] = -1;
 
             mx_arr_dom_uels[j] = mxCreateCellMatrix(num_used, 1);
+            profile.n_uels += num_used;
 
             /* get used uels list */
             for (int k = 1, kk = 0; k < uel_count+1; k++)
@@ -686,7 +930,23 @@ void mexFunction(
                         mx_dom_idx[j][k] = dom_uels_used[j][mx_dom_idx[j][k]-1] + 1;
         }
 
+        /* size of record and uel arrays (before conversion to categorical) */
+        if (profile.enabled)
+        {
+            for (size_t j = 0; j < dim; j++)
+            {
+                if (format == GT_FORMAT_STRUCT || format == GT_FORMAT_TABLE ||
+                    (format == GT_FORMAT_SPARSETENSOR && j == 0))
+                    profile.n_bytes += gt_mex_sizeof(mx_arr_dom_idx[j]);
+                profile.n_bytes += gt_mex_sizeof(mx_arr_dom_uels[j]);
+            }
+            for (size_t j = 0; j < GMS_VAL_MAX; j++)
+                if (values_flag[j])
+                    profile.n_bytes += gt_mex_sizeof(mx_arr_values[j]);
+        }
+
         /* set domain fields */
+        gt_mex_profile_phase(&profile, GT_PHASE_CATEGORICAL);
         switch (format)
         {
             case GT_FORMAT_STRUCT:
@@ -697,6 +957,10 @@ void mexFunction(
                 for (size_t j = 0; j < dim; j++)
                     mxSetFieldByNumber(mx_arr_records, 0, (int) j, mx_arr_dom_idx[j]);
                 break;
+            case GT_FORMAT_SPARSETENSOR:
+                mxSetFieldByNumber(mx_arr_records, 0, 0, mx_arr_dom_idx[0]);
+                mxSetFieldByNumber(mx_arr_records, 0, 1, gt_mex_tensor_shape(dim, mx_dom_nrecs));
+                break;
         }
 
         /* set value fields */
@@ -715,6 +979,7 @@ void mexFunction(
                     break;
             case GT_FORMAT_DENSEMAT:
             case GT_FORMAT_SPARSEMAT:
+            case GT_FORMAT_SPARSETENSOR:
                 mx_arr_uels = mxCreateCellMatrix(1, dim);
                 for (size_t j = 0; j < dim; j++)
                     mxSetCell(mx_arr_uels, j, mx_arr_dom_uels[j]);
@@ -722,6 +987,7 @@ void mexFunction(
         }
 
         /* convert struct to table */
+        gt_mex_profile_phase(&profile, GT_PHASE_TABLE);
         if (format == GT_FORMAT_TABLE)
             gt_mex_struct2table(&mx_arr_records);
 
@@ -729,33 +995,14 @@ void mexFunction(
         gt_mex_addsymbol(plhs[0], name, text, type, subtype, format, dim, sizes,
             (const char**) domains_ptr, (const char**) domain_labels_ptr, dom_type,
             nrecs, nvals, mx_arr_records, mx_arr_uels);
-
-        /* free */
-        for (size_t j = 0; j < dim; j++)
-            mxFree(dom_uels_used[j]);
-        switch (format)
-        {
-            case GT_FORMAT_STRUCT:
-            case GT_FORMAT_TABLE:
-                mxFree(mx_arr_dom_idx);
-                mxFree(mx_dom_idx);
-                break;
-            case GT_FORMAT_SPARSEMAT:
-                for (size_t j = 0; j < dim; j++)
-                    if (values_flag[j])
-                        mxFree(col_nnz[j]);
-                break;
-        }
+        profile.n_records = nrecs;
+        gt_mex_profile_add(mx_arr_profile, name, &profile);
     }
 
-    gdxClose(gdx);
-    gdxFree(&gdx);
+    session->busy = false;
+    if (temporary_session)
+        gt_gdx_session_close_temp();
 
-    for (int i = 0; i < sym_count; i++)
-        if (dom_uel_dim_maps[i])
-            mxFree(dom_uel_dim_maps[i]);
-    mxFree(dom_uel_dim_maps);
+    gt_arena_free(&scratch);
     mxFree(sym_enabled);
-    if (n_acronyms > 0)
-        mxFree(acronyms);
 }
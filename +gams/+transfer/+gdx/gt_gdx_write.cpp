@@ -49,16 +49,19 @@ void mexFunction(
 {
     int type, subtype, format, sym_nr;
     size_t dim, nrecs;
-    char gdx_filename[GMS_SSSIZE], buf[GMS_SSSIZE], name[GMS_SSSIZE];
+    int src_sym_count, src_uel_count;
+    char gdx_filename[GMS_SSSIZE], src_filename[GMS_SSSIZE], buf[GMS_SSSIZE], name[GMS_SSSIZE];
     char text[GMS_SSSIZE], dominfo[10];
     double def_values[GMS_VAL_MAX];
     bool was_table, support_table, support_categorical, compress, issorted, singleton, eps_to_zero;
     bool have_nrecs, can_skip_default_recs;
     char* data_name = NULL;
     gdxHandle_t gdx = NULL;
+    gdxHandle_t gdx_src = NULL;
     gdxStrIndexPtrs_t domains_ptr;
     gdxStrIndex_t domains;
     gdxUelIndex_t gdx_uel_index;
+    gdxUelIndex_t last_uel_index;
     gdxValues_t gdx_values;
     mwIndex idx;
     mwIndex mx_idx[GLOBAL_MAX_INDEX_DIM];
@@ -68,29 +71,37 @@ void mexFunction(
     size_t* domain_uel_size = NULL;
     size_t* col_nnz[GMS_VAL_MAX] = {NULL};
     int** domain_uel_ids = NULL;
+    char** src_uel_labels = NULL;
 #ifdef WITH_R2018A_OR_NEWER
     mxInt32** mx_domains = NULL;
+    mxUint64* mx_index = NULL;
     mxDouble* mx_values[GMS_VAL_MAX] = {NULL};
 #else
     INT32_T** mx_domains = NULL;
+    UINT64_T* mx_index = NULL;
     double* mx_values[GMS_VAL_MAX] = {NULL};
 #endif
     mxLogical* mx_enable = NULL;
+    mxLogical* mx_copy = NULL;
     mxArray* mx_arr_symbol = NULL;
     mxArray* mx_arr_symbol_def = NULL;
     mxArray* mx_arr_symbol_data = NULL;
     mxArray* mx_arr_records = NULL;
+    mxArray* mx_arr_index = NULL;
     mxArray* mx_arr_text = NULL;
     mxArray* mx_arr_uels = NULL;
     mxArray* mx_arr_values[GMS_VAL_MAX] = {NULL};
     mxArray* call_plhs[1] = {NULL};
     mxArray* call_prhs[2] = {NULL};
     mxArray** mx_arr_domains = NULL;
+    mxArray* mx_arr_profile = NULL;
+    GT_PROFILE profile;
+    GT_ARENA scratch;
 
     GDXSTRINDEXPTRS_INIT(domains, domains_ptr);
 
     /* check input / outputs */
-    gt_mex_check_arguments_num(0, nlhs, 9, nrhs);
+    gt_mex_check_arguments_num_range(0, 1, nlhs, 11, nrhs);
     gt_mex_check_argument_str(prhs, 0, gdx_filename);
     gt_mex_check_argument_struct(prhs, 1);
     gt_mex_check_argument_cell(prhs, 3);
@@ -99,9 +110,17 @@ void mexFunction(
     gt_mex_check_argument_bool(prhs, 6, 1, &eps_to_zero);
     gt_mex_check_argument_bool(prhs, 7, 1, &support_table);
     gt_mex_check_argument_bool(prhs, 8, 1, &support_categorical);
+    gt_mex_check_argument_str(prhs, 9, src_filename);
+    if (!mxIsLogical(prhs[10]) || mxGetNumberOfElements(prhs[10]) != mxGetNumberOfElements(prhs[2]))
+        mexErrMsgIdAndTxt(ERRID"prhs10", "Argument #11 has invalid type or size.");
 
-    /* create output data */
-    plhs = NULL;
+    /* create output data (optional output: profile) */
+    if (nlhs > 0)
+    {
+        mx_arr_profile = mxCreateStructMatrix(1, 1, 0, NULL);
+        plhs[0] = mx_arr_profile;
+    }
+    gt_mex_profile_start(&profile, false, GT_PHASE_NONE);
 
     /* start GDX */
     gt_gdx_init_write(&gdx, gdx_filename, compress);
@@ -109,19 +128,41 @@ void mexFunction(
     /* register priority UELs */
     gt_gdx_register_uels(gdx, (mxArray*) prhs[3], NULL);
 
-
 #ifdef WITH_R2018A_OR_NEWER
     mx_enable = mxGetLogicals(prhs[2]);
+    mx_copy = mxGetLogicals(prhs[10]);
 #else
     mx_enable = (mxLogical*) mxGetData(prhs[2]);
+    mx_copy = (mxLogical*) mxGetData(prhs[10]);
 #endif
+
+    /* open source GDX for copying unmodified symbols: records are written by UEL label, such that
+     * only the UELs of the copied records get registered (labels are looked up once per UEL) */
+    if (strlen(src_filename) > 0)
+    {
+        gt_gdx_init_read(&gdx_src, src_filename);
+        if (!gdxSystemInfo(gdx_src, &src_sym_count, &src_uel_count))
+        {
+            gdxErrorStr(gdx_src, gdxGetLastError(gdx_src), buf);
+            mexErrMsgIdAndTxt(ERRID"gdxSystemInfo", "GDX error (gdxSystemInfo): %s", buf);
+        }
+        src_uel_labels = (char**) mxCalloc(src_uel_count+1, sizeof(*src_uel_labels));
+    }
+
+    /* temporary data of a symbol (released at once for each symbol) */
+    gt_arena_init(&scratch, 64 * 1024, 16 * 1024 * 1024);
+
     sym_nr = 0;
     for (int i = 0; i < mxGetNumberOfFields(prhs[1]); i++)
     {
+        /* add profile of previous symbol */
+        gt_mex_profile_add(mx_arr_profile, name, &profile);
+
         if (!mx_enable[i])
             continue;
 
         /* reset pointers */
+        gt_arena_reset(&scratch);
         for (size_t j = 0; j < GMS_VAL_MAX; j++)
         {
             mx_rows[j] = NULL;
@@ -130,6 +171,8 @@ void mexFunction(
             mx_values[j] = NULL;
             mx_arr_values[j] = NULL;
         }
+        mx_arr_index = NULL;
+        mx_arr_text = NULL;
 
         sym_nr++;
 
@@ -194,12 +237,15 @@ void mexFunction(
             format = GT_FORMAT_DENSEMAT;
         else if (mxIsClass(mx_arr_symbol_data, "gams.transfer.symbol.data.SparseMatrix"))
             format = GT_FORMAT_SPARSEMAT;
+        else if (mxIsClass(mx_arr_symbol_data, "gams.transfer.symbol.data.SparseTensor"))
+            format = GT_FORMAT_SPARSETENSOR;
         else
             continue;
 
         /* get fields */
         gt_mex_getfield_str(mx_arr_symbol, data_name, "name_", "", true, name, GMS_SSSIZE);
         gt_mex_getfield_str(mx_arr_symbol, data_name, "description_", "", false, text, GMS_SSSIZE);
+        gt_mex_profile_start(&profile, mx_arr_profile != NULL, GT_PHASE_SYMBOL);
 
         /* get domain */
         {
@@ -236,28 +282,65 @@ void mexFunction(
                 strcpy(dominfo, "relaxed");
         }
 
+        /* copy records of unmodified symbol from source GDX (if available there) */
+        if (gdx_src && mx_copy[i])
+        {
+            int src_sym_nr, src_dim, src_type;
+            char src_name[GMS_SSSIZE];
+
+            if (gdxFindSymbol(gdx_src, name, &src_sym_nr) &&
+                gdxSymbolInfo(gdx_src, src_sym_nr, src_name, &src_dim, &src_type) &&
+                src_dim == (int) dim && src_type == type)
+            {
+                if (!gdxDataWriteStrStart(gdx, name, text, (int) dim, type, subtype))
+                {
+                    gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
+                    mexErrMsgIdAndTxt(ERRID"gdxDataWriteStrStart", "GDX error (gdxDataWriteStrStart): %s", buf);
+                }
+                if (dim > 0)
+                    gt_gdx_setdomain(gdx, dominfo, sym_nr, (const char**) domains_ptr);
+
+                gt_mex_profile_phase(&profile, GT_PHASE_RECORDS);
+                gt_gdx_copy_records(gdx, gdx_src, src_sym_nr, name, dim, type, eps_to_zero, src_uel_labels);
+
+                if (!gdxDataWriteDone(gdx))
+                {
+                    gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
+                    mexErrMsgIdAndTxt(ERRID"gdxDataWriteDone", "GDX error (gdxDataWriteDone): %s", buf);
+                }
+                if (gdxDataErrorCount(gdx))
+                {
+                    gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
+                    mexErrMsgIdAndTxt(ERRID"gdxError", "GDX error for %s: %s", name, buf);
+                }
+                continue;
+            }
+        }
+
         /* get UELs */
+        gt_mex_profile_phase(&profile, GT_PHASE_UELS);
         mx_arr_uels = mxCreateCellMatrix(1, dim);
         for (size_t j = 0; j < dim; j++)
         {
             call_prhs[0] = mx_arr_symbol;
             call_prhs[1] = mxCreateDoubleScalar(j+1);
-            if (mexCallMATLAB(1, call_plhs, 2, call_prhs, "getAxisLabels"))
+            if (gt_mex_callmatlab(1, call_plhs, 2, call_prhs, "getAxisLabels"))
                 mexErrMsgIdAndTxt(ERRID"number_records", "Calling 'getAxisLabels' failed.");
             mxSetCell(mx_arr_uels, j, call_plhs[0]);
             sizes[j] = mxGetNumberOfElements(call_plhs[0]);
         }
 
-        domain_uel_size = (size_t*) mxCalloc(dim, sizeof(*domain_uel_size));
-        domain_uel_ids = (int**) mxCalloc(dim, sizeof(*domain_uel_ids));
-        mx_arr_domains = (mxArray**) mxCalloc(dim, sizeof(*mx_arr_domains));
+        domain_uel_size = (size_t*) gt_arena_calloc(&scratch, dim, sizeof(*domain_uel_size));
+        domain_uel_ids = (int**) gt_arena_calloc(&scratch, dim, sizeof(*domain_uel_ids));
+        mx_arr_domains = (mxArray**) gt_arena_calloc(&scratch, dim, sizeof(*mx_arr_domains));
 #ifdef WITH_R2018A_OR_NEWER
-        mx_domains = (mxInt32**) mxCalloc(dim, sizeof(*mx_domains));
+        mx_domains = (mxInt32**) gt_arena_calloc(&scratch, dim, sizeof(*mx_domains));
 #else
-        mx_domains = (INT32_T**) mxCalloc(dim, sizeof(*mx_domains));
+        mx_domains = (INT32_T**) gt_arena_calloc(&scratch, dim, sizeof(*mx_domains));
 #endif
 
         /* get optional fields that are format dependent */
+        gt_mex_profile_phase(&profile, GT_PHASE_TABLE);
         if (format != GT_FORMAT_EMPTY)
         {
             if (support_table)
@@ -270,16 +353,19 @@ void mexFunction(
         }
 
         /* register uels */
+        gt_mex_profile_phase(&profile, GT_PHASE_UELS);
         for (size_t j = 0; j < dim; j++)
         {
             mxArray* mx_field = mxGetCell(mx_arr_uels, j);
             domain_uel_size[j] = mxGetNumberOfElements(mx_field);
+            profile.n_uels += domain_uel_size[j];
 
-            domain_uel_ids[j] = (int*) mxCalloc(domain_uel_size[j], sizeof(int));
+            domain_uel_ids[j] = (int*) gt_arena_calloc(&scratch, domain_uel_size[j], sizeof(int));
 
             gt_gdx_register_uels(gdx, mx_field, domain_uel_ids[j]);
         }
 
+        gt_mex_profile_phase(&profile, GT_PHASE_DOMAIN);
         if (issorted)
         {
             if (!gdxDataWriteRawStart(gdx, name, text, (int) dim, type, subtype))
@@ -310,21 +396,28 @@ void mexFunction(
                 gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
                 mexErrMsgIdAndTxt(ERRID"gdxDataWriteDone", "GDX error (gdxDataWriteDone): %s", buf);
             }
-            mxFree(mx_arr_domains);
-            mxFree(mx_domains);
-            for (size_t j = 0; j < dim; j++)
-                mxFree(domain_uel_ids[j]);
-            mxFree(domain_uel_size);
-            mxFree(domain_uel_ids);
             continue;
         }
 
-        /* get domain and value fields of record field */
+        /* get domain and value fields of record field (converts categorical) */
+        gt_mex_profile_phase(&profile, GT_PHASE_CATEGORICAL);
+        if (format == GT_FORMAT_SPARSETENSOR)
+            gt_mex_get_tensor_index(data_name, mx_arr_records, &mx_arr_index, &mx_index);
         gt_mex_get_records(data_name, dim, support_categorical, mx_arr_records,
             mx_arr_values, mx_values, mx_arr_domains, mx_domains, &mx_arr_text);
         gt_utils_type_default_values(type, subtype, false, def_values);
+        if (profile.enabled)
+        {
+            profile.n_bytes = gt_mex_sizeof(mx_arr_index);
+            for (size_t j = 0; j < dim; j++)
+                profile.n_bytes += gt_mex_sizeof(mx_arr_domains[j]);
+            for (size_t j = 0; j < GMS_VAL_MAX; j++)
+                profile.n_bytes += gt_mex_sizeof(mx_arr_values[j]);
+            profile.n_bytes += gt_mex_sizeof(mx_arr_text);
+        }
 
         /* register set explanatory texts */
+        gt_mex_profile_phase(&profile, GT_PHASE_TEXT);
         if (type == GMS_DT_SET && mx_arr_text)
         {
             mxAssert(format == GT_FORMAT_TABLE || format == GT_FORMAT_STRUCT,
@@ -334,6 +427,7 @@ void mexFunction(
         }
 
         /* get number of records */
+        gt_mex_profile_phase(&profile, GT_PHASE_RECORDS);
         nrecs = 0;
         have_nrecs = false;
         switch (format)
@@ -359,7 +453,21 @@ void mexFunction(
                     }
                 have_nrecs = true; // number of records: 0
                 break;
+            case GT_FORMAT_SPARSETENSOR:
+                nrecs = mxGetNumberOfElements(mx_arr_index);
+                have_nrecs = true;
+                for (size_t j = 0; j < GMS_VAL_MAX; j++)
+                {
+                    if (!mx_arr_values[j] || mxGetNumberOfElements(mx_arr_values[j]) == nrecs)
+                        continue;
+                    if (mxGetNumberOfElements(mx_arr_values[j]) > 0)
+                        mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has tensor values of "
+                            "invalid size.", name);
+                    mx_arr_values[j] = NULL;
+                }
+                break;
         }
+        profile.n_records = nrecs;
         if (have_nrecs && nrecs == 0)
         {
             if (!gdxDataWriteDone(gdx))
@@ -367,12 +475,6 @@ void mexFunction(
                 gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
                 mexErrMsgIdAndTxt(ERRID"gdxDataWriteDone", "GDX error (gdxDataWriteDone): %s", buf);
             }
-            mxFree(mx_arr_domains);
-            mxFree(mx_domains);
-            for (size_t j = 0; j < dim; j++)
-                mxFree(domain_uel_ids[j]);
-            mxFree(domain_uel_size);
-            mxFree(domain_uel_ids);
             continue;
         }
 
@@ -484,7 +586,7 @@ void mexFunction(
                 {
                     if (!mx_arr_values[j])
                         continue;
-                    col_nnz[j] = (size_t*) mxCalloc(sizes[1], sizeof(size_t));
+                    col_nnz[j] = (size_t*) gt_arena_calloc(&scratch, sizes[1], sizeof(size_t));
                     mx_rows[j] = mxGetIr(mx_arr_values[j]);
                     mx_cols[j] = mxGetJc(mx_arr_values[j]);
                 }
@@ -533,10 +635,60 @@ void mexFunction(
                         }
                     }
                 }
+                break;
 
-                for (size_t j = 0; j < GMS_VAL_MAX; j++)
-                    if (mx_arr_values[j])
-                        mxFree(col_nnz[j]);
+            case GT_FORMAT_SPARSETENSOR:
+                for (size_t j = 0; j < nrecs; j++)
+                {
+                    /* decode linear (column-major) index */
+                    if (mx_index[j] < 1)
+                        mexErrMsgIdAndTxt(ERRID"gdxDataWrite", "Symbol '%s' has "
+                            "invalid tensor index: %d.", name, (int) mx_index[j]);
+                    idx = (mwIndex) mx_index[j] - 1;
+                    for (size_t k = 0; k < dim; k++)
+                    {
+                        if (sizes[k] == 0 || idx % sizes[k] >= domain_uel_size[k])
+                            mexErrMsgIdAndTxt(ERRID"gdxDataWrite", "Symbol '%s' has "
+                                "unregistered UEL.", name);
+                        gdx_uel_index[k] = domain_uel_ids[k][idx % sizes[k]];
+                        idx /= sizes[k];
+                    }
+                    if (idx > 0)
+                        mexErrMsgIdAndTxt(ERRID"gdxDataWrite", "Symbol '%s' has "
+                            "tensor index out of shape.", name);
+
+                    /* sorted records must be in row-major (GDX) order */
+                    if (issorted && j > 0)
+                    {
+                        size_t k = 0;
+                        while (k < dim && gdx_uel_index[k] == last_uel_index[k])
+                            k++;
+                        if (k == dim || gdx_uel_index[k] < last_uel_index[k])
+                            mexErrMsgIdAndTxt(ERRID"gdxDataWrite", "Symbol '%s' has tensor records "
+                                "not sorted in row-major order (required if 'sorted' is true).", name);
+                    }
+                    for (size_t k = 0; k < dim; k++)
+                        last_uel_index[k] = gdx_uel_index[k];
+
+                    for (size_t k = 0; k < GMS_VAL_MAX; k++)
+                    {
+                        if (mx_arr_values[k])
+                            gdx_values[k] = gt_utils_sv_matlab2gams(mx_values[k][j], eps_to_zero);
+                        else
+                            gdx_values[k] = def_values[k];
+                    }
+
+                    if (issorted)
+                    {
+                        if (!gdxDataWriteRaw(gdx, gdx_uel_index, gdx_values))
+                            gt_gdx_write_record_error(gdx, name, dim, gdx_uel_index);
+                    }
+                    else
+                    {
+                        if (!gdxDataWriteMap(gdx, gdx_uel_index, gdx_values))
+                            gt_gdx_write_record_error(gdx, name, dim, gdx_uel_index);
+                    }
+                }
                 break;
 
             default:
@@ -556,18 +708,23 @@ void mexFunction(
             gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
             mexErrMsgIdAndTxt(ERRID"gdxError", "GDX error for %s: %s", name, buf);
         }
-
-        mxFree(mx_arr_domains);
-        mxFree(mx_domains);
-        for (size_t j = 0; j < dim; j++)
-            mxFree(domain_uel_ids[j]);
-        mxFree(domain_uel_size);
-        mxFree(domain_uel_ids);
     }
+    gt_mex_profile_add(mx_arr_profile, name, &profile);
+    gt_arena_free(&scratch);
 
     if (compress)
         gdxAutoConvert(gdx, 0);
 
     gdxClose(gdx);
     gdxFree(&gdx);
+
+    if (gdx_src)
+    {
+        for (int i = 0; i <= src_uel_count; i++)
+            if (src_uel_labels[i])
+                mxFree(src_uel_labels[i]);
+        mxFree(src_uel_labels);
+        gdxClose(gdx_src);
+        gdxFree(&gdx_src);
+    }
 }
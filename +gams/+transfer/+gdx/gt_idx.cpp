@@ -71,7 +71,7 @@ struct idxRec {
   int currSymDims[GMS_MAX_INDEX_DIM];
   int *i2gSymMap;
   int *g2iSymMap;
-  int currNRecs;
+  idxCount_t currNRecs;
   int currSymDim;
   int currSymIdx;
   int writeState;
@@ -361,7 +361,7 @@ idxClose (idxHandle_t ih)
  */
 static int
 getSymInfo (idxHandle_t ih, int gSym, shortStringBuf_t symName,
-            int *symDim, int dims[], int *nNZ, char text[], int textSiz,
+            int *symDim, int dims[], idxCount_t *nNZ, char text[], int textSiz,
             int *isIndexed)
 {
   int iDim, symType, rc, i;
@@ -452,7 +452,7 @@ idxGetSymCount (idxHandle_t ih, int *symCount)
 int
 idxGetSymbolInfo (idxHandle_t ih, int iSym, char symName[], int symNameSiz,
                   int *symDim, int dims[GMS_MAX_INDEX_DIM],
-                  int *nNZ, char explText[], int explTextSiz)
+                  idxCount_t *nNZ, char explText[], int explTextSiz)
 {
   shortStringBuf_t sName;
   int gSym;                     /* index in GDX space */
@@ -487,7 +487,7 @@ idxGetSymbolInfo (idxHandle_t ih, int iSym, char symName[], int symNameSiz,
 int
 idxGetSymbolInfoByName (idxHandle_t ih, const char symName[], int *iSym,
                   int *symDim, int dims[GMS_MAX_INDEX_DIM],
-                  int *nNZ, char explText[], int explTextSiz)
+                  idxCount_t *nNZ, char explText[], int explTextSiz)
 {
   shortStringBuf_t sName;
   int gSym;                     /* index in GDX space */
@@ -549,10 +549,11 @@ idxSetIndexBase (idxHandle_t ih, int indexBase)
  */
 int
 idxDataReadStart (idxHandle_t ih, const char symName[], int *symDim,
-                  int dims[GMS_MAX_INDEX_DIM], int *nRecs,
+                  int dims[GMS_MAX_INDEX_DIM], idxCount_t *nRecs,
                   char errMsg[], int errMsgSize)
 {
   int rc;
+  int nGdxRecs;                 /* GDX reports record counts as int */
   int symIdx;
   int iDim, symType;
   int i;
@@ -607,10 +608,10 @@ idxDataReadStart (idxHandle_t ih, const char symName[], int *symDim,
       ih->currSymDims[iDim] = dims[iDim] = i;
     }
   }
-  rc = gdxDataReadRawStart (ih->h, symIdx, nRecs);
+  rc = gdxDataReadRawStart (ih->h, symIdx, &nGdxRecs);
   if (! rc)
     return getLastErrorMessage (ih->h, errMsg, errMsgSize, 0);
-  ih->currNRecs = *nRecs;
+  ih->currNRecs = *nRecs = nGdxRecs;
   ih->currSymDim = *symDim;
   ih->currSymIdx = symIdx;
   return 1;                     /* OK */
@@ -650,65 +651,80 @@ idxDataReadDone (idxHandle_t ih)
   return rc;
 } /* idxDataReadDone */
 
-/* idxDataReadSparseColMajor: read a 2-d array into
+/* idxDataReadSparseColMajor: read a (at most) 2-d array into
  * sparse column-major storage,
  * returning colPtr[n+1], rowIdx[nnz], vals[nnz]
+ * GDX is passed only once: nonzero records are buffered and then scattered
+ * into their columns. Since GDX delivers records in row-major order, row
+ * indices are sorted within each column. Zero records are skipped and
+ * missing dims (symDim < 2) are treated as singletons.
  * return 1 on success, 0 on failure
  */
 int
-idxDataReadSparseColMajor (idxHandle_t ih, int idxBase,
-                           int colPtr[], int rowIdx[], double vals[])
+idxDataReadSparseColMajor (idxHandle_t ih, int idxBase, idxIndex_t colPtr[],
+                           idxIndex_t rowIdx[], double vals[])
 {
-  int *tp;                      /* counts/ptrs to cols */
+  idxIndex_t *tp;               /* counts/ptrs to cols */
+  idxIndex_t *ti, *tj;          /* buffered row/col indices */
+  double *tv;                   /* buffered values */
   gdxValues_t values;
-  int n;
-  int i, j, k, dummy;
-  int iRecs, rc;
+  idxIndex_t m, n, nnz;
+  idxIndex_t i, j, k;
+  idxCount_t iRecs;
+  int dummy, rc;
   int keys[GMS_MAX_INDEX_DIM];
 
-  if (2!=ih->currSymDim) {
+  if (ih->currSymDim > 2) {
     (void) setError (ih, IDXERR_NOT2D);
     return 0;
   }
-  n = ih->currSymDims[1];
-  tp = (int *) malloc ( n*sizeof(int));
-  HACKASSERT(tp);
-  (void) memset (tp, 0, n*sizeof(int));
+  m = (ih->currSymDim > 0) ? ih->currSymDims[0] : 1;
+  n = (ih->currSymDim > 1) ? ih->currSymDims[1] : 1;
+  keys[0] = keys[1] = 1;
 
-  /* first trip through: compute col counts */
-  for (iRecs = 0;  iRecs < ih->currNRecs;  iRecs++) {
-    (void) gdxDataReadRaw (ih->h, keys, values, &dummy);
+  tp = (idxIndex_t *) calloc (n+1, sizeof(idxIndex_t));
+  HACKASSERT(tp);
+  k = (ih->currNRecs > 0) ? ih->currNRecs : 1;
+  ti = (idxIndex_t *) malloc (k*sizeof(idxIndex_t));
+  tj = (idxIndex_t *) malloc (k*sizeof(idxIndex_t));
+  tv = (double *) malloc (k*sizeof(double));
+  HACKASSERT(ti && tj && tv);
+
+  /* only trip through: buffer nonzeros and compute col counts */
+  for (nnz = 0, iRecs = 0;  iRecs < ih->currNRecs;  iRecs++) {
+    rc = gdxDataReadRaw (ih->h, keys, values, &dummy);
+    HACKASSERT(rc);
+    if (0 == values[0])
+      continue;
+    i = keys[0]-1;
     j = keys[1]-1;
+    GOODASSERT(i < m);
+    GOODASSERT(j < n);
+    ti[nnz] = i;
+    tj[nnz] = j;
+    tv[nnz] = values[0];
     tp[j]++;
-  } /* counting loop */
-  if (! gdxDataReadDone (ih->h))
-    return 0;
-  if (! gdxDataReadRawStart (ih->h, ih->currSymIdx, &dummy))
-    return 0;
-  GOODASSERT(dummy==ih->currNRecs);
+    nnz++;
+  } /* buffering loop */
 
   for (k = 0, j = 0;  j < n;  j++) {
-    colPtr[j] = k;              /* 0-based for now */
+    colPtr[j] = k + idxBase;
     k += tp[j];
-    tp[j] = colPtr[j];
+    tp[j] = colPtr[j] - idxBase;
   }
-  colPtr[j] = k;
+  colPtr[j] = k + idxBase;
+  GOODASSERT(k == nnz);
 
-  for (iRecs = 0;  iRecs < ih->currNRecs;  iRecs++) {
-    (void) gdxDataReadRaw (ih->h, keys, values, &dummy);
-    i = keys[0]-1;
-    j = keys[1]-1;
-    k = tp[j];
-    rowIdx[k] = i + idxBase;
-    vals[k] = values[0];
+  for (k = 0;  k < nnz;  k++) {
+    j = tj[k];
+    rowIdx[tp[j]] = ti[k] + idxBase;
+    vals[tp[j]] = tv[k];
     tp[j]++;
   } /* data transfer loop */
 
-  for (j = 0;  j < n;  j++) {
-    GOODASSERT(colPtr[j+1] == tp[j]);
-    colPtr[j] += idxBase;
-  }
-  colPtr[j] += idxBase;
+  free(tv);
+  free(tj);
+  free(ti);
   free(tp);
   rc = idxDataReadDone (ih);
   return rc;
@@ -719,13 +735,14 @@ idxDataReadSparseColMajor (idxHandle_t ih, int idxBase,
  * return: 1 if OK, 0 if error
  */
 int
-idxDataReadSparseRowMajor (idxHandle_t ih, int idxBase,
-                           int rowPtr[], int colIdx[], double vals[])
+idxDataReadSparseRowMajor (idxHandle_t ih, int idxBase, idxIndex_t rowPtr[],
+                           idxIndex_t colIdx[], double vals[])
 {
   gdxValues_t values;
-  int i, iNext;                 /* both 0-based */
-  int j, k, m, dummy;
-  int iRecs;
+  idxIndex_t i, iNext;          /* both 0-based */
+  idxIndex_t j, k, m;
+  int dummy;
+  idxCount_t iRecs;
   int keys[GMS_MAX_INDEX_DIM];
 
   if (2!=ih->currSymDim) {
@@ -756,7 +773,7 @@ idxDataReadSparseRowMajor (idxHandle_t ih, int idxBase,
     vals[k] = values[0];
     k++;
   }
-  GOODASSERT(k==ih->currNRecs);
+  GOODASSERT(k==(idxIndex_t)ih->currNRecs);
   GOODASSERT(iNext <= m);
   for ( ;  iNext <= m;  iNext++)
     rowPtr[iNext] = k + idxBase;
@@ -771,23 +788,21 @@ idxDataReadSparseRowMajor (idxHandle_t ih, int idxBase,
 int
 idxDataReadDenseColMajor (idxHandle_t ih, double vals[])
 {
-  double dNNZ;
   gdxValues_t values;
-  int iDim, iRecs, dummy, rc;
-  int k;
+  idxCount_t iRecs;
+  int iDim, dummy, rc;
+  size_t k;
   int symDim = ih->currSymDim;
   int keys[GMS_MAX_INDEX_DIM];
 
   if (0 == symDim) {
-    if (! gdxDataReadRaw (ih->h, keys, values, &dummy))
-      return 0;
-    *vals = values[0];
+    if (ih->currNRecs > 0) {
+      if (! gdxDataReadRaw (ih->h, keys, values, &dummy))
+        return 0;
+      *vals = values[0];
+    }
   }
   else {
-    for (dNNZ = 1.0, iDim = 0;  iDim < symDim;  iDim++)
-      dNNZ *= ih->currSymDims[iDim];
-    HACKASSERT (dNNZ <= INT_MAX);
-
     for (iRecs = 0;  iRecs < ih->currNRecs;  iRecs++) {
       rc = gdxDataReadRaw (ih->h, keys, values, &dummy);
       HACKASSERT(rc);
@@ -808,23 +823,21 @@ idxDataReadDenseColMajor (idxHandle_t ih, double vals[])
 int
 idxDataReadDenseRowMajor (idxHandle_t ih, double vals[])
 {
-  double dNNZ;
   gdxValues_t values;
-  int iDim, iRecs, dummy, rc;
-  int k;
+  idxCount_t iRecs;
+  int iDim, dummy, rc;
+  size_t k;
   int symDim = ih->currSymDim;
   int keys[GMS_MAX_INDEX_DIM];
 
   if (0 == symDim) {
-    rc = gdxDataReadRaw (ih->h, keys, values, &dummy);
-    HACKASSERT(rc);
-    *vals = values[0];
+    if (ih->currNRecs > 0) {
+      rc = gdxDataReadRaw (ih->h, keys, values, &dummy);
+      HACKASSERT(rc);
+      *vals = values[0];
+    }
   }
   else {
-    for (dNNZ = 1.0, iDim = 0;  iDim < symDim;  iDim++)
-      dNNZ *= ih->currSymDims[iDim];
-    HACKASSERT (dNNZ <= INT_MAX);
-
     for (iRecs = 0;  iRecs < ih->currNRecs;  iRecs++) {
       rc = gdxDataReadRaw (ih->h, keys, values, &dummy);
       HACKASSERT(rc);
@@ -976,65 +989,86 @@ idxDataWriteDone (idxHandle_t ih)
   return rc;
 } /* idxDataWriteDone */
 
-/* idxDataWriteSparseColMajor: write a 2-d array from sparse col-major storage
- * colPtr[n+1], rowIdx[nnz], vals[nnz]
+/* idxDataWriteSparseColMajor: write a (at most) 2-d array from sparse
+ * col-major storage colPtr[n+1], rowIdx[nnz], vals[nnz]
+ * the nonzeros are transposed to row-major order with a counting sort, so
+ * they can be written in raw mode without GDX sorting the records.
+ * zero values are skipped.
  * return: 1 if OK, 0 if error
  */
 int
-idxDataWriteSparseColMajor (idxHandle_t ih, const int colPtr[],
-                            const int rowIdx[], const double vals[])
+idxDataWriteSparseColMajor (idxHandle_t ih, const idxIndex_t colPtr[],
+                            const idxIndex_t rowIdx[], const double vals[])
 {
-  int idxBase;
-  int MM;                       /* max indices we'll see */
-  int j, k, m, n, rc;
+  idxIndex_t idxBase;
+  idxIndex_t *rp;               /* counts/ptrs to rows */
+  idxIndex_t *tj;               /* col index of nonzeros in row-major order */
+  idxIndex_t *tk;               /* position of nonzeros in input arrays */
+  idxIndex_t i, j, k, m, n, nnz, p;
+  int iDim, rc;
   int keys[GMS_MAX_INDEX_DIM];
   gdxValues_t values;
-  shortStringBuf_t buf;
 
   HACKASSERT (prestart == ih->writeState);
-
-  idxBase = colPtr[0];
-  HACKASSERT((0==idxBase) || (1==idxBase));
-#if 0
-  HACKASSERT(2==ih->currSymDim);
-#else
-  /* if currSymDim > 2, we just use 1 for dims following the second */
-  /* if you want to write with currSymDim < 2, do not use this call */
-  HACKASSERT(ih->currSymDim >= 2);
-#endif
-  m = ih->currSymDims[0];
-  n = ih->currSymDims[1];
-  MM = (n > m) ? n : m;
-  rc = gdxUELRegisterMapStart (ih->h);
-  HACKASSERT(rc);
-  for (k = 1;  k <= MM;  k++) {
-    sprintf (buf, "%d", k);
-    rc = gdxUELRegisterMap (ih->h, k, buf);
-    HACKASSERT(rc);
-  }
-  rc = gdxUELRegisterDone (ih->h);
-  HACKASSERT(rc);
-
-  rc = gdxDataWriteMapStart (ih->h, ih->symName, ih->explTxt, ih->currSymDim, dt_par, 0);
+  rc = gdxDataWriteRawStart (ih->h, ih->symName, ih->explTxt, ih->currSymDim, dt_par, 0);
   HACKASSERT(rc);
   rc = gdxFindSymbol (ih->h, ih->symName, &(ih->currSymIdx));
   HACKASSERT(rc);
   rc = gdxSymbolSetDomainX (ih->h, ih->currSymIdx, (const char **) ih->domPtrs);
   HACKASSERT(rc);
 
-  for (k = 2;  k < ih->currSymDim;  k++)
-    keys[k] = 1;
+  idxBase = colPtr[0];
+  HACKASSERT((0==idxBase) || (1==idxBase));
+  /* if currSymDim > 2, we just use 1 for dims following the second */
+  /* if currSymDim < 2, the missing dims are treated as singletons */
+  m = (ih->currSymDim > 0) ? ih->currSymDims[0] : 1;
+  n = (ih->currSymDim > 1) ? ih->currSymDims[1] : 1;
+  nnz = colPtr[n] - idxBase;
+
+  for (iDim = 0;  iDim < GMS_MAX_INDEX_DIM;  iDim++)
+    keys[iDim] = 1;
+
+  rp = (idxIndex_t *) calloc (m+1, sizeof(idxIndex_t));
+  tj = (idxIndex_t *) malloc ((nnz > 0 ? nnz : 1) * sizeof(idxIndex_t));
+  tk = (idxIndex_t *) malloc ((nnz > 0 ? nnz : 1) * sizeof(idxIndex_t));
+  HACKASSERT(rp && tj && tk);
+
+  /* row counts, shifted by one to get row pointers from the prefix sum */
+  for (k = 0;  k < nnz;  k++) {
+    i = rowIdx[k] - idxBase;
+    HACKASSERT(i < m);
+    rp[i+1]++;
+  }
+  for (i = 0;  i < m;  i++)
+    rp[i+1] += rp[i];
 
+  /* scatter: traversing cols in order keeps the cols sorted within rows */
   for (j = 0;  j < n;  j++) {
-    keys[1] = j+1;
     for (k = colPtr[j]-idxBase;  k < colPtr[j+1]-idxBase;  k++) {
-      keys[0] = rowIdx[k] + 1 - idxBase;
-      HACKASSERT(keys[0] <= m);
-      values[0] = specCheck (ih,  vals[k]);
-      rc = gdxDataWriteMap (ih->h, keys, values);
+      p = rp[rowIdx[k]-idxBase]++;
+      tj[p] = j;
+      tk[p] = k;
+    }
+  }
+
+  /* rp[i] now points to the end of row i */
+  for (p = 0, i = 0;  i < m;  i++) {
+    keys[0] = (int) i+1;
+    for ( ;  p < rp[i];  p++) {
+      if (0 == vals[tk[p]])
+        continue;
+      keys[1] = (int) tj[p]+1;
+      values[0] = specCheck (ih,  vals[tk[p]]);
+      rc = gdxDataWriteRaw (ih->h, keys, values);
       HACKASSERT(rc);
     }
   }
+  GOODASSERT(p == nnz);
+
+  free(tk);
+  free(tj);
+  free(rp);
+
   rc = gdxDataWriteDone (ih->h);
   HACKASSERT(rc);
   ih->writeState = done;
@@ -1048,11 +1082,12 @@ idxDataWriteSparseColMajor (idxHandle_t ih, const int colPtr[],
  * return: 1 if OK, 0 if error
  */
 int
-idxDataWriteSparseRowMajor (idxHandle_t ih, const int rowPtr[],
-                            const int colIdx[], const double vals[])
+idxDataWriteSparseRowMajor (idxHandle_t ih, const idxIndex_t rowPtr[],
+                            const idxIndex_t colIdx[], const double vals[])
 {
-  int idxBase;
-  int i, k, m, n, rc;
+  idxIndex_t idxBase;
+  idxIndex_t i, k, m, n;
+  int iDim, rc;
   int keys[GMS_MAX_INDEX_DIM];
   gdxValues_t values;
 
@@ -1076,14 +1111,14 @@ idxDataWriteSparseRowMajor (idxHandle_t ih, const int rowPtr[],
   m = ih->currSymDims[0];
   n = ih->currSymDims[1];
 
-  for (k = 2;  k < ih->currSymDim;  k++)
-    keys[k] = 1;
+  for (iDim = 2;  iDim < ih->currSymDim;  iDim++)
+    keys[iDim] = 1;
 
   for (i = 0;  i < m;  i++) {
-    keys[0] = i+1;
+    keys[0] = (int) i+1;
     for (k = rowPtr[i]-idxBase;  k < rowPtr[i+1]-idxBase;  k++) {
-      keys[1] = colIdx[k] + 1 - idxBase;
-      HACKASSERT(keys[1] <= n);
+      HACKASSERT(colIdx[k] - idxBase < n);
+      keys[1] = (int) (colIdx[k] + 1 - idxBase);
       values[0] = specCheck (ih,  vals[k]);
       rc = gdxDataWriteRaw (ih->h, keys, values);
       HACKASSERT(rc);
@@ -1097,17 +1132,19 @@ idxDataWriteSparseRowMajor (idxHandle_t ih, const int rowPtr[],
   return rc;
 } /* idxDataWriteSparseRowMajor */
 
-/* return: 1 for OK, 0 for error */
+/* idxDataWriteDenseColMajor: write an array from dense column-major storage
+ * the keys are traversed in row-major order while the matching column-major
+ * offset is updated incrementally, so the records can be written in raw mode
+ * without GDX sorting them
+ * return: 1 for OK, 0 for error
+ */
 int
 idxDataWriteDenseColMajor (idxHandle_t ih, int dataDim, const double vals[])
 {
-  double dNNZ;
   gdxValues_t values;
-  const double *v = vals;
-  shortStringBuf_t buf;
-  int k;
-  int iDim, nnz, rc;
-  int MM;                       /* max indices we'll see */
+  size_t k, nnz, off;
+  size_t strides[GMS_MAX_INDEX_DIM];
+  int iDim, rc;
   int symDim = ih->currSymDim;
   int keys[GMS_MAX_INDEX_DIM];
 
@@ -1122,64 +1159,44 @@ idxDataWriteDenseColMajor (idxHandle_t ih, int dataDim, const double vals[])
   for (iDim = 0;  iDim < symDim;  iDim++)
     keys[iDim] = 1;
 
+  HACKASSERT (prestart == ih->writeState);
+  rc = gdxDataWriteRawStart (ih->h, ih->symName, ih->explTxt, ih->currSymDim, dt_par, 0);
+  HACKASSERT(rc);
+  rc = gdxFindSymbol (ih->h, ih->symName, &(ih->currSymIdx));
+  HACKASSERT(rc);
+  rc = gdxSymbolSetDomainX (ih->h, ih->currSymIdx, (const char **) ih->domPtrs);
+  HACKASSERT(rc);
+
   if (0 == dataDim) {
-    HACKASSERT (prestart == ih->writeState);
-    rc = gdxDataWriteRawStart (ih->h, ih->symName, ih->explTxt, ih->currSymDim, dt_par, 0);
-    HACKASSERT(rc);
-    rc = gdxFindSymbol (ih->h, ih->symName, &(ih->currSymIdx));
-    HACKASSERT(rc);
-    rc = gdxSymbolSetDomainX (ih->h, ih->currSymIdx, (const char **) ih->domPtrs);
-    HACKASSERT(rc);
     values[0] = specCheck (ih,  *vals);
     rc = gdxDataWriteRaw (ih->h, keys, values);
     HACKASSERT(rc);
   }
   else {
-    for (dNNZ = 1.0, iDim = 0;  iDim < dataDim;  iDim++)
-      dNNZ *= ih->currSymDims[iDim];
-    HACKASSERT (dNNZ <= INT_MAX);
-
-    nnz = (int) dNNZ;
-    for (MM = 1, iDim = 0;  iDim < dataDim;  iDim++) {
-      if (ih->currSymDims[iDim] > MM)
-        MM = ih->currSymDims[iDim];
+    for (nnz = 1, iDim = 0;  iDim < dataDim;  iDim++) {
+      strides[iDim] = nnz;
+      nnz *= ih->currSymDims[iDim];
     }
-    rc = gdxUELRegisterMapStart (ih->h);
-    HACKASSERT(rc);
-    for (k = 1;  k <= MM;  k++) {
-      sprintf (buf, "%d", k);
-      rc = gdxUELRegisterMap (ih->h, k, buf);
-      HACKASSERT(rc);
-    }
-    rc = gdxUELRegisterDone (ih->h);
-    HACKASSERT(rc);
 
-    HACKASSERT (prestart == ih->writeState);
-    rc = gdxDataWriteMapStart (ih->h, ih->symName, ih->explTxt, ih->currSymDim, dt_par, 0);
-    HACKASSERT(rc);
-    rc = gdxFindSymbol (ih->h, ih->symName, &(ih->currSymIdx));
-    HACKASSERT(rc);
-    rc = gdxSymbolSetDomainX (ih->h, ih->currSymIdx, (const char **) ih->domPtrs);
-    HACKASSERT(rc);
-
-    for (k = 0;  k < nnz;  k++) {
-      if (0 != *v) {
-        values[0] = specCheck (ih,  *v);
-        rc = gdxDataWriteMap (ih->h, keys, values);
+    for (off = 0, k = 0;  k < nnz;  k++) {
+      if (0 != vals[off]) {
+        values[0] = specCheck (ih,  vals[off]);
+        rc = gdxDataWriteRaw (ih->h, keys, values);
         HACKASSERT(rc);
       }
-      v++;
-      for (iDim = 0;  iDim < dataDim;  iDim++) {
+      for (iDim = dataDim-1;  iDim >= 0;  iDim--) {
         keys[iDim]++;
+        off += strides[iDim];
         if (keys[iDim] > ih->currSymDims[iDim]) {
           keys[iDim] = 1;
+          off -= strides[iDim] * ih->currSymDims[iDim];
         }
         else {
           break;
         }
       }
     }
-    GOODASSERT(nnz==(v-vals));
+    GOODASSERT(0==off);
     for (iDim = 0;  iDim < symDim;  iDim++)
       GOODASSERT(1==keys[iDim]);
   } /* dataDim > 0 */
@@ -1196,11 +1213,10 @@ idxDataWriteDenseColMajor (idxHandle_t ih, int dataDim, const double vals[])
 int
 idxDataWriteDenseRowMajor (idxHandle_t ih, int dataDim, const double vals[])
 {
-  double dNNZ;
   gdxValues_t values;
   const double *v = vals;
-  int k;
-  int iDim, nnz, rc;
+  size_t k, nnz;
+  int iDim, rc;
   int symDim = ih->currSymDim;
   int keys[GMS_MAX_INDEX_DIM];
 
@@ -1229,11 +1245,9 @@ idxDataWriteDenseRowMajor (idxHandle_t ih, int dataDim, const double vals[])
     HACKASSERT(rc);
   }
   else {
-    for (dNNZ = 1.0, iDim = 0;  iDim < dataDim;  iDim++)
-      dNNZ *= ih->currSymDims[iDim];
-    HACKASSERT (dNNZ <= INT_MAX);
+    for (nnz = 1, iDim = 0;  iDim < dataDim;  iDim++)
+      nnz *= ih->currSymDims[iDim];
 
-    nnz = (int) dNNZ;
     for (k = 0;  k < nnz;  k++) {
       if (0 != *v) {
         values[0] = specCheck (ih,  *v);
@@ -1253,7 +1267,7 @@ idxDataWriteDenseRowMajor (idxHandle_t ih, int dataDim, const double vals[])
     }
     for (iDim = 0;  iDim < symDim;  iDim++)
       GOODASSERT(1==keys[iDim]);
-    GOODASSERT(nnz==(v-vals));
+    GOODASSERT(nnz==(size_t)(v-vals));
   } /* symDim > 0 */
 
   rc = gdxDataWriteDone (ih->h);
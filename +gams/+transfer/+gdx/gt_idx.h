@@ -14,10 +14,25 @@
 #endif
 #include "gclgms.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 struct idxRec;
 typedef struct idxRec *idxHandle_t;
 typedef struct idxRec idxRec_t;
 
+/* index type of compressed sparse storage: matches mwIndex of the MEX API,
+ * so colPtr/rowIdx buffers can be handed over without conversion */
+#if defined(MX_COMPAT_32)
+typedef int idxIndex_t;
+#else
+typedef size_t idxIndex_t;
+#endif
+
+/* record count type: 64-bit so that counts and the offsets derived from them
+ * do not overflow for large symbols; signed to keep -1 as "no symbol open" */
+typedef int64_t idxCount_t;
+
 #if defined(__cplusplus)
 extern "C" {
 #endif
@@ -58,7 +73,7 @@ extern "C" {
   int
   idxGetSymbolInfo (idxHandle_t ih, int iSym, char symName[], int symNameSiz,
                     int *symDim, int dims[GMS_MAX_INDEX_DIM],
-                    int *nNZ, char explText[], int explTextSiz);
+                    idxCount_t *nNZ, char explText[], int explTextSiz);
 
   /* idxGetSymbolInfoByName: get information for indexed symbols in GDX
    * return 1 on success, 0 on failure
@@ -66,7 +81,7 @@ extern "C" {
   int
   idxGetSymbolInfoByName (idxHandle_t ih, const char symName[], int *iSym,
                     int *symDim, int dims[GMS_MAX_INDEX_DIM],
-                    int *nNZ, char explText[], int explTextSiz);
+                    idxCount_t *nNZ, char explText[], int explTextSiz);
 
   /* return the indexBase (0 or 1) used, or -1 on error */
   int
@@ -79,7 +94,7 @@ extern "C" {
   /* return: 1 if OK, 0 if error */
   int
   idxDataReadStart (idxHandle_t ih, const char symName[], int *symDim,
-                    int dims[GMS_MAX_INDEX_DIM], int *nRecs,
+                    int dims[GMS_MAX_INDEX_DIM], idxCount_t *nRecs,
                     char errMsg[], int errMsgSize);
 
   /* return: 1 is good, 0 is bad  */
@@ -90,13 +105,16 @@ extern "C" {
   int
   idxDataReadDone (idxHandle_t ih);
 
+  /* return: 1 for OK, 0 for error
+   * zero records are skipped, so rowIdx/vals need room for nRecs entries
+   * and the number of nonzeros is colPtr[n]-idxBase */
   int
-  idxDataReadSparseColMajor (idxHandle_t ih, int idxBase,
-                             int colPtr[], int rowIdx[], double vals[]);
+  idxDataReadSparseColMajor (idxHandle_t ih, int idxBase, idxIndex_t colPtr[],
+                             idxIndex_t rowIdx[], double vals[]);
 
   int
-  idxDataReadSparseRowMajor (idxHandle_t ih, int idxBase,
-                             int rowPtr[], int colIdx[], double vals[]);
+  idxDataReadSparseRowMajor (idxHandle_t ih, int idxBase, idxIndex_t rowPtr[],
+                             idxIndex_t colIdx[], double vals[]);
 
   /* return: 1 for OK, 0 for error */
   int
@@ -120,13 +138,13 @@ extern "C" {
 
   /* return: 1 if OK, 0 if error */
   int
-  idxDataWriteSparseColMajor (idxHandle_t ih, const int colPtr[],
-                              const int rowIdx[], const double vals[]);
+  idxDataWriteSparseColMajor (idxHandle_t ih, const idxIndex_t colPtr[],
+                              const idxIndex_t rowIdx[], const double vals[]);
 
   /* return: 1 if OK, 0 if error */
   int
-  idxDataWriteSparseRowMajor (idxHandle_t ih, const int rowPtr[],
-                              const int colIdx[], const double vals[]);
+  idxDataWriteSparseRowMajor (idxHandle_t ih, const idxIndex_t rowPtr[],
+                              const idxIndex_t colIdx[], const double vals[]);
 
   /* return: 1 for OK, 0 for error */
   int
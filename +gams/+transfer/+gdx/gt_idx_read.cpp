@@ -44,7 +44,8 @@ void mexFunction(
     const mxArray*  prhs[]
 )
 {
-    int format, orig_format, lastdim, ival, ival2, ival3, sym_count, sym_id;
+    int format, orig_format, lastdim, ival, ival3, sym_count, sym_id;
+    idxCount_t nrecs_idx;
     size_t dim, nrecs, nvals, n_dom_fields;
     bool read_records;
     bool values_flag[GMS_VAL_MAX];
@@ -59,10 +60,8 @@ void mexFunction(
     gdxValues_t gdx_values;
     gdxUelIndex_t sizes_int;
     bool* sym_enabled = NULL;
-    mwIndex idx;
-    mwIndex mx_flat_idx[GMS_VAL_MAX];
-    mwIndex mx_idx[GLOBAL_MAX_INDEX_DIM];
-    mwIndex mx_idx_last[GLOBAL_MAX_INDEX_DIM];
+    idxIndex_t* idx_cols = NULL;
+    idxIndex_t* idx_rows = NULL;
     mwSize mx_dom_nrecs[GLOBAL_MAX_INDEX_DIM];
     mwIndex* col_nnz[GMS_VAL_MAX] = {NULL};
     mwIndex* mx_rows[GMS_VAL_MAX] = {NULL};
@@ -78,21 +77,30 @@ void mexFunction(
     mxArray* mx_arr_records = NULL;
     mxArray** mx_arr_dom_idx = NULL;
     mxArray* mx_arr_values[GMS_VAL_MAX] = {NULL};
+    mxArray* mx_arr_profile = NULL;
+    GT_PROFILE profile;
+    GT_ARENA scratch;
 
     GDXSTRINDEXPTRS_INIT(domains, domains_ptr);
 
     /* check input / outputs */
-    gt_mex_check_arguments_num(1, nlhs, 4, nrhs);
+    gt_mex_check_arguments_num_range(1, 2, nlhs, 4, nrhs);
     gt_mex_check_argument_str(prhs, 0, gdx_filename);
     gt_mex_check_argument_cell(prhs, 1);
     gt_mex_check_argument_int(prhs, 2, GT_FILTER_NONE, 1, &orig_format);
     gt_mex_check_argument_bool(prhs, 3, 1, &read_records);
     if (orig_format != GT_FORMAT_STRUCT && orig_format != GT_FORMAT_DENSEMAT &&
-        orig_format != GT_FORMAT_SPARSEMAT && orig_format != GT_FORMAT_TABLE)
+        orig_format != GT_FORMAT_SPARSEMAT && orig_format != GT_FORMAT_TABLE &&
+        orig_format != GT_FORMAT_SPARSETENSOR)
         mexErrMsgIdAndTxt(ERRID"format", "Invalid record format.");
 
-    /* create output data */
+    /* create output data (optional second output: profile) */
     plhs[0] = mxCreateStructMatrix(1, 1, 0, NULL);
+    if (nlhs > 1)
+    {
+        mx_arr_profile = mxCreateStructMatrix(1, 1, 0, NULL);
+        plhs[1] = mx_arr_profile;
+    }
 
     /* start GDX */
     gt_idx_init_read(&gdx, gdx_filename);
@@ -104,6 +112,9 @@ void mexFunction(
 
     sym_enabled = (bool*) mxCalloc(sym_count+1, sizeof(bool));
 
+    /* temporary data of a symbol (released at once for each symbol) */
+    gt_arena_init(&scratch, 64 * 1024, 16 * 1024 * 1024);
+
     /* get symbol ids */
     if (mxGetNumberOfElements(prhs[1]) == 0)
     {
@@ -121,7 +132,7 @@ void mexFunction(
             if (!mxIsChar(mx_arr_symbol_name))
                 mexErrMsgIdAndTxt(ERRID"symbol", "Symbol name must be of type 'char'.");
             mxGetString(mx_arr_symbol_name, buf, GMS_SSSIZE);
-            if (!idxGetSymbolInfoByName(gdx, buf, &ival3, &ival, sizes_int, &ival2, text, GMS_SSSIZE))
+            if (!idxGetSymbolInfoByName(gdx, buf, &ival3, &ival, sizes_int, &nrecs_idx, text, GMS_SSSIZE))
             {
                 mexWarnMsgIdAndTxt(ERRID"symbol", "Symbol %s not found in GDX file. ", buf);
                 continue;
@@ -135,8 +146,12 @@ void mexFunction(
         if (!sym_enabled[i])
             continue;
         sym_id = i;
+        gt_mex_profile_start(&profile, mx_arr_profile != NULL, GT_PHASE_SYMBOL);
 
         /* reset data */
+        gt_arena_reset(&scratch);
+        mx_arr_dom_idx = NULL;
+        mx_dom_idx = NULL;
         for (size_t j = 0; j < GMS_VAL_MAX; j++)
         {
             col_nnz[j] = NULL;
@@ -148,15 +163,15 @@ void mexFunction(
         format = orig_format;
 
         /* read symbol gdx data */
-        if (!idxGetSymbolInfo(gdx, sym_id-1, name, GMS_SSSIZE, &ival, sizes_int, &ival2, text, GMS_SSSIZE))
+        if (!idxGetSymbolInfo(gdx, sym_id-1, name, GMS_SSSIZE, &ival, sizes_int, &nrecs_idx, text, GMS_SSSIZE))
         {
             idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
             mexErrMsgIdAndTxt(ERRID"idxGetSymbolInfo", "GDX error (idxGetSymbolInfo): %s", buf);
         }
         mxAssert(ival >= 0 && ival <= GLOBAL_MAX_INDEX_DIM, "Invalid dimension of symbol.");
-        mxAssert(ival2 >= 0, "Invalid number of records");
+        mxAssert(nrecs_idx >= 0, "Invalid number of records");
         dim = (size_t) ival;
-        nrecs = (size_t) ival2;
+        nrecs = (size_t) nrecs_idx;
         if (format == GT_FORMAT_SPARSEMAT && dim > 2)
             mexErrMsgIdAndTxt(ERRID"format", "Sparse format only supported with dimension <= 2.");
         for (size_t j = 0; j < dim; j++)
@@ -186,10 +201,21 @@ void mexFunction(
             gt_mex_addsymbol(plhs[0], name, text, GMS_DT_PAR, 0, GT_FORMAT_EMPTY,
                 dim, sizes, (const char**) domains_ptr, (const char**) domains_ptr,
                 2, nrecs, 0, NULL, NULL);
+            gt_mex_profile_add(mx_arr_profile, name, &profile);
             continue;
         }
 
+        /* linear tensor indices must be exact in doubles */
+        if (format == GT_FORMAT_SPARSETENSOR)
+        {
+            size_t shape[GLOBAL_MAX_INDEX_DIM];
+            for (size_t j = 0; j < dim; j++)
+                shape[j] = (size_t) mx_dom_nrecs[j];
+            gt_utils_check_tensor_shape(name, dim, shape);
+        }
+
         /* get default values dependent on type */
+        gt_mex_profile_phase(&profile, GT_PHASE_RECORDS);
         gt_utils_type_default_values(GMS_DT_PAR, 0, true, def_values);
 
         /* create format dependent data (e.g. number of nonzeros, domain fields) */
@@ -197,62 +223,48 @@ void mexFunction(
         {
             case GT_FORMAT_STRUCT:
             case GT_FORMAT_TABLE:
-                mx_arr_dom_idx = (mxArray**) mxCalloc(dim, sizeof(*mx_arr_dom_idx));
+                mx_arr_dom_idx = (mxArray**) gt_arena_calloc(&scratch, dim, sizeof(*mx_arr_dom_idx));
 #ifdef WITH_R2018A_OR_NEWER
-                mx_dom_idx = (mxUint64**) mxCalloc(dim, sizeof(*mx_dom_idx));
+                mx_dom_idx = (mxUint64**) gt_arena_calloc(&scratch, dim, sizeof(*mx_dom_idx));
 #else
-                mx_dom_idx = (UINT64_T**) mxCalloc(dim, sizeof(*mx_dom_idx));
+                mx_dom_idx = (UINT64_T**) gt_arena_calloc(&scratch, dim, sizeof(*mx_dom_idx));
 #endif
                 break;
 
-            case GT_FORMAT_SPARSEMAT:
-                for (size_t j = 0; j < GMS_VAL_MAX; j++)
-                    if (values_flag[j])
-                        col_nnz[j] = (mwIndex*) mxCalloc(mx_dom_nrecs[1], sizeof(mwIndex));
-
-                if (!idxDataReadStart(gdx, name, &ival, sizes_int, &ival2, buf, GMS_SSSIZE))
-                {
-                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
-                    mexErrMsgIdAndTxt(ERRID"idxDataReadStart", "GDX error (idxDataReadStart): %s", buf);
-                }
-
-                /* nonzero counts depent on data, thus we need to loop through it */
-                for (size_t j = 0; j < nrecs; j++)
-                {
-                    if (!idxDataRead(gdx, gdx_uel_index, gdx_values, &ival))
-                    {
-                        idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
-                        mexErrMsgIdAndTxt(ERRID"idxDataRead", "GDX error (idxDataRead): %s", buf);
-                    }
-
-                    /* get row and column index */
-                    memset(mx_idx, 0, sizeof(mx_idx));
-                    for (size_t k = 0; k < dim; k++)
-                        mx_idx[k] = gdx_uel_index[k]-1;
-
-                    /* non-zero counts for values except current one */
-                    gt_utils_count_2d_rowmajor_nnz(dim, mx_idx, mx_idx_last, mx_dom_nrecs[0],
-                        mx_dom_nrecs[1], j <= 0, j >= nrecs-1, values_flag, def_values,
-                        gdx_values, col_nnz, NULL, NULL, NULL);
-                }
-
-                if (!idxDataReadDone(gdx))
-                {
-                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
-                    mexErrMsgIdAndTxt(ERRID"idxDataReadDone", "GDX error (idxDataReadDone): %s", buf);
-                }
+            case GT_FORMAT_SPARSETENSOR:
+                mx_arr_dom_idx = (mxArray**) gt_arena_calloc(&scratch, 1, sizeof(*mx_arr_dom_idx));
+#ifdef WITH_R2018A_OR_NEWER
+                mx_dom_idx = (mxUint64**) gt_arena_calloc(&scratch, 1, sizeof(*mx_dom_idx));
+#else
+                mx_dom_idx = (UINT64_T**) gt_arena_calloc(&scratch, 1, sizeof(*mx_dom_idx));
+#endif
                 break;
         }
 
         /* add fields to records / uels and create record data structure */
         gt_mex_readdata_addfields(GMS_DT_PAR, dim, format, values_flag, domains_ptr,
             mx_arr_records, &n_dom_fields);
-        gt_mex_readdata_create(dim, nrecs, format, values_flag, def_values,
-            mx_dom_nrecs, &nvals, col_nnz, mx_arr_dom_idx, mx_dom_idx, mx_arr_values,
-            mx_values, mx_rows, mx_cols);
+        if (format == GT_FORMAT_SPARSEMAT)
+        {
+            /* the number of records bounds the number of nonzeros, so there is no need
+             * for a counting pass (exact nnz is known after reading) */
+            nvals = 0;
+            mx_arr_values[GMS_VAL_LEVEL] = mxCreateSparse(mx_dom_nrecs[0], mx_dom_nrecs[1], nrecs, mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+            mx_values[GMS_VAL_LEVEL] = mxGetDoubles(mx_arr_values[GMS_VAL_LEVEL]);
+#else
+            mx_values[GMS_VAL_LEVEL] = mxGetPr(mx_arr_values[GMS_VAL_LEVEL]);
+#endif
+            mx_rows[GMS_VAL_LEVEL] = mxGetIr(mx_arr_values[GMS_VAL_LEVEL]);
+            mx_cols[GMS_VAL_LEVEL] = mxGetJc(mx_arr_values[GMS_VAL_LEVEL]);
+        }
+        else
+            gt_mex_readdata_create(dim, nrecs, format, values_flag, def_values,
+                mx_dom_nrecs, &nvals, col_nnz, mx_arr_dom_idx, mx_dom_idx, mx_arr_values,
+                mx_values, mx_rows, mx_cols);
 
         /* start reading records */
-        if (!idxDataReadStart(gdx, name, &ival, sizes_int, &ival2, buf, GMS_SSSIZE))
+        if (!idxDataReadStart(gdx, name, &ival, sizes_int, &nrecs_idx, buf, GMS_SSSIZE))
         {
             idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
             mexErrMsgIdAndTxt(ERRID"idxDataReadStart", "GDX error (idxDataReadStart): %s", buf);
@@ -281,76 +293,97 @@ void mexFunction(
                         if (values_flag[k])
                             mx_values[k][j] = gt_utils_sv_gams2matlab(gdx_values[k], 0, NULL);
                 }
+
+                if (!idxDataReadDone(gdx))
+                {
+                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
+                    mexErrMsgIdAndTxt(ERRID"idxDataReadDone", "GDX error (idxDataReadDone): %s", buf);
+                }
                 break;
 
             case GT_FORMAT_DENSEMAT:
-                for (size_t j = 0; j < nrecs; j++)
+                /* reads all records into the column-major buffer and finishes reading */
+                if (!idxDataReadDenseColMajor(gdx, mx_values[GMS_VAL_LEVEL]))
                 {
-                    /* read values */
-                    if (!idxDataRead(gdx, gdx_uel_index, gdx_values, &lastdim))
-                    {
-                        idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
-                        mexErrMsgIdAndTxt(ERRID"idxDataRead", "GDX error (idxDataRead): %s", buf);
-                    }
-
-                    /* get indices in matrix */
-                    for (size_t k = 0; k < dim; k++)
-                        mx_idx[k] = gdx_uel_index[k] - 1;
-
-                    /* parse values */
-                    for (size_t k = 0; k < GMS_VAL_MAX; k++)
-                    {
-                        if (values_flag[k])
-                        {
-                            idx = (dim > 0) ? mxCalcSingleSubscript(mx_arr_values[k], dim, mx_idx) : 0;
-                            mx_values[k][idx] = gt_utils_sv_gams2matlab(gdx_values[k], 0, NULL);
-                        }
-                    }
+                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
+                    mexErrMsgIdAndTxt(ERRID"idxDataReadDenseColMajor", "GDX error (idxDataReadDenseColMajor): %s", buf);
                 }
                 break;
 
             case GT_FORMAT_SPARSEMAT:
-                /* store column counts */
-                for (size_t j = 0; j < mx_dom_nrecs[1]; j++)
-                    for (size_t k = 0; k < GMS_VAL_MAX; k++)
-                        if (values_flag[k])
-                        {
-                            mx_cols[k][j+1] = mx_cols[k][j] + col_nnz[k][j];
-                            col_nnz[k][j] = 0;
-                        }
+                /* fill Matlab's sparse buffers directly if index types agree */
+                if (sizeof(mwIndex) == sizeof(idxIndex_t))
+                {
+                    idx_cols = (idxIndex_t*) mx_cols[GMS_VAL_LEVEL];
+                    idx_rows = (idxIndex_t*) mx_rows[GMS_VAL_LEVEL];
+                }
+                else
+                {
+                    idx_cols = (idxIndex_t*) gt_arena_malloc(&scratch, mx_dom_nrecs[1]+1, sizeof(idxIndex_t));
+                    idx_rows = (idxIndex_t*) gt_arena_malloc(&scratch, MAX(nrecs, 1), sizeof(idxIndex_t));
+                }
 
-                /* read value records */
+                /* reads all records (skipping zeros) and finishes reading */
+                if (!idxDataReadSparseColMajor(gdx, 0, idx_cols, idx_rows, mx_values[GMS_VAL_LEVEL]))
+                {
+                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
+                    mexErrMsgIdAndTxt(ERRID"idxDataReadSparseColMajor", "GDX error (idxDataReadSparseColMajor): %s", buf);
+                }
+                nvals = idx_cols[mx_dom_nrecs[1]];
+
+                if (sizeof(mwIndex) != sizeof(idxIndex_t))
+                {
+                    for (size_t j = 0; j <= mx_dom_nrecs[1]; j++)
+                        mx_cols[GMS_VAL_LEVEL][j] = (mwIndex) idx_cols[j];
+                    for (size_t j = 0; j < nvals; j++)
+                        mx_rows[GMS_VAL_LEVEL][j] = (mwIndex) idx_rows[j];
+                }
+
+                /* release storage of zero records (Matlab requires reallocating Ir and Pr first) */
+                if (nvals < nrecs)
+                {
+                    mxArray* mx_arr = mx_arr_values[GMS_VAL_LEVEL];
+                    mxSetIr(mx_arr, (mwIndex*) mxRealloc(mxGetIr(mx_arr), MAX(nvals, 1) * sizeof(mwIndex)));
+#ifdef WITH_R2018A_OR_NEWER
+                    mxSetDoubles(mx_arr, (mxDouble*) mxRealloc(mxGetDoubles(mx_arr), MAX(nvals, 1) * sizeof(mxDouble)));
+#else
+                    mxSetPr(mx_arr, (double*) mxRealloc(mxGetPr(mx_arr), MAX(nvals, 1) * sizeof(double)));
+#endif
+                    mxSetNzmax(mx_arr, MAX(nvals, 1));
+                }
+                break;
+
+            case GT_FORMAT_SPARSETENSOR:
                 for (size_t j = 0; j < nrecs; j++)
                 {
+                    /* read values */
                     if (!idxDataRead(gdx, gdx_uel_index, gdx_values, &lastdim))
                     {
                         idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
                         mexErrMsgIdAndTxt(ERRID"idxDataRead", "GDX error (idxDataRead): %s", buf);
                     }
 
-                    /* get indices in matrix (row: mx_idx[0]; col: mx_idx[1]) and store domain labels */
-                    memset(mx_idx, 0, sizeof(mx_idx));
-                    for (size_t k = 0; k < dim; k++)
-                        mx_idx[k] = gdx_uel_index[k] - 1;
-
-                    /* update non-zero counts and row indices for values in between and currrent non-zero */
-                    gt_utils_count_2d_rowmajor_nnz(dim, mx_idx, mx_idx_last, mx_dom_nrecs[0],
-                        mx_dom_nrecs[1], j <= 0, j >= nrecs-1, values_flag, def_values,
-                        gdx_values, col_nnz, mx_cols, mx_rows, mx_flat_idx);
+                    /* get linear (column-major) index in tensor */
+                    mx_dom_idx[0][j] = 0;
+                    for (size_t k1 = dim, k; k1 > 0; k1--)
+                    {
+                        k = k1 - 1;
+                        mx_dom_idx[0][j] = mx_dom_idx[0][j] * mx_dom_nrecs[k] + (gdx_uel_index[k] - 1);
+                    }
+                    mx_dom_idx[0][j]++;
 
-                    /* store values */
+                    /* parse values */
                     for (size_t k = 0; k < GMS_VAL_MAX; k++)
-                        if (values_flag[k] && gdx_values[k] != 0.0)
-                            mx_values[k][mx_flat_idx[k]] = gt_utils_sv_gams2matlab(gdx_values[k], 0, NULL);
+                        if (values_flag[k])
+                            mx_values[k][j] = gt_utils_sv_gams2matlab(gdx_values[k], 0, NULL);
                 }
-                break;
-        }
 
-        /* close gdx */
-        if (!idxDataReadDone(gdx))
-        {
-            idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
-            mexErrMsgIdAndTxt(ERRID"idxDataReadDone", "GDX error (idxDataReadDone): %s", buf);
+                if (!idxDataReadDone(gdx))
+                {
+                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
+                    mexErrMsgIdAndTxt(ERRID"idxDataReadDone", "GDX error (idxDataReadDone): %s", buf);
+                }
+                break;
         }
 
         /* set domain fields */
@@ -361,6 +394,10 @@ void mexFunction(
                 for (size_t j = 0; j < dim; j++)
                     mxSetFieldByNumber(mx_arr_records, 0, (int) j, mx_arr_dom_idx[j]);
                 break;
+            case GT_FORMAT_SPARSETENSOR:
+                mxSetFieldByNumber(mx_arr_records, 0, 0, mx_arr_dom_idx[0]);
+                mxSetFieldByNumber(mx_arr_records, 0, 1, gt_mex_tensor_shape(dim, mx_dom_nrecs));
+                break;
         }
 
         /* set value fields */
@@ -369,6 +406,9 @@ void mexFunction(
                 mxSetFieldByNumber(mx_arr_records, 0, (int) (n_dom_fields + k++), mx_arr_values[j]);
 
         /* convert struct to table */
+        gt_mex_profile_phase(&profile, GT_PHASE_TABLE);
+        if (profile.enabled)
+            profile.n_bytes = gt_mex_sizeof(mx_arr_records);
         if (format == GT_FORMAT_TABLE)
             gt_mex_struct2table(&mx_arr_records);
 
@@ -376,25 +416,13 @@ void mexFunction(
         gt_mex_addsymbol(plhs[0], name, text, GMS_DT_PAR, 0, format, dim, sizes,
             (const char**) domains_ptr, (const char**) domains_ptr, 2, nrecs, nvals,
             mx_arr_records, NULL);
-
-        /* free */
-        switch (format)
-        {
-            case GT_FORMAT_STRUCT:
-            case GT_FORMAT_TABLE:
-                mxFree(mx_arr_dom_idx);
-                mxFree(mx_dom_idx);
-                break;
-            case GT_FORMAT_SPARSEMAT:
-                for (size_t i = 0; i < dim; i++)
-                    if (values_flag[i])
-                        mxFree(col_nnz[i]);
-                break;
-        }
+        profile.n_records = nrecs;
+        gt_mex_profile_add(mx_arr_profile, name, &profile);
     }
 
     idxClose(gdx);
     idxFree(&gdx);
 
+    gt_arena_free(&scratch);
     mxFree(sym_enabled);
 }
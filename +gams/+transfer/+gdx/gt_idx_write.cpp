@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
 
 #define ERRID "gams:transfer:cmex:gt_idx_write:"
 
@@ -52,20 +53,23 @@ void mexFunction(
     char* data_name = NULL;
     idxHandle_t gdx = NULL;
     gdxUelIndex_t gdx_uel_index;
+    gdxUelIndex_t last_uel_index;
     gdxValues_t gdx_values;
     int sizes_int[GLOBAL_MAX_INDEX_DIM];
-    mwIndex idx;
-    mwIndex mx_idx[GLOBAL_MAX_INDEX_DIM];
-    mwIndex* mx_rows[GMS_VAL_MAX] = {NULL};
-    mwIndex* mx_cols[GMS_VAL_MAX] = {NULL};
+    size_t nnz, numel;
+    mwIndex* mx_rows = NULL;
+    mwIndex* mx_cols = NULL;
+    idxIndex_t* idx_rows = NULL;
+    idxIndex_t* idx_cols = NULL;
     size_t* idx_sorted = NULL;
-    size_t* col_nnz[GMS_VAL_MAX] = {NULL};
     size_t sizes[GLOBAL_MAX_INDEX_DIM];
 #ifdef WITH_R2018A_OR_NEWER
     mxInt32** mx_domains = NULL;
+    mxUint64* mx_index = NULL;
     mxDouble* mx_values[GMS_VAL_MAX] = {NULL};
 #else
     INT32_T** mx_domains = NULL;
+    UINT64_T* mx_index = NULL;
     double* mx_values[GMS_VAL_MAX] = {NULL};
 #endif
     mxLogical* mx_enable = NULL;
@@ -73,25 +77,37 @@ void mexFunction(
     mxArray* mx_arr_symbol_data = NULL;
     mxArray* mx_arr_symbol_def = NULL;
     mxArray* mx_arr_records = NULL;
+    mxArray* mx_arr_index = NULL;
     mxArray* mx_arr_values[GMS_VAL_MAX] = {NULL};
     mxArray** mx_arr_domains = NULL;
     mxArray* call_plhs[1] = {NULL};
     mxArray* call_prhs[2] = {NULL};
+    mxArray* mx_arr_profile = NULL;
+    GT_PROFILE profile;
+    GT_ARENA scratch;
 
     /* check input / outputs */
-    gt_mex_check_arguments_num(0, nlhs, 6, nrhs);
+    gt_mex_check_arguments_num_range(0, 1, nlhs, 6, nrhs);
     gt_mex_check_argument_str(prhs, 0, gdx_filename);
     gt_mex_check_argument_struct(prhs, 1);
     gt_mex_check_argument_bool(prhs, 3, 1, &issorted);
     gt_mex_check_argument_bool(prhs, 4, 1, &eps_to_zero);
     gt_mex_check_argument_bool(prhs, 5, 1, &support_table);
 
-    /* create output data */
-    plhs = NULL;
+    /* create output data (optional output: profile) */
+    if (nlhs > 0)
+    {
+        mx_arr_profile = mxCreateStructMatrix(1, 1, 0, NULL);
+        plhs[0] = mx_arr_profile;
+    }
+    gt_mex_profile_start(&profile, false, GT_PHASE_NONE);
 
     /* start GDX */
     gt_idx_init_write(&gdx, gdx_filename);
 
+    /* temporary data of a symbol (released at once for each symbol) */
+    gt_arena_init(&scratch, 64 * 1024, 16 * 1024 * 1024);
+
 #ifdef WITH_R2018A_OR_NEWER
     mx_enable = mxGetLogicals(prhs[2]);
 #else
@@ -99,18 +115,20 @@ void mexFunction(
 #endif
     for (int i = 0; i < mxGetNumberOfFields(prhs[1]); i++)
     {
+        /* add profile of previous symbol */
+        gt_mex_profile_add(mx_arr_profile, name, &profile);
+
         if (!mx_enable[i])
             continue;
 
         /* reset pointers */
+        gt_arena_reset(&scratch);
         for (size_t j = 0; j < GMS_VAL_MAX; j++)
         {
-            mx_rows[j] = NULL;
-            mx_cols[j] = NULL;
-            col_nnz[j] = NULL;
             mx_values[j] = NULL;
             mx_arr_values[j] = NULL;
         }
+        mx_arr_index = NULL;
 
         /* get data field */
         mx_arr_symbol = mxGetFieldByNumber(prhs[1], 0, i);
@@ -133,31 +151,35 @@ void mexFunction(
             format = GT_FORMAT_DENSEMAT;
         else if (mxIsClass(mx_arr_symbol_data, "gams.transfer.symbol.data.SparseMatrix"))
             format = GT_FORMAT_SPARSEMAT;
+        else if (mxIsClass(mx_arr_symbol_data, "gams.transfer.symbol.data.SparseTensor"))
+            format = GT_FORMAT_SPARSETENSOR;
         else
             continue;
 
         /* get fields */
         gt_mex_getfield_str(mx_arr_symbol, data_name, "name_", "", true, name, GMS_SSSIZE);
         gt_mex_getfield_str(mx_arr_symbol, data_name, "description_", "", false, text, GMS_SSSIZE);
+        gt_mex_profile_start(&profile, mx_arr_profile != NULL, GT_PHASE_SYMBOL);
 
         dim = mxGetNumberOfElements(mxGetProperty(mx_arr_symbol_def, 0, "domains_"));
         for (size_t j = 0; j < dim; j++)
         {
             call_prhs[0] = mx_arr_symbol;
             call_prhs[1] = mxCreateDoubleScalar(j+1);
-            if (mexCallMATLAB(1, call_plhs, 2, call_prhs, "getAxisLength"))
+            if (gt_mex_callmatlab(1, call_plhs, 2, call_prhs, "getAxisLength"))
                 mexErrMsgIdAndTxt(ERRID"number_records", "Calling 'getAxisLength' failed.");
             sizes[j] = mxGetScalar(call_plhs[0]);
         }
 
-        mx_arr_domains = (mxArray**) mxCalloc(dim, sizeof(*mx_arr_domains));
+        mx_arr_domains = (mxArray**) gt_arena_calloc(&scratch, dim, sizeof(*mx_arr_domains));
 #ifdef WITH_R2018A_OR_NEWER
-        mx_domains = (mxInt32**) mxCalloc(dim, sizeof(*mx_domains));
+        mx_domains = (mxInt32**) gt_arena_calloc(&scratch, dim, sizeof(*mx_domains));
 #else
-        mx_domains = (INT32_T**) mxCalloc(dim, sizeof(*mx_domains));
+        mx_domains = (INT32_T**) gt_arena_calloc(&scratch, dim, sizeof(*mx_domains));
 #endif
 
         /* get optional fields that are format dependent */
+        gt_mex_profile_phase(&profile, GT_PHASE_TABLE);
         if (format != GT_FORMAT_EMPTY)
         {
             if (support_table)
@@ -169,8 +191,15 @@ void mexFunction(
             }
         }
 
+        /* GDX stores domain extents as UEL numbers, hence as int */
+        gt_mex_profile_phase(&profile, GT_PHASE_RECORDS);
         for (size_t j = 0; j < dim; j++)
+        {
+            if (sizes[j] > INT_MAX)
+                mexErrMsgIdAndTxt(ERRID"size", "Symbol %s: Size of dimension %d exceeds "
+                    "maximum of %d.", name, (int) j+1, INT_MAX);
             sizes_int[j] = (int) sizes[j];
+        }
         if (!idxDataWriteStart(gdx, name, text, (int) dim, sizes_int, buf, GMS_SSSIZE))
             mexErrMsgIdAndTxt(ERRID"idxDataWriteStart", "GDX error (idxDataWriteStart): %s", buf);
 
@@ -183,15 +212,23 @@ void mexFunction(
                 idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
                 mexErrMsgIdAndTxt(ERRID"idxDataWriteDone", "GDX error (idxDataWriteDone): %s", buf);
             }
-            mxFree(mx_arr_domains);
-            mxFree(mx_domains);
             continue;
         }
 
         /* get domain and value fields of record field */
+        if (format == GT_FORMAT_SPARSETENSOR)
+            gt_mex_get_tensor_index(data_name, mx_arr_records, &mx_arr_index, &mx_index);
         gt_mex_get_records(data_name, dim, false, mx_arr_records, mx_arr_values,
             mx_values, mx_arr_domains, mx_domains, NULL);
         gt_utils_type_default_values(GMS_DT_PAR, 0, false, def_values);
+        if (profile.enabled)
+        {
+            profile.n_bytes = gt_mex_sizeof(mx_arr_index);
+            for (size_t j = 0; j < dim; j++)
+                profile.n_bytes += gt_mex_sizeof(mx_arr_domains[j]);
+            for (size_t j = 0; j < GMS_VAL_MAX; j++)
+                profile.n_bytes += gt_mex_sizeof(mx_arr_values[j]);
+        }
 
         /* get number of records */
         nrecs = 0;
@@ -218,7 +255,14 @@ void mexFunction(
                         break;
                     }
                 break;
+            case GT_FORMAT_SPARSETENSOR:
+                nrecs = mxGetNumberOfElements(mx_arr_index);
+                have_nrecs = true;
+                if (mx_arr_values[GMS_VAL_LEVEL] && mxGetNumberOfElements(mx_arr_values[GMS_VAL_LEVEL]) != nrecs)
+                    mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has tensor values of invalid size.", name);
+                break;
         }
+        profile.n_records = nrecs;
         if (have_nrecs && nrecs == 0)
         {
             if (!idxDataWriteDone(gdx))
@@ -226,8 +270,6 @@ void mexFunction(
                 idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
                 mexErrMsgIdAndTxt(ERRID"idxDataWriteDone", "GDX error (idxDataWriteDone): %s", buf);
             }
-            mxFree(mx_arr_domains);
-            mxFree(mx_domains);
             continue;
         }
 
@@ -241,7 +283,7 @@ void mexFunction(
                 /* sort data if needed */
                 if (!issorted)
                 {
-                    idx_sorted = (size_t*) mxMalloc(nrecs * sizeof(size_t));
+                    idx_sorted = (size_t*) gt_arena_malloc(&scratch, nrecs, sizeof(size_t));
                     for (size_t j = 0; j < nrecs; j++)
                         idx_sorted[j] = j;
                     gt_utils_sort_domains(name, nrecs, dim, mx_domains, NULL, NULL, idx_sorted);
@@ -273,103 +315,115 @@ void mexFunction(
 
             case GT_FORMAT_DENSEMAT:
                 mxAssert(have_nrecs, "Number of records not available");
+                if (!mx_arr_values[GMS_VAL_LEVEL])
+                    break;
 
-                for (size_t j = 0; j < nrecs; j++)
-                {
-                    bool is_default_rec = true, found_index;
-
-                    /* calculate row-major index */
-                    idx = 0;
-                    found_index = (dim == 0);
-                    for (size_t k1 = dim, d = 1, k; k1 > 0; k1--)
-                    {
-                        k = k1 - 1;
-                        mx_idx[k] = ((int) floor((double) j / (double) d)) % sizes[k];
-                        gdx_uel_index[k] = mx_idx[k] + 1;
-                        d *= sizes[k];
-                    }
-                    for (size_t k = 0; k < GMS_VAL_MAX; k++)
-                        if (mx_arr_values[k])
-                        {
-                            idx = (dim > 0) ? mxCalcSingleSubscript(mx_arr_values[k], dim, mx_idx) : 0;
-                            found_index = true;
-                            break;
-                        }
-                    if (!found_index)
-                        continue;
+                numel = 1;
+                for (size_t j = 0; j < dim; j++)
+                    numel *= sizes[j];
+                if (nrecs != numel)
+                    mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has dense records of invalid size.", name);
 
-                    /* write values */
-                    for (size_t k = 0; k < GMS_VAL_MAX; k++)
-                    {
-                        if (mx_arr_values[k])
-                        {
-                            if (eps_to_zero && gt_utils_iseps(mx_values[k][idx]))
-                                gdx_values[k] = 0.0;
-                            else
-                                gdx_values[k] = mx_values[k][idx];
-                        }
-                        else
-                            gdx_values[k] = def_values[k];
-                        is_default_rec = (gdx_values[k] != def_values[k]) ? false : is_default_rec;
-                    }
-                    if (is_default_rec)
-                        continue;
-                    if (!idxDataWrite(gdx, gdx_uel_index, gdx_values[GMS_VAL_LEVEL]))
-                        gt_idx_write_record_error(gdx, name, dim, gdx_uel_index);
+                /* writes all nonzero values (column-major buffer) and finishes writing */
+                if (!idxDataWriteDenseColMajor(gdx, (int) dim, mx_values[GMS_VAL_LEVEL]))
+                {
+                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
+                    mexErrMsgIdAndTxt(ERRID"idxDataWriteDenseColMajor", "GDX error (idxDataWriteDenseColMajor): %s", buf);
                 }
                 break;
 
             case GT_FORMAT_SPARSEMAT:
                 mxAssert(dim <= 2, "Invalid sparse dimension");
+                if (!mx_arr_values[GMS_VAL_LEVEL])
+                    break;
 
-                /* row / col data access */
-                for (size_t j = 0; j < GMS_VAL_MAX; j++)
+                if (!mxIsSparse(mx_arr_values[GMS_VAL_LEVEL]) ||
+                    mxGetM(mx_arr_values[GMS_VAL_LEVEL]) != sizes[0] ||
+                    mxGetN(mx_arr_values[GMS_VAL_LEVEL]) != sizes[1])
+                    mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has sparse records of invalid size.", name);
+
+                /* pass Matlab's sparse buffers directly if index types agree */
+                mx_rows = mxGetIr(mx_arr_values[GMS_VAL_LEVEL]);
+                mx_cols = mxGetJc(mx_arr_values[GMS_VAL_LEVEL]);
+                nnz = mx_cols[sizes[1]];
+                if (sizeof(mwIndex) == sizeof(idxIndex_t))
+                {
+                    idx_rows = (idxIndex_t*) mx_rows;
+                    idx_cols = (idxIndex_t*) mx_cols;
+                }
+                else
                 {
-                    if (!mx_arr_values[j])
-                        continue;
-                    col_nnz[j] = (size_t*) mxCalloc(sizes[1], sizeof(size_t));
-                    mx_rows[j] = mxGetIr(mx_arr_values[j]);
-                    mx_cols[j] = mxGetJc(mx_arr_values[j]);
+                    idx_rows = (idxIndex_t*) gt_arena_malloc(&scratch, MAX(nnz, 1), sizeof(idxIndex_t));
+                    idx_cols = (idxIndex_t*) gt_arena_malloc(&scratch, sizes[1]+1, sizeof(idxIndex_t));
+                    for (size_t j = 0; j < nnz; j++)
+                        idx_rows[j] = (idxIndex_t) mx_rows[j];
+                    for (size_t j = 0; j <= sizes[1]; j++)
+                        idx_cols[j] = (idxIndex_t) mx_cols[j];
                 }
 
-                for (size_t j = 0; j < sizes[0]; j++)
+                /* writes all nonzero values and finishes writing */
+                if (!idxDataWriteSparseColMajor(gdx, idx_cols, idx_rows, mx_values[GMS_VAL_LEVEL]))
                 {
-                    for (size_t k = 0; k < sizes[1]; k++)
+                    idxErrorStr(gdx, idxGetLastError(gdx), buf, GMS_SSSIZE);
+                    mexErrMsgIdAndTxt(ERRID"idxDataWriteSparseColMajor", "GDX error (idxDataWriteSparseColMajor): %s", buf);
+                }
+                break;
+
+            case GT_FORMAT_SPARSETENSOR:
+                if (!mx_arr_values[GMS_VAL_LEVEL])
+                    break;
+                gt_utils_check_tensor_shape(name, dim, sizes);
+
+                /* sort data (row-major) if needed */
+                if (!issorted)
+                {
+                    idx_sorted = (size_t*) gt_arena_malloc(&scratch, nrecs, sizeof(size_t));
+                    for (size_t j = 0; j < nrecs; j++)
+                        idx_sorted[j] = j;
+                    gt_utils_sort_tensor_index(name, nrecs, dim, sizes, mx_index, idx_sorted);
+                }
+
+                for (size_t j_unsorted = 0, j; j_unsorted < nrecs; j_unsorted++)
+                {
+                    size_t lin;
+
+                    j = (issorted) ? j_unsorted : idx_sorted[j_unsorted];
+
+                    /* decode linear (column-major) index */
+                    if (mx_index[j] < 1)
+                        mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has invalid tensor index.", name);
+                    lin = (size_t) mx_index[j] - 1;
+                    for (size_t k = 0; k < dim; k++)
                     {
-                        /* set domains */
-                        if (dim >= 1)
-                            gdx_uel_index[0] = j+1;
-                        if (dim >= 2)
-                            gdx_uel_index[1] = k+1;
-
-                        /* check if element (j,k) is nonzero and get index in value array */
-                        for (size_t kk = 0; kk < GMS_VAL_MAX; kk++)
-                        {
-                            gdx_values[kk] = def_values[kk];
-                            if (!mx_arr_values[kk])
-                                continue;
-                            idx = mx_cols[kk][k] + col_nnz[kk][k];
-                            if (idx >= mx_cols[kk][k+1] || mx_rows[kk][idx] != j)
-                            {
-                                gdx_values[kk] = 0;
-                                continue;
-                            }
-                            col_nnz[kk][k]++;
-                            if (eps_to_zero && gt_utils_iseps(mx_values[kk][idx]))
-                                gdx_values[kk] = 0.0;
-                            else
-                                gdx_values[kk] = mx_values[kk][idx];
-                        }
+                        if (sizes[k] == 0)
+                            mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has tensor index out of shape.", name);
+                        gdx_uel_index[k] = (int) (lin % sizes[k]) + 1;
+                        lin /= sizes[k];
+                    }
+                    if (lin > 0)
+                        mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has tensor index out of shape.", name);
 
-                        /* write values */
-                        if (!idxDataWrite(gdx, gdx_uel_index, gdx_values[GMS_VAL_LEVEL]))
-                            gt_idx_write_record_error(gdx, name, dim, gdx_uel_index);
+                    /* sorted records must be in row-major (GDX) order */
+                    if (issorted && j_unsorted > 0)
+                    {
+                        size_t k = 0;
+                        while (k < dim && gdx_uel_index[k] == last_uel_index[k])
+                            k++;
+                        if (k == dim || gdx_uel_index[k] < last_uel_index[k])
+                            mexErrMsgIdAndTxt(ERRID"records", "Symbol '%s' has tensor records not sorted "
+                                "in row-major order (required if 'sorted' is true).", name);
                     }
-                }
+                    for (size_t k = 0; k < dim; k++)
+                        last_uel_index[k] = gdx_uel_index[k];
 
-                for (size_t j = 0; j < GMS_VAL_MAX; j++)
-                    if (mx_arr_values[j])
-                        mxFree(col_nnz[j]);
+                    if (eps_to_zero && gt_utils_iseps(mx_values[GMS_VAL_LEVEL][j]))
+                        gdx_values[GMS_VAL_LEVEL] = 0.0;
+                    else
+                        gdx_values[GMS_VAL_LEVEL] = mx_values[GMS_VAL_LEVEL][j];
+
+                    if (!idxDataWrite(gdx, gdx_uel_index, gdx_values[GMS_VAL_LEVEL]))
+                        gt_idx_write_record_error(gdx, name, dim, gdx_uel_index);
+                }
                 break;
 
             default:
@@ -383,9 +437,9 @@ void mexFunction(
             mexErrMsgIdAndTxt(ERRID"idxDataWriteDone", "GDX error (idxDataWriteDone): %s", buf);
         }
 
-        mxFree(mx_arr_domains);
-        mxFree(mx_domains);
     }
+    gt_mex_profile_add(mx_arr_profile, name, &profile);
+    gt_arena_free(&scratch);
 
     idxClose(gdx);
     idxFree(&gdx);
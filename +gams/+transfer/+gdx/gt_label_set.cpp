@@ -0,0 +1,630 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Ordered label set behind a persistent handle
+ *
+ * Labels are stored in insertion order in a contiguous vector and indexed by an
+ * open addressing hash table (linear probing) that maps a label to its position.
+ * Sets live in a registry that persists between calls; the MEX file is locked as
+ * long as any set is alive.
+ *
+ * Usage:
+ *   handle = gt_label_set('create' [, labels])
+ *   handle = gt_label_set('copy', handle)
+ *   handle = gt_label_set('share', handle)
+ *   handle = gt_label_set('unshare', handle [, keep])
+ *   gt_label_set('delete', handle)
+ *   count = gt_label_set('count', handle)
+ *   labels = gt_label_set('get', handle)
+ *   gt_label_set('clear', handle)
+ *   [indices] = gt_label_set('add', handle, labels)
+ *   gt_label_set('set', handle, labels)
+ *   [flag, indices] = gt_label_set('find', handle, labels)
+ *   [flag, indices] = gt_label_set('remove', handle, labels)
+ *   gt_label_set('rename', handle, oldlabels, newlabels)
+ *   [flag, indices] = gt_label_set('merge', handle, oldlabels, newlabels)
+ *
+ * Labels are given as cellstr (or char for a single label). Outputs of remove and
+ * merge map the labels before the operation to their (1-based) index after the
+ * operation.
+ *
+ * Copy on write: share returns the same handle and increases its reference count;
+ * delete decreases it and frees the set with the last reference. Before modifying
+ * a set, callers obtain an exclusive handle with unshare: it returns the handle
+ * itself if not shared and a new handle to a copy (or to an empty set if keep is
+ * false) otherwise.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "mex.h"
+
+#define ERRID "gams:transfer:cmex:gt_label_set:"
+#define OPERATIONS "create, copy, share, unshare, delete, count, get, clear, add, set, find, remove, " \
+    "rename, merge"
+
+typedef std::basic_string<mxChar> gt_label_t;
+
+/** ordered label set */
+typedef struct
+{
+    std::vector<gt_label_t> labels; /** labels in order */
+    std::vector<uint64_t> hashes;   /** hash of each label */
+    std::vector<size_t> table;      /** hash table: position + 1 of label (0: empty) */
+    size_t          n_used;         /** number of used hash table slots */
+    size_t          n_refs;         /** number of references to the set (copy on write) */
+} GT_LABEL_SET;
+
+/** registry of label sets: handle - 1 is the index (NULL: deleted) */
+static std::vector<GT_LABEL_SET*> label_sets;
+static size_t n_label_sets = 0;
+
+static uint64_t gt_label_set_hash(
+    const mxChar*   label,          /** label */
+    size_t          len             /** label length */
+)
+{
+    /* FNV-1a */
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= (uint64_t) label[i];
+        h *= 1099511628211ULL;
+    }
+    return h ^ (h >> 29);
+}
+
+/** rebuilds hash table for all positions */
+static void gt_label_set_rehash(
+    GT_LABEL_SET*   set,            /** label set */
+    size_t          min_size        /** minimal number of labels to be stored */
+)
+{
+    size_t size = 16;
+    while (size < 2 * min_size)
+        size *= 2;
+    set->table.assign(size, 0);
+    set->n_used = 0;
+    size_t mask = size - 1;
+    for (size_t i = 0; i < set->labels.size(); i++)
+    {
+        size_t slot = set->hashes[i] & mask;
+        while (set->table[slot])
+            slot = (slot + 1) & mask;
+        set->table[slot] = i + 1;
+        set->n_used++;
+    }
+}
+
+/** returns position + 1 of label (0: not found) */
+static size_t gt_label_set_find(
+    const GT_LABEL_SET* set,        /** label set */
+    const gt_label_t& label,        /** label */
+    uint64_t        hash,           /** hash of label */
+    const std::vector<bool>* alive  /** positions still in set (NULL: all) */
+)
+{
+    size_t mask = set->table.size() - 1;
+    size_t slot = hash & mask;
+    size_t pos;
+    while ((pos = set->table[slot]) != 0)
+    {
+        if (set->hashes[pos-1] == hash && set->labels[pos-1] == label && (!alive || (*alive)[pos-1]))
+            return pos;
+        slot = (slot + 1) & mask;
+    }
+    return 0;
+}
+
+/** inserts position into hash table; stale slots of renamed or removed labels count as used */
+static void gt_label_set_insert(
+    GT_LABEL_SET*   set,            /** label set */
+    size_t          pos             /** position of label (0-based) */
+)
+{
+    if (2 * (set->n_used + 1) > set->table.size())
+    {
+        gt_label_set_rehash(set, set->labels.size());
+        return;
+    }
+    size_t mask = set->table.size() - 1;
+    size_t slot = set->hashes[pos] & mask;
+    while (set->table[slot])
+        slot = (slot + 1) & mask;
+    set->table[slot] = pos + 1;
+    set->n_used++;
+}
+
+/** appends label if not in set; returns position + 1 of label */
+static size_t gt_label_set_add(
+    GT_LABEL_SET*   set,            /** label set */
+    const gt_label_t& label         /** label */
+)
+{
+    uint64_t hash = gt_label_set_hash(label.data(), label.size());
+    size_t pos = gt_label_set_find(set, label, hash, NULL);
+    if (pos)
+        return pos;
+    set->labels.push_back(label);
+    set->hashes.push_back(hash);
+    gt_label_set_insert(set, set->labels.size() - 1);
+    return set->labels.size();
+}
+
+static void gt_label_set_clear(
+    GT_LABEL_SET*   set             /** label set */
+)
+{
+    set->labels.clear();
+    set->hashes.clear();
+    gt_label_set_rehash(set, 0);
+}
+
+/** removes labels not flagged alive (keeping order); new_pos maps old position to new
+ *  position + 1 (0: removed) */
+static void gt_label_set_compact(
+    GT_LABEL_SET*   set,            /** label set */
+    const std::vector<bool>& alive, /** positions to keep */
+    std::vector<size_t>& new_pos    /** output: position mapping */
+)
+{
+    size_t n = 0;
+    new_pos.assign(set->labels.size(), 0);
+    for (size_t i = 0; i < set->labels.size(); i++)
+    {
+        if (!alive[i])
+            continue;
+        if (n != i)
+        {
+            set->labels[n].swap(set->labels[i]);
+            set->hashes[n] = set->hashes[i];
+        }
+        new_pos[i] = ++n;
+    }
+    set->labels.resize(n);
+    set->hashes.resize(n);
+    gt_label_set_rehash(set, n);
+}
+
+/** returns label from cellstr or char */
+static void gt_label_set_get_label(
+    const mxArray*  mx_arr_labels,  /** labels */
+    size_t          idx,            /** index of label */
+    gt_label_t&     label           /** output: label */
+)
+{
+    const mxArray* mx_arr_label = mxIsCell(mx_arr_labels) ? mxGetCell(mx_arr_labels, idx) : mx_arr_labels;
+    if (!mx_arr_label)
+    {
+        label.clear();
+        return;
+    }
+    label.assign(mxGetChars(mx_arr_label), mxGetNumberOfElements(mx_arr_label));
+}
+
+static void gt_label_set_check_labels(
+    const mxArray*  mx_arr_labels,  /** labels */
+    int             argnum          /** argument number */
+)
+{
+    if (mxIsChar(mx_arr_labels))
+        return;
+    if (!mxIsCell(mx_arr_labels))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument %d has invalid type: need cellstr", argnum);
+    for (size_t i = 0; i < mxGetNumberOfElements(mx_arr_labels); i++)
+    {
+        const mxArray* mx_arr_label = mxGetCell(mx_arr_labels, i);
+        if (mx_arr_label && !mxIsChar(mx_arr_label))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument %d has invalid type: need cellstr", argnum);
+    }
+}
+
+static size_t gt_label_set_numel(
+    const mxArray*  mx_arr_labels   /** labels */
+)
+{
+    return mxIsChar(mx_arr_labels) ? 1 : mxGetNumberOfElements(mx_arr_labels);
+}
+
+static GT_LABEL_SET* gt_label_set_get_handle(
+    const mxArray*  mx_arr_handle   /** handle */
+)
+{
+    if (!mxIsDouble(mx_arr_handle) || mxGetNumberOfElements(mx_arr_handle) != 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need label set handle");
+    double handle = mxGetScalar(mx_arr_handle);
+    if (handle < 1 || handle > label_sets.size() || !label_sets[(size_t) handle - 1])
+        mexErrMsgIdAndTxt(ERRID"handle", "Invalid label set handle.");
+    return label_sets[(size_t) handle - 1];
+}
+
+static mxArray* gt_label_set_new_handle(void)
+{
+    size_t idx = 0;
+    while (idx < label_sets.size() && label_sets[idx])
+        idx++;
+    if (idx == label_sets.size())
+        label_sets.push_back(NULL);
+    label_sets[idx] = new GT_LABEL_SET;
+    label_sets[idx]->n_refs = 1;
+    gt_label_set_rehash(label_sets[idx], 0);
+    if (n_label_sets++ == 0)
+        mexLock();
+    return mxCreateDoubleScalar((double) (idx + 1));
+}
+
+static void gt_label_set_at_exit(void)
+{
+    for (size_t i = 0; i < label_sets.size(); i++)
+        delete label_sets[i];
+    label_sets.clear();
+    n_label_sets = 0;
+}
+
+/** copies labels and hash table */
+static void gt_label_set_copy(
+    GT_LABEL_SET*   set,            /** label set to copy to */
+    const GT_LABEL_SET* from        /** label set to copy from */
+)
+{
+    set->labels = from->labels;
+    set->hashes = from->hashes;
+    set->table = from->table;
+    set->n_used = from->n_used;
+}
+
+/** creates flag and index output of labels before operation (given by new_pos) and
+ *  redirects old labels of (old, new) pairs to new labels */
+static void gt_label_set_create_mapping(
+    const GT_LABEL_SET* set,        /** label set after operation */
+    const std::vector<size_t>& new_pos, /** position mapping of operation */
+    const std::vector<size_t>& old_pos, /** position + 1 of old labels before operation */
+    const mxArray*  mx_arr_newlabels, /** new labels (NULL: none) */
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[]          /** outputs */
+)
+{
+#ifdef WITH_R2018A_OR_NEWER
+    mxDouble* mx_indices = NULL;
+#else
+    double* mx_indices = NULL;
+#endif
+    mxLogical* mx_flag = NULL;
+    gt_label_t label;
+
+    plhs[0] = mxCreateLogicalMatrix(1, new_pos.size());
+    mx_flag = mxGetLogicals(plhs[0]);
+    if (nlhs > 1)
+        plhs[1] = mxCreateDoubleMatrix(1, new_pos.size(), mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+    mx_indices = nlhs > 1 ? mxGetDoubles(plhs[1]) : NULL;
+#else
+    mx_indices = nlhs > 1 ? mxGetPr(plhs[1]) : NULL;
+#endif
+
+    for (size_t i = 0; i < new_pos.size(); i++)
+    {
+        mx_flag[i] = new_pos[i] > 0;
+        if (mx_indices)
+            mx_indices[i] = (double) new_pos[i];
+    }
+    for (size_t i = 0; i < old_pos.size(); i++)
+    {
+        if (!old_pos[i])
+            continue;
+        gt_label_set_get_label(mx_arr_newlabels, i, label);
+        size_t pos = gt_label_set_find(set, label, gt_label_set_hash(label.data(), label.size()), NULL);
+        mx_flag[old_pos[i]-1] = pos > 0;
+        if (mx_indices)
+            mx_indices[old_pos[i]-1] = (double) pos;
+    }
+}
+
+void mexFunction(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    char op[8];
+    size_t n, pos;
+    GT_LABEL_SET* set = NULL;
+    gt_label_t label;
+    std::vector<bool> alive;
+    std::vector<size_t> new_pos, old_pos;
+#ifdef WITH_R2018A_OR_NEWER
+    mxDouble* mx_indices = NULL;
+#else
+    double* mx_indices = NULL;
+#endif
+    mxLogical* mx_flag = NULL;
+
+    mexAtExit(gt_label_set_at_exit);
+
+    /* check input arguments */
+    if (nrhs < 1 || !mxIsChar(prhs[0]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need char");
+    /* over-long names would be truncated to a valid operation otherwise */
+    if (mxGetString(prhs[0], op, sizeof(op)))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 must be one of the following: " OPERATIONS ".");
+
+    if (!strcmp(op, "create"))
+    {
+        if (nrhs > 2)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 1 or 2 required.", nrhs);
+        if (nrhs == 2)
+            gt_label_set_check_labels(prhs[1], 2);
+        plhs[0] = gt_label_set_new_handle();
+        if (nrhs == 2)
+        {
+            set = label_sets[(size_t) mxGetScalar(plhs[0]) - 1];
+            n = gt_label_set_numel(prhs[1]);
+            set->labels.reserve(n);
+            set->hashes.reserve(n);
+            gt_label_set_rehash(set, n);
+            for (size_t i = 0; i < n; i++)
+            {
+                gt_label_set_get_label(prhs[1], i, label);
+                gt_label_set_add(set, label);
+            }
+        }
+        return;
+    }
+
+    if (nrhs < 2)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). At least 2 required.", nrhs);
+    set = gt_label_set_get_handle(prhs[1]);
+
+    if (!strcmp(op, "copy"))
+    {
+        plhs[0] = gt_label_set_new_handle();
+        gt_label_set_copy(label_sets[(size_t) mxGetScalar(plhs[0]) - 1], set);
+    }
+    else if (!strcmp(op, "share"))
+    {
+        set->n_refs++;
+        plhs[0] = mxDuplicateArray(prhs[1]);
+    }
+    else if (!strcmp(op, "unshare"))
+    {
+        if (nrhs > 3 || (nrhs == 3 && (!mxIsLogicalScalar(prhs[2]))))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 3 has invalid type: need logical scalar");
+        if (set->n_refs == 1)
+        {
+            plhs[0] = mxDuplicateArray(prhs[1]);
+            return;
+        }
+        set->n_refs--;
+        plhs[0] = gt_label_set_new_handle();
+        if (nrhs < 3 || mxIsLogicalScalarTrue(prhs[2]))
+            gt_label_set_copy(label_sets[(size_t) mxGetScalar(plhs[0]) - 1], set);
+    }
+    else if (!strcmp(op, "delete"))
+    {
+        if (--set->n_refs > 0)
+            return;
+        delete set;
+        label_sets[(size_t) mxGetScalar(prhs[1]) - 1] = NULL;
+        if (--n_label_sets == 0)
+            mexUnlock();
+    }
+    else if (!strcmp(op, "count"))
+        plhs[0] = mxCreateDoubleScalar((double) set->labels.size());
+    else if (!strcmp(op, "get"))
+    {
+        plhs[0] = mxCreateCellMatrix(1, set->labels.size());
+        for (size_t i = 0; i < set->labels.size(); i++)
+        {
+            mwSize dims[2] = {1, set->labels[i].size()};
+            if (dims[1] == 0)
+                dims[0] = 0;
+            mxArray* mx_arr_label = mxCreateCharArray(2, dims);
+            memcpy(mxGetChars(mx_arr_label), set->labels[i].data(), dims[1] * sizeof(mxChar));
+            mxSetCell(plhs[0], i, mx_arr_label);
+        }
+    }
+    else if (!strcmp(op, "clear"))
+        gt_label_set_clear(set);
+    else if (!strcmp(op, "add") || !strcmp(op, "set"))
+    {
+        if (nrhs != 3)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 3 required.", nrhs);
+        gt_label_set_check_labels(prhs[2], 3);
+        n = gt_label_set_numel(prhs[2]);
+        if (op[0] == 's')
+            gt_label_set_clear(set);
+        if (2 * (set->labels.size() + n) > set->table.size())
+            gt_label_set_rehash(set, set->labels.size() + n);
+        if (nlhs > 0 && op[0] == 'a')
+        {
+            plhs[0] = mxCreateDoubleMatrix(1, n, mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+            mx_indices = mxGetDoubles(plhs[0]);
+#else
+            mx_indices = mxGetPr(plhs[0]);
+#endif
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            gt_label_set_get_label(prhs[2], i, label);
+            pos = gt_label_set_add(set, label);
+            if (mx_indices)
+                mx_indices[i] = (double) pos;
+        }
+    }
+    else if (!strcmp(op, "find"))
+    {
+        if (nrhs != 3)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 3 required.", nrhs);
+        gt_label_set_check_labels(prhs[2], 3);
+        n = gt_label_set_numel(prhs[2]);
+        if (mxIsChar(prhs[2]))
+            plhs[0] = mxCreateLogicalMatrix(1, 1);
+        else
+            plhs[0] = mxCreateLogicalArray(mxGetNumberOfDimensions(prhs[2]), mxGetDimensions(prhs[2]));
+        mx_flag = mxGetLogicals(plhs[0]);
+        if (nlhs > 1)
+        {
+            if (mxIsChar(prhs[2]))
+                plhs[1] = mxCreateDoubleMatrix(1, 1, mxREAL);
+            else
+                plhs[1] = mxCreateNumericArray(mxGetNumberOfDimensions(prhs[2]),
+                    mxGetDimensions(prhs[2]), mxDOUBLE_CLASS, mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+            mx_indices = mxGetDoubles(plhs[1]);
+#else
+            mx_indices = mxGetPr(plhs[1]);
+#endif
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            gt_label_set_get_label(prhs[2], i, label);
+            pos = gt_label_set_find(set, label, gt_label_set_hash(label.data(), label.size()), NULL);
+            mx_flag[i] = pos > 0;
+            if (mx_indices)
+                mx_indices[i] = (double) pos;
+        }
+    }
+    else if (!strcmp(op, "remove"))
+    {
+        if (nrhs != 3)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 3 required.", nrhs);
+        gt_label_set_check_labels(prhs[2], 3);
+        n = gt_label_set_numel(prhs[2]);
+        alive.assign(set->labels.size(), true);
+        for (size_t i = 0; i < n; i++)
+        {
+            gt_label_set_get_label(prhs[2], i, label);
+            pos = gt_label_set_find(set, label, gt_label_set_hash(label.data(), label.size()), NULL);
+            if (pos)
+                alive[pos-1] = false;
+        }
+        gt_label_set_compact(set, alive, new_pos);
+        if (nlhs > 0)
+            gt_label_set_create_mapping(set, new_pos, old_pos, NULL, nlhs, plhs);
+    }
+    else if (!strcmp(op, "rename"))
+    {
+        if (nrhs != 4)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 4 required.", nrhs);
+        gt_label_set_check_labels(prhs[2], 3);
+        gt_label_set_check_labels(prhs[3], 4);
+        n = gt_label_set_numel(prhs[2]);
+        if (gt_label_set_numel(prhs[3]) != n)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 4 must have %zu elements.", n);
+
+        /* new labels must not exist before renaming (checked first to leave set unchanged) */
+        old_pos.assign(n, 0);
+        for (size_t i = 0; i < n; i++)
+        {
+            gt_label_set_get_label(prhs[2], i, label);
+            old_pos[i] = gt_label_set_find(set, label, gt_label_set_hash(label.data(), label.size()), NULL);
+            gt_label_t newlabel;
+            gt_label_set_get_label(prhs[3], i, newlabel);
+            if (!old_pos[i] || label == newlabel)
+            {
+                old_pos[i] = 0;
+                continue;
+            }
+            if (gt_label_set_find(set, newlabel, gt_label_set_hash(newlabel.data(), newlabel.size()), NULL))
+            {
+                const mxArray* mx_arr_label = mxIsCell(prhs[3]) ? mxGetCell(prhs[3], i) : prhs[3];
+                char* msg_label = mxArrayToString(mx_arr_label);
+                std::vector<size_t>().swap(old_pos);
+                gt_label_t().swap(label);
+                gt_label_t().swap(newlabel);
+                mexErrMsgIdAndTxt(ERRID"rename", "Unique label '%s' already exists", msg_label ? msg_label : "");
+            }
+        }
+
+        /* rename in place; labels renamed to the same new label collapse to the first one */
+        for (size_t i = 0; i < n; i++)
+        {
+            if (!old_pos[i])
+                continue;
+            gt_label_set_get_label(prhs[3], i, set->labels[old_pos[i]-1]);
+            set->hashes[old_pos[i]-1] = gt_label_set_hash(set->labels[old_pos[i]-1].data(),
+                set->labels[old_pos[i]-1].size());
+        }
+        std::vector<gt_label_t> labels;
+        labels.swap(set->labels);
+        gt_label_set_clear(set);
+        gt_label_set_rehash(set, labels.size());
+        for (size_t i = 0; i < labels.size(); i++)
+            gt_label_set_add(set, labels[i]);
+    }
+    else if (!strcmp(op, "merge"))
+    {
+        if (nrhs != 4)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 4 required.", nrhs);
+        gt_label_set_check_labels(prhs[2], 3);
+        gt_label_set_check_labels(prhs[3], 4);
+        n = gt_label_set_numel(prhs[2]);
+        if (gt_label_set_numel(prhs[3]) != n)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 4 must have %zu elements.", n);
+
+        /* positions of old labels before operation (for output mapping) */
+        old_pos.assign(n, 0);
+        for (size_t i = 0; i < n; i++)
+        {
+            gt_label_set_get_label(prhs[2], i, label);
+            old_pos[i] = gt_label_set_find(set, label, gt_label_set_hash(label.data(), label.size()), NULL);
+        }
+
+        /* pairs are applied one after another: merge into an existing new label (remove old
+         * label) or rename old label in place */
+        alive.assign(set->labels.size(), true);
+        gt_label_t newlabel;
+        for (size_t i = 0; i < n; i++)
+        {
+            gt_label_set_get_label(prhs[2], i, label);
+            gt_label_set_get_label(prhs[3], i, newlabel);
+            if (label == newlabel)
+                continue;
+            pos = gt_label_set_find(set, label, gt_label_set_hash(label.data(), label.size()), &alive);
+            if (!pos)
+                continue;
+            uint64_t hash = gt_label_set_hash(newlabel.data(), newlabel.size());
+            if (gt_label_set_find(set, newlabel, hash, &alive))
+                alive[pos-1] = false;
+            else
+            {
+                set->labels[pos-1].swap(newlabel);
+                set->hashes[pos-1] = hash;
+                gt_label_set_insert(set, pos-1);
+            }
+        }
+        gt_label_set_compact(set, alive, new_pos);
+        if (nlhs > 0)
+            gt_label_set_create_mapping(set, new_pos, old_pos, prhs[3], nlhs, plhs);
+    }
+    else
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 must be one of the following: " OPERATIONS ".");
+}
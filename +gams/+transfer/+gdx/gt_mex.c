@@ -32,6 +32,13 @@
 
 #define ERRID "gams:transfer:cmex:gt_mex:"
 
+/* number of calls to Matlab (see gt_mex_callmatlab) */
+static size_t n_callmatlab = 0;
+
+/* field names of profiled phases (see GT_PHASE) */
+static const char* phase_names[GT_PHASE_MAX] = {"symbol", "domain", "records", "uels", "text",
+    "categorical", "table"};
+
 void gt_mex_check_arguments_num(
     int             n_out_required,/** number of required output arguments */
     int             n_out_given,   /** number of given output arguments */
@@ -45,6 +52,20 @@ void gt_mex_check_arguments_num(
         mexErrMsgIdAndTxt(ERRID"check_arguments", "Incorrect number of inputs (%d). %d required.", n_in_given, n_in_required);
 }
 
+void gt_mex_check_arguments_num_range(
+    int             n_out_min,      /** minimum number of output arguments */
+    int             n_out_max,      /** maximum number of output arguments */
+    int             n_out_given,    /** number of given output arguments */
+    int             n_in_required,  /** number of required input arguments */
+    int             n_in_given      /** number of given input arguments */
+)
+{
+    if (n_out_given < n_out_min || n_out_given > n_out_max)
+        mexErrMsgIdAndTxt(ERRID"check_arguments", "Incorrect number of outputs (%d). %d to %d required.", n_out_given, n_out_min, n_out_max);
+    if (n_in_required != n_in_given)
+        mexErrMsgIdAndTxt(ERRID"check_arguments", "Incorrect number of inputs (%d). %d required.", n_in_given, n_in_required);
+}
+
 void gt_mex_check_argument_str(
     const mxArray*  mx_arr_values[],/** Matlab values */
     size_t          arg_position,   /** array index of requested element */
@@ -801,7 +822,7 @@ void gt_mex_getfield_table2struct(
     call_prhs[0] = *value;
     call_prhs[1] = mxCreateString("ToScalar");
     call_prhs[2] = mxCreateLogicalScalar(true);
-    if (mexCallMATLAB(1, call_plhs, 3, call_prhs, "table2struct"))
+    if (gt_mex_callmatlab(1, call_plhs, 3, call_prhs, "table2struct"))
         mexErrMsgIdAndTxt(ERRID"getfield_table2struct", "Calling 'table2struct' failed.");
     *value = call_plhs[0];
     *was_table = true;
@@ -899,6 +920,77 @@ void gt_mex_get_records(
 #endif
 }
 
+#ifdef WITH_R2018A_OR_NEWER
+void gt_mex_get_tensor_index(
+    const char*     name,           /** name of symbol */
+    mxArray*        mx_arr_records, /** Matlab records array (index fields will be removed) */
+    mxArray**       mx_arr_index,   /** Matlab linear index array */
+    mxUint64**      mx_index        /** linear index */
+)
+#else
+void gt_mex_get_tensor_index(
+    const char*     name,           /** name of symbol */
+    mxArray*        mx_arr_records, /** Matlab records array (index fields will be removed) */
+    mxArray**       mx_arr_index,   /** Matlab linear index array */
+    UINT64_T**      mx_index        /** linear index */
+)
+#endif
+{
+    int field_nr;
+    mxArray* call_plhs[1] = {NULL};
+    mxArray* call_prhs[1] = {NULL};
+
+    *mx_arr_index = mxGetField(mx_arr_records, 0, "index");
+    if (!*mx_arr_index)
+        mexErrMsgIdAndTxt(ERRID"get_tensor_index", "Structure '%s' has no field 'index' in "
+            "field 'records'.", name);
+    if (!mxIsUint64(*mx_arr_index))
+    {
+        call_prhs[0] = *mx_arr_index;
+        if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "uint64"))
+            mexErrMsgIdAndTxt(ERRID"uint64", "Calling 'uint64' failed.");
+        *mx_arr_index = call_plhs[0];
+    }
+
+    /* remaining fields are value fields only (field values are not freed) */
+    field_nr = mxGetFieldNumber(mx_arr_records, "index");
+    if (field_nr >= 0)
+        mxRemoveField(mx_arr_records, field_nr);
+    field_nr = mxGetFieldNumber(mx_arr_records, "shape");
+    if (field_nr >= 0)
+        mxRemoveField(mx_arr_records, field_nr);
+
+#ifdef WITH_R2018A_OR_NEWER
+    *mx_index = mxGetUint64s(*mx_arr_index);
+#else
+    *mx_index = (UINT64_T*) mxGetData(*mx_arr_index);
+#endif
+}
+
+mxArray* gt_mex_tensor_shape(
+    size_t          dim,            /** symbol dimension */
+    mwSize*         mx_dom_nrecs    /** number of records of domain symbols (length: max(2,dim)) */
+)
+{
+    mxArray* mx_arr_shape = NULL;
+#ifdef WITH_R2018A_OR_NEWER
+    mxDouble* mx_shape = NULL;
+#else
+    double* mx_shape = NULL;
+#endif
+
+    mx_arr_shape = mxCreateDoubleMatrix(1, MAX(dim, 2), mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+    mx_shape = mxGetDoubles(mx_arr_shape);
+#else
+    mx_shape = mxGetPr(mx_arr_shape);
+#endif
+    for (size_t i = 0; i < MAX(dim, 2); i++)
+        mx_shape[i] = (double) mx_dom_nrecs[i];
+
+    return mx_arr_shape;
+}
+
 void gt_mex_readdata_addfields(
     int             type,           /** symbol type */
     size_t          dim,            /** symbol dimension */
@@ -919,6 +1011,11 @@ void gt_mex_readdata_addfields(
                 mxAddField(mx_arr_records, domains_ptr[i]);
             *n_dom_fields = dim;
             break;
+        case GT_FORMAT_SPARSETENSOR:
+            mxAddField(mx_arr_records, "index");
+            mxAddField(mx_arr_records, "shape");
+            *n_dom_fields = 2;
+            break;
     }
 
     /* add value fields */
@@ -998,6 +1095,14 @@ void gt_mex_readdata_create(
 #endif
             }
             break;
+        case GT_FORMAT_SPARSETENSOR:
+            mx_arr_dom_idx[0] = mxCreateNumericMatrix(nrecs, 1, mxUINT64_CLASS, mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+            mx_dom_idx[0] = mxGetUint64s(mx_arr_dom_idx[0]);
+#else
+            mx_dom_idx[0] = (UINT64_T*) mxGetData(mx_arr_dom_idx[0]);
+#endif
+            break;
     }
 
     /* create record data structures */
@@ -1006,6 +1111,7 @@ void gt_mex_readdata_create(
     {
         case GT_FORMAT_STRUCT:
         case GT_FORMAT_TABLE:
+        case GT_FORMAT_SPARSETENSOR:
             for (size_t i = 0; i < GMS_VAL_MAX; i++)
                 if (values_flag[i])
                 {
@@ -1118,7 +1224,7 @@ void gt_mex_domain2categorical(
     for (size_t i = 0; i < n; i++)
         mx_uel_ids[i] = i+1;
 
-    if (mexCallMATLAB(1, call_plhs, 5, call_prhs, "categorical"))
+    if (gt_mex_callmatlab(1, call_plhs, 5, call_prhs, "categorical"))
         mexErrMsgIdAndTxt(ERRID"domain2categorical", "Calling 'categorical' failed.");
 
     *mx_arr_domains = call_plhs[0];
@@ -1133,7 +1239,7 @@ void gt_mex_categorical(
 
     call_prhs[0] = *mx_arr_cell;
 
-    if (mexCallMATLAB(1, call_plhs, 1, call_prhs, "categorical"))
+    if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "categorical"))
         mexErrMsgIdAndTxt(ERRID"categorical", "Calling 'categorical' failed.");
 
     *mx_arr_cell = call_plhs[0];
@@ -1148,7 +1254,7 @@ bool gt_mex_istable(
     mxArray* call_prhs[1] = {NULL};
 
     call_prhs[0] = mx_array;
-    if (mexCallMATLAB(1, call_plhs, 1, call_prhs, "istable"))
+    if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "istable"))
         mexErrMsgIdAndTxt(ERRID"istable", "Calling 'istable' failed.");
     mx_istable = mxGetLogicals(call_plhs[0]);
 
@@ -1164,7 +1270,7 @@ bool gt_mex_iscellstr(
     mxArray* call_prhs[1] = {NULL};
 
     call_prhs[0] = mx_array;
-    if (mexCallMATLAB(1, call_plhs, 1, call_prhs, "iscellstr"))
+    if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "iscellstr"))
         mexErrMsgIdAndTxt(ERRID"iscellstr", "Calling 'iscellstr' failed.");
     mx_iscellstr = mxGetLogicals(call_plhs[0]);
 
@@ -1180,7 +1286,7 @@ bool gt_mex_iscategorical(
     mxArray* call_prhs[1] = {NULL};
 
     call_prhs[0] = mx_array;
-    if (mexCallMATLAB(1, call_plhs, 1, call_prhs, "iscategorical"))
+    if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "iscategorical"))
         mexErrMsgIdAndTxt(ERRID"iscategorical", "Calling 'iscategorical' failed.");
     mx_iscategorical = mxGetLogicals(call_plhs[0]);
 
@@ -1195,7 +1301,7 @@ void gt_mex_struct2table(
     mxArray* call_prhs[1] = {NULL};
 
     call_prhs[0] = *mx_arr_struct;
-    if (mexCallMATLAB(1, call_plhs, 1, call_prhs, "struct2table"))
+    if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "struct2table"))
         mexErrMsgIdAndTxt(ERRID"struct2table", "Calling 'struct2table' failed.");
     *mx_arr_struct = call_plhs[0];
 }
@@ -1248,7 +1354,7 @@ void gt_mex_int32(
 
     call_prhs[0] = *mx_array;
 
-    if (mexCallMATLAB(1, call_plhs, 1, call_prhs, "int32"))
+    if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "int32"))
         mexErrMsgIdAndTxt(ERRID"int32", "Calling 'int32' failed.");
 
     *mx_array = call_plhs[0];
@@ -1264,9 +1370,130 @@ void gt_mex_categories(
 
     call_prhs[0] = mx_arr_catvals;
 
-    if (mexCallMATLAB(1, call_plhs, 1, call_prhs, "categories"))
+    if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "categories"))
         mexErrMsgIdAndTxt(ERRID"categories", "Calling 'categories' failed.");
 
     *mx_arr_catnames = call_plhs[0];
 }
 
+
+int gt_mex_callmatlab(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    mxArray*        prhs[],         /** inputs */
+    const char*     name            /** name of Matlab function */
+)
+{
+    n_callmatlab++;
+    return mexCallMATLAB(nlhs, plhs, nrhs, prhs, name);
+}
+
+size_t gt_mex_sizeof(
+    const mxArray*  mx_array        /** Matlab array (may be NULL) */
+)
+{
+    size_t n, n_bytes = 0;
+
+    if (!mx_array)
+        return 0;
+
+    n = mxGetNumberOfElements(mx_array);
+    switch (mxGetClassID(mx_array))
+    {
+        case mxCELL_CLASS:
+            for (size_t i = 0; i < n; i++)
+                n_bytes += gt_mex_sizeof(mxGetCell(mx_array, i));
+            break;
+        case mxSTRUCT_CLASS:
+            for (size_t i = 0; i < n; i++)
+                for (int j = 0; j < mxGetNumberOfFields(mx_array); j++)
+                    n_bytes += gt_mex_sizeof(mxGetFieldByNumber(mx_array, i, j));
+            break;
+        case mxUNKNOWN_CLASS:
+        case mxVOID_CLASS:
+        case mxFUNCTION_CLASS:
+        case mxOPAQUE_CLASS:
+        case mxOBJECT_CLASS:
+            break;
+        default:
+            if (mxIsSparse(mx_array))
+                n_bytes = mxGetNzmax(mx_array) * (mxGetElementSize(mx_array) + sizeof(mwIndex)) +
+                    (mxGetN(mx_array) + 1) * sizeof(mwIndex);
+            else
+                n_bytes = n * mxGetElementSize(mx_array);
+            break;
+    }
+
+    return n_bytes;
+}
+
+void gt_mex_profile_start(
+    GT_PROFILE*     profile,        /** profile */
+    bool            enabled,        /** true if profiling is enabled */
+    GT_PHASE        phase           /** first phase */
+)
+{
+    profile->enabled = enabled;
+    profile->phase = GT_PHASE_NONE;
+    for (int i = 0; i < GT_PHASE_MAX; i++)
+        profile->time[i] = 0.0;
+    profile->n_records = 0;
+    profile->n_uels = 0;
+    profile->n_bytes = 0;
+    profile->n_callbacks = n_callmatlab;
+    gt_mex_profile_phase(profile, phase);
+}
+
+void gt_mex_profile_phase(
+    GT_PROFILE*     profile,        /** profile */
+    GT_PHASE        phase           /** new phase (GT_PHASE_NONE: stop) */
+)
+{
+    double now;
+
+    if (!profile->enabled)
+        return;
+
+    now = gt_utils_wtime();
+    if (profile->phase != GT_PHASE_NONE)
+        profile->time[profile->phase] += now - profile->phase_start;
+    profile->phase = phase;
+    profile->phase_start = now;
+}
+
+void gt_mex_profile_add(
+    mxArray*        mx_struct,      /** Matlab structure to add profile to */
+    const char*     name,           /** symbol name */
+    GT_PROFILE*     profile         /** profile */
+)
+{
+    size_t n_callbacks;
+    double total = 0.0;
+    mxArray* mx_arr_profile = NULL;
+    mxArray* mx_arr_time = NULL;
+
+    if (!profile->enabled || profile->phase == GT_PHASE_NONE)
+        return;
+    gt_mex_profile_phase(profile, GT_PHASE_NONE);
+    n_callbacks = n_callmatlab - profile->n_callbacks;
+
+    /* wall time per phase */
+    mx_arr_time = mxCreateStructMatrix(1, 1, 0, NULL);
+    for (int i = 0; i < GT_PHASE_MAX; i++)
+    {
+        gt_mex_addfield_dbl(mx_arr_time, phase_names[i], 1, &profile->time[i]);
+        total += profile->time[i];
+    }
+    gt_mex_addfield_dbl(mx_arr_time, "total", 1, &total);
+
+    /* counters */
+    mx_arr_profile = mxCreateStructMatrix(1, 1, 0, NULL);
+    mxSetFieldByNumber(mx_arr_profile, 0, mxAddField(mx_arr_profile, "time"), mx_arr_time);
+    gt_mex_addfield_sizet(mx_arr_profile, "number_records", 1, &profile->n_records);
+    gt_mex_addfield_sizet(mx_arr_profile, "number_uels", 1, &profile->n_uels);
+    gt_mex_addfield_sizet(mx_arr_profile, "bytes", 1, &profile->n_bytes);
+    gt_mex_addfield_sizet(mx_arr_profile, "number_callbacks", 1, &n_callbacks);
+
+    mxSetFieldByNumber(mx_struct, 0, mxAddField(mx_struct, name), mx_arr_profile);
+}
@@ -29,6 +29,32 @@
 #include "mex.h"
 #include "gt_utils.h"
 
+typedef enum
+{
+    GT_PHASE_NONE = -1,
+    GT_PHASE_SYMBOL = 0,
+    GT_PHASE_DOMAIN = 1,
+    GT_PHASE_RECORDS = 2,
+    GT_PHASE_UELS = 3,
+    GT_PHASE_TEXT = 4,
+    GT_PHASE_CATEGORICAL = 5,
+    GT_PHASE_TABLE = 6,
+    GT_PHASE_MAX = 7,
+} GT_PHASE;
+
+/** per symbol profile of a MEX call */
+typedef struct
+{
+    bool            enabled;        /** true if profiling is enabled */
+    GT_PHASE        phase;          /** running phase */
+    double          phase_start;    /** wall time at start of running phase */
+    double          time[GT_PHASE_MAX]; /** wall time spent in each phase (in seconds) */
+    size_t          n_records;      /** number of records read or written */
+    size_t          n_uels;         /** number of UELs collected or registered */
+    size_t          n_bytes;        /** number of bytes of record arrays */
+    size_t          n_callbacks;    /** number of calls to Matlab at profile start */
+} GT_PROFILE;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -41,6 +67,15 @@ void gt_mex_check_arguments_num(
     int             n_in_given     /** number of given input arguments */
 );
 
+/** checks number of input and output arguments with optional output arguments */
+void gt_mex_check_arguments_num_range(
+    int             n_out_min,      /** minimum number of output arguments */
+    int             n_out_max,      /** maximum number of output arguments */
+    int             n_out_given,    /** number of given output arguments */
+    int             n_in_required,  /** number of required input arguments */
+    int             n_in_given      /** number of given input arguments */
+);
+
 /** checks and returns char argument */
 void gt_mex_check_argument_str(
     const mxArray*  mx_arr_values[],/** Matlab values */
@@ -273,6 +308,29 @@ void gt_mex_get_records(
 );
 #endif
 
+/** gets linear index of sparse tensor records and removes index fields from records */
+#ifdef WITH_R2018A_OR_NEWER
+void gt_mex_get_tensor_index(
+    const char*     name,           /** name of symbol */
+    mxArray*        mx_arr_records, /** Matlab records array (index fields will be removed) */
+    mxArray**       mx_arr_index,   /** Matlab linear index array */
+    mxUint64**      mx_index        /** linear index */
+);
+#else
+void gt_mex_get_tensor_index(
+    const char*     name,           /** name of symbol */
+    mxArray*        mx_arr_records, /** Matlab records array (index fields will be removed) */
+    mxArray**       mx_arr_index,   /** Matlab linear index array */
+    UINT64_T**      mx_index        /** linear index */
+);
+#endif
+
+/** creates shape field (row vector of length max(2,dim)) of sparse tensor records */
+mxArray* gt_mex_tensor_shape(
+    size_t          dim,            /** symbol dimension */
+    mwSize*         mx_dom_nrecs    /** number of records of domain symbols (length: max(2,dim)) */
+);
+
 /** creates record and uel fields when reading in data */
 void gt_mex_readdata_addfields(
     int             type,           /** symbol type */
@@ -362,6 +420,42 @@ void gt_mex_int32(
     mxArray**       mx_array        /** array to be converted into int32 */
 );
 
+/** calls a Matlab function (mexCallMATLAB) and counts the call for profiling */
+int gt_mex_callmatlab(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    mxArray*        prhs[],         /** inputs */
+    const char*     name            /** name of Matlab function */
+);
+
+/** returns the number of bytes of the data of an array (including cell and struct elements;
+ *  Matlab objects, e.g. categorical, are not included) */
+size_t gt_mex_sizeof(
+    const mxArray*  mx_array        /** Matlab array (may be NULL) */
+);
+
+/** starts the profile of a symbol (resets all counters) */
+void gt_mex_profile_start(
+    GT_PROFILE*     profile,        /** profile */
+    bool            enabled,        /** true if profiling is enabled */
+    GT_PHASE        phase           /** first phase */
+);
+
+/** ends the running phase and starts a new one */
+void gt_mex_profile_phase(
+    GT_PROFILE*     profile,        /** profile */
+    GT_PHASE        phase           /** new phase (GT_PHASE_NONE: stop) */
+);
+
+/** stops the profile of a symbol and adds it to a Matlab structure (does nothing if profile is
+ *  not running) */
+void gt_mex_profile_add(
+    mxArray*        mx_struct,      /** Matlab structure to add profile to */
+    const char*     name,           /** symbol name */
+    GT_PROFILE*     profile         /** profile */
+);
+
 /** queries the categories of a categorical array */
 void gt_mex_categories(
     mxArray*        mx_arr_catvals, /** categorical array */
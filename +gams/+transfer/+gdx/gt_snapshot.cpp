@@ -0,0 +1,931 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Snapshot files of data read from GDX
+ *
+ * Usage:
+ *   gt_snapshot('write', snapshot_filename, gdx_filename, key, data)
+ *   [data, valid] = gt_snapshot('read', snapshot_filename, gdx_filename, key)
+ *   [data, valid] = gt_snapshot('read', snapshot_filename, gdx_filename, key, verify)
+ *
+ * A snapshot stores the Matlab data (struct, cell, char, logical, numeric and sparse
+ * arrays as well as table and categorical objects) returned by gt_gdx_read in a binary
+ * file. All array data is stored in native layout and aligned to 8 bytes, such that
+ * reading maps the file into memory and copies each array with a single memcpy.
+ *
+ * A snapshot is valid for the GDX file it was written for: The header stores the key
+ * (char, e.g. GDX path and read arguments) and size, modification time and a content
+ * hash of the GDX file. read compares size and modification time and only hashes the
+ * GDX file if these are ambiguous (GDX file modified shortly before the snapshot was
+ * written, such that a later change may keep the modification time) or if verify is
+ * true. read returns valid = false and data = [] if the snapshot does not exist, does
+ * not match key or GDX file, or is corrupt.
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "mex.h"
+#include "gt_mex.h"
+
+#define ERRID "gams:transfer:cmex:gt_snapshot:"
+
+#define GT_SNAPSHOT_MAGIC "GTSNAP\0\1"
+#define GT_SNAPSHOT_VERSION 2
+#define GT_SNAPSHOT_ENDIAN 0x01020304u
+
+/** GDX modification times this close to (or after) the snapshot time are ambiguous (seconds;
+ *  covers file systems with 2 second timestamp resolution) */
+#define GT_SNAPSHOT_RACY_SECONDS 2
+
+/** node kinds */
+#define GT_SNAPSHOT_NULL 0
+#define GT_SNAPSHOT_NUMERIC 1
+#define GT_SNAPSHOT_LOGICAL 2
+#define GT_SNAPSHOT_CHAR 3
+#define GT_SNAPSHOT_SPARSE 4
+#define GT_SNAPSHOT_CELL 5
+#define GT_SNAPSHOT_STRUCT 6
+#define GT_SNAPSHOT_TABLE 7
+#define GT_SNAPSHOT_CATEGORICAL 8
+
+/** file header (followed by key and data node) */
+typedef struct
+{
+    char            magic[8];       /** GT_SNAPSHOT_MAGIC */
+    uint32_t        version;        /** GT_SNAPSHOT_VERSION */
+    uint32_t        endian;         /** GT_SNAPSHOT_ENDIAN in byte order of writer */
+    uint64_t        file_size;      /** size of snapshot file (detects truncated files) */
+    uint64_t        gdx_size;       /** size of GDX file */
+    int64_t         gdx_mtime;      /** modification time of GDX file (seconds) */
+    uint64_t        gdx_hash;       /** content hash of GDX file */
+    int64_t         time;           /** time the snapshot was written (seconds) */
+    uint64_t        key_len;        /** length of key */
+} GT_SNAPSHOT_HEADER;
+
+/** header of a data node (followed by dimensions and payload) */
+typedef struct
+{
+    uint32_t        kind;           /** node kind */
+    uint32_t        class_id;       /** class of numeric arrays; ordinal flag of categorical */
+    uint64_t        ndims;          /** number of dimensions */
+} GT_SNAPSHOT_NODE;
+
+/** read only view of a file mapped into memory */
+typedef struct
+{
+    const uint8_t*  data;           /** file content */
+    uint64_t        size;           /** file size */
+#ifdef _WIN32
+    HANDLE          file;
+    HANDLE          mapping;
+#endif
+} GT_SNAPSHOT_MAP;
+
+/** buffered snapshot writer */
+typedef struct
+{
+    FILE*           file;           /** output file */
+    uint64_t        offset;         /** bytes written */
+    bool            ok;             /** false on write error */
+    std::vector<mxArray*> objects;  /** decomposed Matlab objects in order of traversal */
+    size_t          next_object;    /** next object to be written */
+} GT_SNAPSHOT_WRITER;
+
+/** Matlab object (table, categorical) to be created from its data after reading */
+typedef struct
+{
+    uint32_t        kind;           /** node kind */
+    bool            ordinal;        /** ordinal flag of categorical */
+    mxArray*        data;           /** object data (placeholder in parent) */
+    mxArray*        parent;         /** cell or struct holding the object data (NULL: root) */
+    size_t          index;          /** element in parent */
+    int             field;          /** field number in parent (-1: cell) */
+} GT_SNAPSHOT_OBJECT;
+
+/** bounds checked snapshot reader */
+typedef struct
+{
+    const uint8_t*  data;           /** snapshot content */
+    uint64_t        size;           /** snapshot size */
+    uint64_t        pos;            /** read position */
+    std::vector<GT_SNAPSHOT_OBJECT> objects; /** objects to be created (children first) */
+} GT_SNAPSHOT_READER;
+
+static bool gt_snapshot_map(
+    const char*     filename,       /** file name */
+    GT_SNAPSHOT_MAP* map            /** output: mapped file */
+)
+{
+    map->data = NULL;
+    map->size = 0;
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    map->mapping = NULL;
+    map->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, NULL);
+    if (map->file == INVALID_HANDLE_VALUE)
+        return false;
+    if (!GetFileSizeEx(map->file, &size))
+    {
+        CloseHandle(map->file);
+        return false;
+    }
+    map->size = (uint64_t) size.QuadPart;
+    if (map->size == 0)
+        return true;
+    map->mapping = CreateFileMappingA(map->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (map->mapping)
+        map->data = (const uint8_t*) MapViewOfFile(map->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!map->data)
+    {
+        if (map->mapping)
+            CloseHandle(map->mapping);
+        CloseHandle(map->file);
+        return false;
+    }
+#else
+    struct stat st;
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    map->size = (uint64_t) st.st_size;
+    if (map->size > 0)
+    {
+        void* data = mmap(NULL, (size_t) map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+        map->data = (const uint8_t*) data;
+    }
+    close(fd);
+#endif
+    return true;
+}
+
+static void gt_snapshot_unmap(
+    GT_SNAPSHOT_MAP* map            /** mapped file */
+)
+{
+#ifdef _WIN32
+    if (map->data)
+        UnmapViewOfFile(map->data);
+    if (map->mapping)
+        CloseHandle(map->mapping);
+    CloseHandle(map->file);
+#else
+    if (map->data)
+        munmap((void*) map->data, (size_t) map->size);
+#endif
+    map->data = NULL;
+}
+
+/** returns size and modification time of a file */
+static bool gt_snapshot_stat(
+    const char*     filename,       /** file name */
+    uint64_t*       size,           /** output: file size */
+    int64_t*        mtime           /** output: modification time (seconds) */
+)
+{
+#ifdef _WIN32
+    struct _stat64 st;
+    if (_stat64(filename, &st) != 0)
+        return false;
+#else
+    struct stat st;
+    if (stat(filename, &st) != 0)
+        return false;
+#endif
+    *size = (uint64_t) st.st_size;
+    *mtime = (int64_t) st.st_mtime;
+    return true;
+}
+
+/** returns content hash of a file */
+static bool gt_snapshot_hash(
+    const char*     filename,       /** file name */
+    uint64_t*       hash            /** output: content hash */
+)
+{
+    GT_SNAPSHOT_MAP map;
+    uint64_t h = 14695981039346656037ULL ^ 0x9e3779b97f4a7c15ULL;
+    size_t n_words;
+
+    /* hash 8 byte words (multiply-rotate) and the remaining bytes */
+    if (!gt_snapshot_map(filename, &map))
+        return false;
+    n_words = (size_t) (map.size / 8);
+    for (size_t i = 0; i < n_words; i++)
+    {
+        uint64_t w;
+        memcpy(&w, map.data + 8 * i, 8);
+        h = (h ^ w) * 0x100000001b3ULL;
+        h = (h << 31) | (h >> 33);
+    }
+    for (uint64_t i = 8 * n_words; i < map.size; i++)
+        h = (h ^ map.data[i]) * 0x100000001b3ULL;
+    *hash = h ^ (h >> 29) ^ map.size;
+    gt_snapshot_unmap(&map);
+    return true;
+}
+
+static void gt_snapshot_write_bytes(
+    GT_SNAPSHOT_WRITER* writer,     /** writer */
+    const void*     data,           /** data */
+    size_t          n               /** number of bytes */
+)
+{
+    if (n == 0 || !writer->ok)
+        return;
+    if (fwrite(data, 1, n, writer->file) != n)
+        writer->ok = false;
+    writer->offset += n;
+}
+
+/** writes data padded to a multiple of 8 bytes */
+static void gt_snapshot_write_padded(
+    GT_SNAPSHOT_WRITER* writer,     /** writer */
+    const void*     data,           /** data */
+    size_t          n               /** number of bytes */
+)
+{
+    static const char zeros[8] = {0};
+    gt_snapshot_write_bytes(writer, data, n);
+    gt_snapshot_write_bytes(writer, zeros, (8 - n % 8) % 8);
+}
+
+static void gt_snapshot_write_u64(
+    GT_SNAPSHOT_WRITER* writer,     /** writer */
+    uint64_t        value           /** value */
+)
+{
+    gt_snapshot_write_bytes(writer, &value, sizeof(value));
+}
+
+static void gt_snapshot_write_header(
+    GT_SNAPSHOT_WRITER* writer,     /** writer */
+    uint32_t        kind,           /** node kind */
+    uint32_t        class_id,       /** class id / flags */
+    const mxArray*  mx_arr          /** array (dimensions) */
+)
+{
+    GT_SNAPSHOT_NODE node;
+    const mwSize* dims = mxGetDimensions(mx_arr);
+    node.kind = kind;
+    node.class_id = class_id;
+    node.ndims = (uint64_t) mxGetNumberOfDimensions(mx_arr);
+    gt_snapshot_write_bytes(writer, &node, sizeof(node));
+    for (size_t i = 0; i < node.ndims; i++)
+        gt_snapshot_write_u64(writer, (uint64_t) dims[i]);
+}
+
+/** decomposes Matlab objects into plain arrays (table: scalar struct of columns;
+ *  categorical: ordinal flag, categories and codes) and checks that all arrays are supported
+ *  (before the snapshot file is opened) */
+static void gt_snapshot_prepare(
+    const mxArray*  mx_arr,         /** array to be written (may be NULL) */
+    std::vector<mxArray*>& objects  /** output: decomposed objects in order of traversal */
+)
+{
+    if (!mx_arr)
+        return;
+
+    if (mxIsClass(mx_arr, "table"))
+    {
+        mxArray* call_plhs[1] = {NULL};
+        mxArray* call_prhs[3] = {(mxArray*) mx_arr, mxCreateString("ToScalar"), mxCreateLogicalScalar(true)};
+        if (gt_mex_callmatlab(1, call_plhs, 3, call_prhs, "table2struct"))
+            mexErrMsgIdAndTxt(ERRID"table2struct", "Calling 'table2struct' failed.");
+        objects.push_back(call_plhs[0]);
+        gt_snapshot_prepare(call_plhs[0], objects);
+        return;
+    }
+
+    if (mxIsClass(mx_arr, "categorical"))
+    {
+        mxArray* mx_arr_codes = (mxArray*) mx_arr;
+        mxArray* mx_arr_catnames = NULL;
+        mxArray* call_plhs[1] = {NULL};
+        mxArray* call_prhs[1] = {(mxArray*) mx_arr};
+        if (gt_mex_callmatlab(1, call_plhs, 1, call_prhs, "isordinal"))
+            mexErrMsgIdAndTxt(ERRID"isordinal", "Calling 'isordinal' failed.");
+        gt_mex_categories((mxArray*) mx_arr, &mx_arr_catnames);
+        gt_mex_int32(&mx_arr_codes);
+        objects.push_back(call_plhs[0]);
+        objects.push_back(mx_arr_codes);
+        objects.push_back(mx_arr_catnames);
+        return;
+    }
+
+    if (mxIsComplex(mx_arr))
+        mexErrMsgIdAndTxt(ERRID"type", "Complex arrays are not supported.");
+    if (mxIsSparse(mx_arr) && !mxIsDouble(mx_arr) && !mxIsLogical(mx_arr))
+        mexErrMsgIdAndTxt(ERRID"type", "Sparse arrays of class '%s' are not supported.", mxGetClassName(mx_arr));
+
+    switch (mxGetClassID(mx_arr))
+    {
+        case mxCELL_CLASS:
+            for (size_t i = 0; i < mxGetNumberOfElements(mx_arr); i++)
+                gt_snapshot_prepare(mxGetCell(mx_arr, i), objects);
+            return;
+        case mxSTRUCT_CLASS:
+            for (size_t i = 0; i < mxGetNumberOfElements(mx_arr); i++)
+                for (int j = 0; j < mxGetNumberOfFields(mx_arr); j++)
+                    gt_snapshot_prepare(mxGetFieldByNumber(mx_arr, i, j), objects);
+            return;
+        case mxCHAR_CLASS:
+        case mxLOGICAL_CLASS:
+        case mxDOUBLE_CLASS:
+        case mxSINGLE_CLASS:
+        case mxINT8_CLASS:
+        case mxUINT8_CLASS:
+        case mxINT16_CLASS:
+        case mxUINT16_CLASS:
+        case mxINT32_CLASS:
+        case mxUINT32_CLASS:
+        case mxINT64_CLASS:
+        case mxUINT64_CLASS:
+            return;
+        default:
+            mexErrMsgIdAndTxt(ERRID"type", "Arrays of class '%s' are not supported.", mxGetClassName(mx_arr));
+    }
+}
+
+/** writes a data node (and its children); objects are taken from gt_snapshot_prepare */
+static void gt_snapshot_write_node(
+    GT_SNAPSHOT_WRITER* writer,     /** writer */
+    const mxArray*  mx_arr          /** array to be written (may be NULL) */
+)
+{
+    if (!mx_arr)
+    {
+        GT_SNAPSHOT_NODE node = {GT_SNAPSHOT_NULL, 0, 0};
+        gt_snapshot_write_bytes(writer, &node, sizeof(node));
+        return;
+    }
+
+    if (mxIsClass(mx_arr, "table"))
+    {
+        gt_snapshot_write_header(writer, GT_SNAPSHOT_TABLE, 0, mx_arr);
+        gt_snapshot_write_node(writer, writer->objects[writer->next_object++]);
+        return;
+    }
+
+    if (mxIsClass(mx_arr, "categorical"))
+    {
+        const mxArray* mx_arr_ordinal = writer->objects[writer->next_object++];
+        gt_snapshot_write_header(writer, GT_SNAPSHOT_CATEGORICAL, mxIsLogicalScalarTrue(mx_arr_ordinal) ? 1 : 0, mx_arr);
+        gt_snapshot_write_node(writer, writer->objects[writer->next_object++]);
+        gt_snapshot_write_node(writer, writer->objects[writer->next_object++]);
+        return;
+    }
+
+    if (mxIsSparse(mx_arr))
+    {
+        size_t n = mxGetN(mx_arr);
+        const mwIndex* jc = mxGetJc(mx_arr);
+        const mwIndex* ir = mxGetIr(mx_arr);
+        uint64_t nnz = (uint64_t) jc[n];
+        gt_snapshot_write_header(writer, GT_SNAPSHOT_SPARSE, (uint32_t) mxGetClassID(mx_arr), mx_arr);
+        gt_snapshot_write_u64(writer, nnz);
+        for (size_t i = 0; i <= n; i++)
+            gt_snapshot_write_u64(writer, (uint64_t) jc[i]);
+        for (size_t i = 0; i < nnz; i++)
+            gt_snapshot_write_u64(writer, (uint64_t) ir[i]);
+        gt_snapshot_write_padded(writer, mxGetData(mx_arr), nnz * mxGetElementSize(mx_arr));
+        return;
+    }
+
+    switch (mxGetClassID(mx_arr))
+    {
+        case mxCELL_CLASS:
+            gt_snapshot_write_header(writer, GT_SNAPSHOT_CELL, 0, mx_arr);
+            for (size_t i = 0; i < mxGetNumberOfElements(mx_arr); i++)
+                gt_snapshot_write_node(writer, mxGetCell(mx_arr, i));
+            return;
+
+        case mxSTRUCT_CLASS:
+        {
+            size_t n_fields = (size_t) mxGetNumberOfFields(mx_arr);
+            gt_snapshot_write_header(writer, GT_SNAPSHOT_STRUCT, 0, mx_arr);
+            gt_snapshot_write_u64(writer, (uint64_t) n_fields);
+            for (size_t j = 0; j < n_fields; j++)
+            {
+                const char* name = mxGetFieldNameByNumber(mx_arr, (int) j);
+                gt_snapshot_write_u64(writer, (uint64_t) strlen(name));
+                gt_snapshot_write_padded(writer, name, strlen(name));
+            }
+            for (size_t i = 0; i < mxGetNumberOfElements(mx_arr); i++)
+                for (size_t j = 0; j < n_fields; j++)
+                    gt_snapshot_write_node(writer, mxGetFieldByNumber(mx_arr, i, (int) j));
+            return;
+        }
+
+        case mxCHAR_CLASS:
+            gt_snapshot_write_header(writer, GT_SNAPSHOT_CHAR, 0, mx_arr);
+            gt_snapshot_write_padded(writer, mxGetChars(mx_arr), mxGetNumberOfElements(mx_arr) * sizeof(mxChar));
+            return;
+
+        case mxLOGICAL_CLASS:
+            gt_snapshot_write_header(writer, GT_SNAPSHOT_LOGICAL, 0, mx_arr);
+            gt_snapshot_write_padded(writer, mxGetLogicals(mx_arr), mxGetNumberOfElements(mx_arr) * sizeof(mxLogical));
+            return;
+
+        case mxDOUBLE_CLASS:
+        case mxSINGLE_CLASS:
+        case mxINT8_CLASS:
+        case mxUINT8_CLASS:
+        case mxINT16_CLASS:
+        case mxUINT16_CLASS:
+        case mxINT32_CLASS:
+        case mxUINT32_CLASS:
+        case mxINT64_CLASS:
+        case mxUINT64_CLASS:
+            gt_snapshot_write_header(writer, GT_SNAPSHOT_NUMERIC, (uint32_t) mxGetClassID(mx_arr), mx_arr);
+            gt_snapshot_write_padded(writer, mxGetData(mx_arr), mxGetNumberOfElements(mx_arr) * mxGetElementSize(mx_arr));
+            return;
+
+        default:
+            return;
+    }
+}
+
+/** returns pointer to the next n bytes (padded to 8 bytes) or NULL if out of bounds */
+static const uint8_t* gt_snapshot_take(
+    GT_SNAPSHOT_READER* reader,     /** reader */
+    uint64_t        n               /** number of bytes */
+)
+{
+    uint64_t n_padded = n + (8 - n % 8) % 8;
+    if (n_padded < n || n_padded > reader->size - reader->pos)
+        return NULL;
+    const uint8_t* data = reader->data + reader->pos;
+    reader->pos += n_padded;
+    return data;
+}
+
+static bool gt_snapshot_read_u64(
+    GT_SNAPSHOT_READER* reader,     /** reader */
+    uint64_t*       value           /** output: value */
+)
+{
+    const uint8_t* data = gt_snapshot_take(reader, sizeof(*value));
+    if (!data)
+        return false;
+    memcpy(value, data, sizeof(*value));
+    return true;
+}
+
+/** returns number of elements of dimensions or false on overflow */
+static bool gt_snapshot_numel(
+    const std::vector<mwSize>& dims, /** dimensions */
+    uint64_t        limit,          /** maximal number of elements */
+    size_t*         numel           /** output: number of elements */
+)
+{
+    uint64_t n = 1;
+    for (size_t i = 0; i < dims.size(); i++)
+    {
+        if (dims[i] != 0 && n > limit / dims[i])
+            return false;
+        n *= dims[i];
+    }
+    *numel = (size_t) n;
+    return true;
+}
+
+static bool gt_snapshot_read_child(
+    GT_SNAPSHOT_READER* reader,     /** reader */
+    mxArray*        mx_arr_parent,  /** cell or struct */
+    size_t          index,          /** element in parent */
+    int             field           /** field number in parent (-1: cell) */
+);
+
+/** reads a data node (and its children); returns false if the snapshot is corrupt */
+static bool gt_snapshot_read_node(
+    GT_SNAPSHOT_READER* reader,     /** reader */
+    mxArray**       mx_arr          /** output: array (NULL for NULL node) */
+)
+{
+    GT_SNAPSHOT_NODE node;
+    std::vector<mwSize> dims;
+    size_t numel;
+    const uint8_t* data;
+
+    *mx_arr = NULL;
+    data = gt_snapshot_take(reader, sizeof(node));
+    if (!data)
+        return false;
+    memcpy(&node, data, sizeof(node));
+    if (node.kind == GT_SNAPSHOT_NULL)
+        return true;
+    if (node.ndims < 2 || node.ndims > 64)
+        return false;
+    dims.resize((size_t) node.ndims);
+    for (size_t i = 0; i < dims.size(); i++)
+    {
+        uint64_t dim;
+        if (!gt_snapshot_read_u64(reader, &dim))
+            return false;
+        dims[i] = (mwSize) dim;
+    }
+    if (!gt_snapshot_numel(dims, reader->size, &numel))
+        return false;
+
+    switch (node.kind)
+    {
+        case GT_SNAPSHOT_NUMERIC:
+        case GT_SNAPSHOT_LOGICAL:
+        case GT_SNAPSHOT_CHAR:
+            if (node.kind == GT_SNAPSHOT_LOGICAL)
+                *mx_arr = mxCreateLogicalArray(dims.size(), dims.data());
+            else if (node.kind == GT_SNAPSHOT_CHAR)
+                *mx_arr = mxCreateCharArray(dims.size(), dims.data());
+            else if (node.class_id >= mxDOUBLE_CLASS && node.class_id <= mxUINT64_CLASS)
+                *mx_arr = mxCreateNumericArray(dims.size(), dims.data(), (mxClassID) node.class_id, mxREAL);
+            else
+                return false;
+            data = gt_snapshot_take(reader, (uint64_t) numel * mxGetElementSize(*mx_arr));
+            if (!data)
+                return false;
+            if (numel > 0)
+                memcpy(mxGetData(*mx_arr), data, numel * mxGetElementSize(*mx_arr));
+            return true;
+
+        case GT_SNAPSHOT_SPARSE:
+        {
+            uint64_t nnz;
+            const uint8_t* jc;
+            const uint8_t* ir;
+            mwIndex* mx_jc;
+            mwIndex* mx_ir;
+            if (dims.size() != 2 || !gt_snapshot_read_u64(reader, &nnz) || nnz > reader->size)
+                return false;
+            if (node.class_id == mxLOGICAL_CLASS)
+                *mx_arr = mxCreateSparseLogicalMatrix(dims[0], dims[1], nnz > 0 ? (mwSize) nnz : 1);
+            else if (node.class_id == mxDOUBLE_CLASS)
+                *mx_arr = mxCreateSparse(dims[0], dims[1], nnz > 0 ? (mwSize) nnz : 1, mxREAL);
+            else
+                return false;
+            jc = gt_snapshot_take(reader, 8 * ((uint64_t) dims[1] + 1));
+            ir = gt_snapshot_take(reader, 8 * nnz);
+            data = gt_snapshot_take(reader, nnz * mxGetElementSize(*mx_arr));
+            if (!jc || !ir || !data)
+                return false;
+            mx_jc = mxGetJc(*mx_arr);
+            mx_ir = mxGetIr(*mx_arr);
+            for (size_t i = 0; i <= dims[1]; i++)
+            {
+                uint64_t v;
+                memcpy(&v, jc + 8 * i, 8);
+                if (v > nnz || (i > 0 && v < mx_jc[i-1]))
+                    return false;
+                mx_jc[i] = (mwIndex) v;
+            }
+            if (mx_jc[dims[1]] != nnz)
+                return false;
+            for (size_t i = 0; i < nnz; i++)
+            {
+                uint64_t v;
+                memcpy(&v, ir + 8 * i, 8);
+                if (v >= dims[0])
+                    return false;
+                mx_ir[i] = (mwIndex) v;
+            }
+            if (nnz > 0)
+                memcpy(mxGetData(*mx_arr), data, nnz * mxGetElementSize(*mx_arr));
+            return true;
+        }
+
+        case GT_SNAPSHOT_CELL:
+            *mx_arr = mxCreateCellArray(dims.size(), dims.data());
+            for (size_t i = 0; i < numel; i++)
+                if (!gt_snapshot_read_child(reader, *mx_arr, i, -1))
+                    return false;
+            return true;
+
+        case GT_SNAPSHOT_STRUCT:
+        {
+            uint64_t n_fields;
+            std::vector<std::string> names;
+            std::vector<const char*> names_ptr;
+            if (!gt_snapshot_read_u64(reader, &n_fields) || n_fields > 65536)
+                return false;
+            names.resize((size_t) n_fields);
+            names_ptr.resize((size_t) n_fields);
+            for (size_t j = 0; j < names.size(); j++)
+            {
+                uint64_t len;
+                if (!gt_snapshot_read_u64(reader, &len) || !(data = gt_snapshot_take(reader, len)))
+                    return false;
+                names[j].assign((const char*) data, (size_t) len);
+                names_ptr[j] = names[j].c_str();
+            }
+            *mx_arr = mxCreateStructArray(dims.size(), dims.data(), (int) n_fields, names_ptr.data());
+            for (size_t i = 0; i < numel; i++)
+                for (size_t j = 0; j < names.size(); j++)
+                    if (!gt_snapshot_read_child(reader, *mx_arr, i, (int) j))
+                        return false;
+            return true;
+        }
+
+        case GT_SNAPSHOT_TABLE:
+        case GT_SNAPSHOT_CATEGORICAL:
+        {
+            /* object data (table: struct; categorical: cell of codes and categories); objects
+             * are created after reading, such that no Matlab function is called while the file
+             * is mapped */
+            GT_SNAPSHOT_OBJECT object;
+            object.kind = node.kind;
+            object.ordinal = node.class_id != 0;
+            object.parent = NULL;
+            object.index = 0;
+            object.field = -1;
+            if (node.kind == GT_SNAPSHOT_TABLE)
+            {
+                if (!gt_snapshot_read_node(reader, mx_arr) || !*mx_arr || !mxIsStruct(*mx_arr))
+                    return false;
+            }
+            else
+            {
+                *mx_arr = mxCreateCellMatrix(1, 2);
+                for (size_t i = 0; i < 2; i++)
+                    if (!gt_snapshot_read_child(reader, *mx_arr, i, -1))
+                        return false;
+                if (!mxGetCell(*mx_arr, 0) || !mxIsInt32(mxGetCell(*mx_arr, 0)) ||
+                    !mxGetCell(*mx_arr, 1) || !mxIsCell(mxGetCell(*mx_arr, 1)))
+                    return false;
+            }
+            object.data = *mx_arr;
+            reader->objects.push_back(object);
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+/** reads a data node into an element of a cell or struct */
+static bool gt_snapshot_read_child(
+    GT_SNAPSHOT_READER* reader,     /** reader */
+    mxArray*        mx_arr_parent,  /** cell or struct */
+    size_t          index,          /** element in parent */
+    int             field           /** field number in parent (-1: cell) */
+)
+{
+    mxArray* mx_arr = NULL;
+    if (!gt_snapshot_read_node(reader, &mx_arr))
+        return false;
+    if (field < 0)
+        mxSetCell(mx_arr_parent, index, mx_arr);
+    else
+        mxSetFieldByNumber(mx_arr_parent, index, field, mx_arr);
+
+    /* objects are registered after their children: the last object belongs to this node */
+    if (mx_arr && !reader->objects.empty() && reader->objects.back().data == mx_arr)
+    {
+        reader->objects.back().parent = mx_arr_parent;
+        reader->objects.back().index = index;
+        reader->objects.back().field = field;
+    }
+    return true;
+}
+
+/** creates the objects read (children first) and replaces their data in the parent */
+static void gt_snapshot_create_objects(
+    GT_SNAPSHOT_READER* reader,     /** reader */
+    mxArray**       mx_arr_root     /** root array (replaced if an object itself) */
+)
+{
+    for (size_t k = 0; k < reader->objects.size(); k++)
+    {
+        GT_SNAPSHOT_OBJECT* object = &reader->objects[k];
+        mxArray* mx_arr = object->data;
+
+        if (object->kind == GT_SNAPSHOT_TABLE)
+            gt_mex_struct2table(&mx_arr);
+        else
+        {
+            mxArray* call_plhs[1] = {NULL};
+            mxArray* call_prhs[5] = {NULL};
+            size_t n;
+#ifdef WITH_R2018A_OR_NEWER
+            mxInt32* mx_valueset = NULL;
+#else
+            INT32_T* mx_valueset = NULL;
+#endif
+            call_prhs[0] = mxGetCell(object->data, 0);
+            call_prhs[2] = mxGetCell(object->data, 1);
+            n = mxGetNumberOfElements(call_prhs[2]);
+            call_prhs[1] = mxCreateNumericMatrix(1, n, mxINT32_CLASS, mxREAL);
+#ifdef WITH_R2018A_OR_NEWER
+            mx_valueset = mxGetInt32s(call_prhs[1]);
+#else
+            mx_valueset = (INT32_T*) mxGetData(call_prhs[1]);
+#endif
+            for (size_t i = 0; i < n; i++)
+                mx_valueset[i] = (INT32_T) (i + 1);
+            call_prhs[3] = mxCreateString("Ordinal");
+            call_prhs[4] = mxCreateLogicalScalar(object->ordinal);
+            if (gt_mex_callmatlab(1, call_plhs, 5, call_prhs, "categorical"))
+                mexErrMsgIdAndTxt(ERRID"categorical", "Calling 'categorical' failed.");
+            mx_arr = call_plhs[0];
+            mxDestroyArray(call_prhs[1]);
+            mxDestroyArray(call_prhs[3]);
+            mxDestroyArray(call_prhs[4]);
+        }
+
+        if (!object->parent)
+            *mx_arr_root = mx_arr;
+        else if (object->field < 0)
+            mxSetCell(object->parent, object->index, mx_arr);
+        else
+            mxSetFieldByNumber(object->parent, object->index, object->field, mx_arr);
+        mxDestroyArray(object->data);
+    }
+}
+
+void mexFunction(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    char op[8];
+    char* snapshot_filename = NULL;
+    char* gdx_filename = NULL;
+    GT_SNAPSHOT_HEADER header;
+
+    /* check input arguments */
+    if (nrhs < 1 || !mxIsChar(prhs[0]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need char");
+    mxGetString(prhs[0], op, 8);
+    if (strcmp(op, "write") && strcmp(op, "read"))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 must be one of the following: write, read.");
+    if (op[0] == 'w' && nrhs != 5)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 5 required.", nrhs);
+    if (op[0] == 'r' && (nrhs < 4 || nrhs > 5))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 4 to 5 required.", nrhs);
+    if (op[0] == 'r' && nrhs == 5 && !mxIsLogicalScalar(prhs[4]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 5 has invalid type: need logical scalar");
+    for (int i = 1; i < 4; i++)
+        if (!mxIsChar(prhs[i]))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument %d has invalid type: need char", i+1);
+    snapshot_filename = mxArrayToString(prhs[1]);
+    gdx_filename = mxArrayToString(prhs[2]);
+    size_t key_len = mxGetNumberOfElements(prhs[3]);
+    const mxChar* key = mxGetChars(prhs[3]);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GT_SNAPSHOT_MAGIC, 8);
+    header.version = GT_SNAPSHOT_VERSION;
+    header.endian = GT_SNAPSHOT_ENDIAN;
+    header.key_len = (uint64_t) key_len;
+
+    if (op[0] == 'w')
+    {
+        GT_SNAPSHOT_WRITER writer;
+        std::string tmp_filename = std::string(snapshot_filename) + ".tmp";
+
+        header.time = (int64_t) time(NULL);
+        if (!gt_snapshot_stat(gdx_filename, &header.gdx_size, &header.gdx_mtime) ||
+            !gt_snapshot_hash(gdx_filename, &header.gdx_hash))
+            mexErrMsgIdAndTxt(ERRID"gdx_file", "Cannot access GDX file '%s'.", gdx_filename);
+
+        /* decompose objects before opening the file: Matlab calls may fail */
+        gt_snapshot_prepare(prhs[4], writer.objects);
+        writer.next_object = 0;
+
+        /* write to temporary file first, such that readers never see a partial snapshot */
+        writer.file = fopen(tmp_filename.c_str(), "wb");
+        writer.offset = 0;
+        writer.ok = writer.file != NULL;
+        if (!writer.ok)
+            mexErrMsgIdAndTxt(ERRID"write", "Cannot open file '%s' for writing.", tmp_filename.c_str());
+        gt_snapshot_write_bytes(&writer, &header, sizeof(header));
+        gt_snapshot_write_padded(&writer, key, key_len * sizeof(mxChar));
+        gt_snapshot_write_node(&writer, prhs[4]);
+
+        /* file size is known at the end only */
+        header.file_size = writer.offset;
+        if (writer.ok && fseek(writer.file, 0, SEEK_SET) == 0)
+            gt_snapshot_write_bytes(&writer, &header, sizeof(header));
+        else
+            writer.ok = false;
+        if (fclose(writer.file) != 0)
+            writer.ok = false;
+        for (size_t i = 0; i < writer.objects.size(); i++)
+            mxDestroyArray(writer.objects[i]);
+        if (writer.ok)
+        {
+            remove(snapshot_filename);
+            writer.ok = rename(tmp_filename.c_str(), snapshot_filename) == 0;
+        }
+        if (!writer.ok)
+        {
+            remove(tmp_filename.c_str());
+            mexErrMsgIdAndTxt(ERRID"write", "Cannot write snapshot file '%s'.", snapshot_filename);
+        }
+        return;
+    }
+
+    /* read: any mismatch or inconsistency results in an invalid snapshot */
+    GT_SNAPSHOT_MAP map;
+    GT_SNAPSHOT_HEADER file_header;
+    GT_SNAPSHOT_READER reader;
+    const uint8_t* data;
+    bool valid = false;
+    bool verify = nrhs > 4 && mxIsLogicalScalarTrue(prhs[4]);
+    mxArray* mx_arr_data = NULL;
+
+    if (gt_snapshot_map(snapshot_filename, &map))
+    {
+        reader.data = map.data;
+        reader.size = map.size;
+        reader.pos = 0;
+        data = gt_snapshot_take(&reader, sizeof(file_header));
+        if (data)
+        {
+            memcpy(&file_header, data, sizeof(file_header));
+            valid = !memcmp(file_header.magic, header.magic, 8) && file_header.version == header.version &&
+                file_header.endian == header.endian && file_header.file_size == map.size &&
+                file_header.key_len == header.key_len;
+        }
+        if (valid)
+        {
+            data = gt_snapshot_take(&reader, key_len * sizeof(mxChar));
+            valid = data && (key_len == 0 || !memcmp(data, key, key_len * sizeof(mxChar)));
+        }
+        if (valid)
+        {
+            valid = gt_snapshot_stat(gdx_filename, &header.gdx_size, &header.gdx_mtime) &&
+                file_header.gdx_size == header.gdx_size && file_header.gdx_mtime == header.gdx_mtime;
+        }
+        if (valid && (verify || file_header.gdx_mtime >= file_header.time - GT_SNAPSHOT_RACY_SECONDS))
+        {
+            valid = gt_snapshot_hash(gdx_filename, &header.gdx_hash) &&
+                file_header.gdx_hash == header.gdx_hash;
+        }
+        if (valid)
+            valid = gt_snapshot_read_node(&reader, &mx_arr_data) && mx_arr_data && reader.pos == reader.size;
+        gt_snapshot_unmap(&map);
+    }
+    if (valid)
+        gt_snapshot_create_objects(&reader, &mx_arr_data);
+
+    if (!valid)
+    {
+        if (mx_arr_data)
+            mxDestroyArray(mx_arr_data);
+        mx_arr_data = mxCreateDoubleMatrix(0, 0, mxREAL);
+    }
+    plhs[0] = mx_arr_data;
+    if (nlhs > 1)
+        plhs[1] = mxCreateLogicalScalar(valid);
+}
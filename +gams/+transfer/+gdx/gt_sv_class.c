@@ -0,0 +1,272 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Classification of GAMS special values
+ *
+ * Usage:
+ *   codes = gt_sv_class(values)
+ *   mask = gt_sv_class(columns, classes)
+ *   mask = gt_sv_class(columns, classes, defaults)
+ *
+ * codes:   uint8 class code per element of the double array values (for sparse arrays:
+ *          per stored element): 0 normal, 1 zero, 2 eps, 3 na, 4 undef, 5 posinf, 6 neginf.
+ * mask:    logical mask that is true for elements where the element of any of the double
+ *          arrays in cell columns (all of same size) is of one of the classes given in the
+ *          cellstr classes ('normal', 'zero', 'eps', 'na', 'undef', 'posinf', 'neginf',
+ *          'missing' (na or undef)) or equals (==) the column's default value. A single sparse
+ *          column results in a sparse mask; since only its stored elements are classified, 'zero'
+ *          and a default value of 0 are rejected for it.
+ *
+ * Classes are computed from the bit pattern of the values without branches, such that
+ * the loops can be vectorized by the compiler.
+ */
+
+#include <string.h>
+
+#include "mex.h"
+
+#define ERRID "gams:transfer:cmex:gt_sv_class:"
+
+#define GT_SV_CLASS_NORMAL 0
+#define GT_SV_CLASS_ZERO 1
+#define GT_SV_CLASS_EPS 2
+#define GT_SV_CLASS_NA 3
+#define GT_SV_CLASS_UNDEF 4
+#define GT_SV_CLASS_POSINF 5
+#define GT_SV_CLASS_NEGINF 6
+
+#define GT_SV_BITS_ABS 0x7fffffffffffffffULL
+#define GT_SV_BITS_INF 0x7ff0000000000000ULL
+#define GT_SV_BITS_NA 0xfffffffffffffffeULL
+
+#ifdef WITH_R2018A_OR_NEWER
+#define GT_GET_DOUBLES(arr) mxGetDoubles(arr)
+#else
+#define GT_GET_DOUBLES(arr) mxGetPr(arr)
+#endif
+
+/** returns class code of value */
+static inline UINT8_T gt_sv_class(
+    double          value           /** value */
+)
+{
+    UINT64_T bits, abs_bits, sign, is_zero, is_inf, is_nan, is_na;
+    memcpy(&bits, &value, sizeof(bits));
+    abs_bits = bits & GT_SV_BITS_ABS;
+    sign = bits >> 63;
+    is_zero = abs_bits == 0;
+    is_inf = abs_bits == GT_SV_BITS_INF;
+    is_nan = abs_bits > GT_SV_BITS_INF;
+    is_na = bits == GT_SV_BITS_NA;
+    return (UINT8_T) (is_zero * (GT_SV_CLASS_ZERO + sign) + is_inf * (GT_SV_CLASS_POSINF + sign) +
+        is_nan * (GT_SV_CLASS_UNDEF - is_na));
+}
+
+/** returns bit set of classes given by names */
+static unsigned gt_sv_class_parse(
+    const mxArray*  mx_arr_classes  /** cellstr of class names */
+)
+{
+    unsigned classes = 0;
+    char name[8];
+
+    if (!mxIsCell(mx_arr_classes))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need cellstr");
+    for (size_t i = 0; i < mxGetNumberOfElements(mx_arr_classes); i++)
+    {
+        const mxArray* mx_arr = mxGetCell(mx_arr_classes, i);
+        if (!mx_arr || !mxIsChar(mx_arr))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need cellstr");
+        if (mxGetString(mx_arr, name, sizeof(name)))
+            name[0] = '\0';
+        if (!strcmp(name, "normal"))
+            classes |= 1u << GT_SV_CLASS_NORMAL;
+        else if (!strcmp(name, "zero"))
+            classes |= 1u << GT_SV_CLASS_ZERO;
+        else if (!strcmp(name, "eps"))
+            classes |= 1u << GT_SV_CLASS_EPS;
+        else if (!strcmp(name, "na"))
+            classes |= 1u << GT_SV_CLASS_NA;
+        else if (!strcmp(name, "undef"))
+            classes |= 1u << GT_SV_CLASS_UNDEF;
+        else if (!strcmp(name, "missing"))
+            classes |= (1u << GT_SV_CLASS_NA) | (1u << GT_SV_CLASS_UNDEF);
+        else if (!strcmp(name, "posinf"))
+            classes |= 1u << GT_SV_CLASS_POSINF;
+        else if (!strcmp(name, "neginf"))
+            classes |= 1u << GT_SV_CLASS_NEGINF;
+        else
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 contains invalid class. Must be one "
+                "of the following: normal, zero, eps, na, undef, missing, posinf, neginf.");
+    }
+    return classes;
+}
+
+/** adds matching elements to mask */
+static void gt_sv_class_mask(
+    size_t          n,              /** number of elements */
+    const double*   values,         /** values */
+    unsigned        classes,        /** bit set of classes */
+    bool            has_default,    /** compare to default value */
+    double          def,            /** default value */
+    mxLogical*      mask            /** mask (in / out) */
+)
+{
+    for (size_t i = 0; i < n; i++)
+        mask[i] |= ((classes >> gt_sv_class(values[i])) & 1u) | (has_default & (values[i] == def));
+}
+
+void mexFunction(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    size_t n_columns, n;
+    unsigned classes;
+    const double* defaults = NULL;
+    mxLogical* mask = NULL;
+
+    if (nlhs > 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of outputs (%d). 0 or 1 required.", nlhs);
+    if (nrhs < 1 || nrhs > 3)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 1 to 3 required.", nrhs);
+
+    /* class codes of all elements */
+    if (nrhs == 1)
+    {
+        const double* values;
+        UINT8_T* codes;
+
+        if (!mxIsDouble(prhs[0]))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need double");
+        values = GT_GET_DOUBLES(prhs[0]);
+        if (mxIsSparse(prhs[0]))
+        {
+            n = mxGetJc(prhs[0])[mxGetN(prhs[0])];
+            plhs[0] = mxCreateNumericMatrix(n, 1, mxUINT8_CLASS, mxREAL);
+        }
+        else
+        {
+            n = mxGetNumberOfElements(prhs[0]);
+            plhs[0] = mxCreateNumericArray(mxGetNumberOfDimensions(prhs[0]), mxGetDimensions(prhs[0]),
+                mxUINT8_CLASS, mxREAL);
+        }
+#ifdef WITH_R2018A_OR_NEWER
+        codes = mxGetUint8s(plhs[0]);
+#else
+        codes = (UINT8_T*) mxGetData(plhs[0]);
+#endif
+        for (size_t i = 0; i < n; i++)
+            codes[i] = gt_sv_class(values[i]);
+        return;
+    }
+
+    /* mask of matching rows */
+    if (!mxIsCell(prhs[0]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need cell");
+    n_columns = mxGetNumberOfElements(prhs[0]);
+    classes = gt_sv_class_parse(prhs[1]);
+    if (nrhs > 2)
+    {
+        if (!mxIsDouble(prhs[2]) || mxGetNumberOfElements(prhs[2]) != n_columns)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 3 has invalid type: need double vector "
+                "of length %zu", n_columns);
+        defaults = GT_GET_DOUBLES(prhs[2]);
+    }
+    for (size_t k = 0; k < n_columns; k++)
+    {
+        const mxArray* mx_arr = mxGetCell(prhs[0], k);
+        if (!mx_arr || !mxIsDouble(mx_arr))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need cell of double");
+        if (mxIsSparse(mx_arr) && n_columns > 1)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 must not contain several sparse arrays.");
+        if (mxGetNumberOfElements(mx_arr) != mxGetNumberOfElements(mxGetCell(prhs[0], 0)))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 must contain arrays of same size.");
+    }
+
+    if (n_columns == 0)
+    {
+        plhs[0] = mxCreateLogicalMatrix(0, 1);
+        return;
+    }
+
+    /* sparse: mask of stored elements */
+    if (mxIsSparse(mxGetCell(prhs[0], 0)))
+    {
+        const mxArray* mx_arr = mxGetCell(prhs[0], 0);
+        size_t ncols = mxGetN(mx_arr), nnz = 0;
+        const mwIndex* rows = mxGetIr(mx_arr);
+        const mwIndex* cols = mxGetJc(mx_arr);
+        mwIndex* mask_rows;
+        mwIndex* mask_cols;
+        mxLogical* stored;
+
+        /* implicit zeros are not classified */
+        if ((classes >> GT_SV_CLASS_ZERO) & 1u)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 must not contain class 'zero' for "
+                "sparse arrays.");
+        if (defaults && defaults[0] == 0.0)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 3 must not be 0 for sparse arrays.");
+
+        n = cols[ncols];
+        stored = (mxLogical*) mxCalloc(n > 0 ? n : 1, sizeof(mxLogical));
+        gt_sv_class_mask(n, GT_GET_DOUBLES(mx_arr), classes, defaults != NULL, defaults ? defaults[0] : 0.0,
+            stored);
+        for (size_t p = 0; p < n; p++)
+            nnz += stored[p];
+
+        plhs[0] = mxCreateSparseLogicalMatrix(mxGetM(mx_arr), ncols, nnz > 0 ? nnz : 1);
+        mask = mxGetLogicals(plhs[0]);
+        mask_rows = mxGetIr(plhs[0]);
+        mask_cols = mxGetJc(plhs[0]);
+        nnz = 0;
+        mask_cols[0] = 0;
+        for (size_t c = 0; c < ncols; c++)
+        {
+            for (size_t p = cols[c]; p < cols[c+1]; p++)
+            {
+                if (!stored[p])
+                    continue;
+                mask_rows[nnz] = rows[p];
+                mask[nnz++] = true;
+            }
+            mask_cols[c+1] = nnz;
+        }
+        mxFree(stored);
+        return;
+    }
+
+    /* dense: any column matches */
+    n = mxGetNumberOfElements(mxGetCell(prhs[0], 0));
+    plhs[0] = mxCreateLogicalArray(mxGetNumberOfDimensions(mxGetCell(prhs[0], 0)),
+        mxGetDimensions(mxGetCell(prhs[0], 0)));
+    mask = mxGetLogicals(plhs[0]);
+    for (size_t k = 0; k < n_columns; k++)
+        gt_sv_class_mask(n, GT_GET_DOUBLES(mxGetCell(prhs[0], k)), classes, defaults != NULL,
+            defaults ? defaults[k] : 0.0, mask);
+}
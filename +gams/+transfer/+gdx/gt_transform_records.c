@@ -0,0 +1,653 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Transformation of records between tabular and matrix formats
+ *
+ * Usage:
+ *   matrices = gt_transform_records('matrix', index, size, values, defaults, sparse)
+ *   [indices, values] = gt_transform_records('tabular', matrices, size, defaults, dim)
+ *   [indices, perm] = gt_transform_records('tensor', index, size, dim)
+ *
+ * matrix:  Scatters record values into dense or (2-dim) sparse matrices of given
+ *          size. index is a cell of uint64 domain code columns or a uint64 linear
+ *          (column-major) index. Entries without record hold the default value, the
+ *          last record wins for duplicates. Sparse matrices store all values but +0
+ *          (like the GDX reader, EPS is stored as -0).
+ * tabular: Gathers all entries of dense or sparse matrices where any value differs
+ *          from its default (like the GDX writer, EPS differs from 0). Returns dim
+ *          domain code columns and value columns in row-major order of the domains.
+ * tensor:  Decodes a linear (column-major) index into dim domain code columns sorted
+ *          in row-major order and returns the (stable) permutation of the records.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "mex.h"
+#include "gclgms.h"
+
+#define ERRID "gams:transfer:cmex:gt_transform_records:"
+
+#ifdef WITH_R2018A_OR_NEWER
+#define GT_GET_DOUBLES(arr) mxGetDoubles(arr)
+#define GT_GET_UINT64S(arr) mxGetUint64s(arr)
+#else
+#define GT_GET_DOUBLES(arr) mxGetPr(arr)
+#define GT_GET_UINT64S(arr) ((UINT64_T*) mxGetData(arr))
+#endif
+
+/** checks if value differs from default value (EPS differs from zero; NaN always differs) */
+static bool gt_transform_differs(
+    double          value,          /** value */
+    double          def             /** default value */
+)
+{
+    return !(value == def) || (value == 0.0 && signbit(value) != signbit(def));
+}
+
+/** checks if value is stored in a sparse matrix (any but +0) */
+static bool gt_transform_stored(
+    double          value           /** value */
+)
+{
+    return value != 0.0 || signbit(value);
+}
+
+/** reads matrix size argument; returns number of elements */
+static size_t gt_transform_get_size(
+    const mxArray*  mx_arr_size,    /** size argument */
+    int             argnum,         /** argument number */
+    size_t*         ndims,          /** output: number of dimensions */
+    mwSize*         sizes           /** output: sizes (GLOBAL_MAX_INDEX_DIM) */
+)
+{
+    size_t n = 1;
+    if (!mxIsDouble(mx_arr_size) || mxGetNumberOfElements(mx_arr_size) > GLOBAL_MAX_INDEX_DIM)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument %d has invalid type: need double size vector", argnum);
+    *ndims = mxGetNumberOfElements(mx_arr_size);
+    for (size_t i = 0; i < *ndims; i++)
+    {
+        double s = GT_GET_DOUBLES(mx_arr_size)[i];
+        if (s < 0 || s != floor(s))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument %d must contain nonnegative integers.", argnum);
+        sizes[i] = (mwSize) s;
+        n *= sizes[i];
+    }
+    return n;
+}
+
+/** returns double column of cell (checks type and length) */
+static double* gt_transform_get_column(
+    const mxArray*  mx_arr_cell,    /** cell */
+    size_t          idx,            /** index in cell */
+    int             argnum,         /** argument number */
+    size_t          len             /** required length */
+)
+{
+    const mxArray* mx_arr = mxGetCell(mx_arr_cell, idx);
+    if (!mx_arr || !mxIsDouble(mx_arr) || mxIsSparse(mx_arr) || mxGetNumberOfElements(mx_arr) != len)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument %d has invalid type: need cell of double "
+            "vectors of length %zu", argnum, len);
+    return GT_GET_DOUBLES(mx_arr);
+}
+
+/** stable counting sort of perm by keys (0 <= key < n_keys) */
+static void gt_transform_counting_sort(
+    size_t          n,              /** number of elements */
+    const size_t*   keys,           /** key per element (indexed by element) */
+    size_t          n_keys,         /** number of keys */
+    size_t*         perm,           /** permutation to be sorted (in / out) */
+    size_t*         buf             /** buffer of n elements */
+)
+{
+    size_t* count = (size_t*) mxCalloc(n_keys + 1, sizeof(size_t));
+    for (size_t i = 0; i < n; i++)
+        count[keys[perm[i]] + 1]++;
+    for (size_t i = 0; i < n_keys; i++)
+        count[i+1] += count[i];
+    for (size_t i = 0; i < n; i++)
+        buf[count[keys[perm[i]]]++] = perm[i];
+    memcpy(perm, buf, n * sizeof(size_t));
+    mxFree(count);
+}
+
+static void gt_transform_to_matrix(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    const mxArray*  prhs[]          /** inputs */
+)
+{
+    size_t ndims, numel, nrecs, nvals, dim;
+    bool sparse;
+    mwSize sizes[GLOBAL_MAX_INDEX_DIM];
+    size_t* lin = NULL;
+    double** values = NULL;
+    double* defaults = NULL;
+
+    if (nrhs != 6)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 6 required.", nrhs);
+    numel = gt_transform_get_size(prhs[2], 3, &ndims, sizes);
+    if (ndims < 2)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 3 must have at least 2 elements.");
+    if (!mxIsCell(prhs[3]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 4 has invalid type: need cell");
+    nvals = mxGetNumberOfElements(prhs[3]);
+    if (!mxIsDouble(prhs[4]) || mxGetNumberOfElements(prhs[4]) != nvals)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 5 has invalid type: need double vector of "
+            "length %zu", nvals);
+    defaults = GT_GET_DOUBLES(prhs[4]);
+    if (!mxIsLogical(prhs[5]) || mxGetNumberOfElements(prhs[5]) != 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 6 has invalid type: need logical scalar");
+    sparse = mxGetLogicals(prhs[5])[0];
+    if (sparse && ndims != 2)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Sparse matrix does not support dimension larger than 2.");
+
+    /* linear (column-major) index of records */
+    if (mxIsCell(prhs[1]))
+    {
+        dim = mxGetNumberOfElements(prhs[1]);
+        if (dim > ndims)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has more elements than argument 3.");
+        nrecs = dim > 0 ? mxGetNumberOfElements(mxGetCell(prhs[1], 0)) : (nvals > 0 ?
+            mxGetNumberOfElements(mxGetCell(prhs[3], 0)) : 0);
+        lin = (size_t*) mxCalloc(nrecs > 0 ? nrecs : 1, sizeof(size_t));
+        for (size_t k = 0, stride = 1; k < dim; k++)
+        {
+            const mxArray* mx_arr_codes = mxGetCell(prhs[1], k);
+            if (!mx_arr_codes || !mxIsUint64(mx_arr_codes) || mxGetNumberOfElements(mx_arr_codes) != nrecs)
+                mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need cell of uint64 "
+                    "vectors of length %zu", nrecs);
+            const UINT64_T* codes = GT_GET_UINT64S(mx_arr_codes);
+            for (size_t j = 0; j < nrecs; j++)
+            {
+                if (codes[j] < 1 || codes[j] > sizes[k])
+                    mexErrMsgIdAndTxt(ERRID"index", "Record %zu has invalid domain index in dimension %zu.",
+                        j + 1, k + 1);
+                lin[j] += (size_t) (codes[j] - 1) * stride;
+            }
+            stride *= sizes[k];
+        }
+    }
+    else
+    {
+        if (!mxIsUint64(prhs[1]))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need cell or uint64");
+        nrecs = mxGetNumberOfElements(prhs[1]);
+        lin = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+        const UINT64_T* index = GT_GET_UINT64S(prhs[1]);
+        for (size_t j = 0; j < nrecs; j++)
+        {
+            if (index[j] < 1 || index[j] > numel)
+                mexErrMsgIdAndTxt(ERRID"index", "Record %zu has invalid linear index.", j + 1);
+            lin[j] = (size_t) (index[j] - 1);
+        }
+    }
+
+    values = (double**) mxCalloc(nvals > 0 ? nvals : 1, sizeof(double*));
+    for (size_t k = 0; k < nvals; k++)
+        values[k] = gt_transform_get_column(prhs[3], k, 4, nrecs);
+
+    plhs[0] = mxCreateCellMatrix(1, nvals);
+
+    if (!sparse)
+    {
+        for (size_t k = 0; k < nvals; k++)
+        {
+            mxArray* mx_arr = mxCreateNumericArray(ndims, sizes, mxDOUBLE_CLASS, mxREAL);
+            double* mx_values = GT_GET_DOUBLES(mx_arr);
+            if (defaults[k] != 0.0 || signbit(defaults[k]))
+                for (size_t i = 0; i < numel; i++)
+                    mx_values[i] = defaults[k];
+            for (size_t j = 0; j < nrecs; j++)
+                mx_values[lin[j]] = values[k][j];
+            mxSetCell(plhs[0], k, mx_arr);
+        }
+    }
+    else
+    {
+        size_t m = sizes[0], n = sizes[1], n_unique = 0;
+        size_t* perm = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+        size_t* buf = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+        size_t* keys = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+        size_t* upos = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+        size_t* urec = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+
+        /* sort records by column, then row (stable: equal positions keep record order) */
+        for (size_t j = 0; j < nrecs; j++)
+        {
+            perm[j] = j;
+            keys[j] = lin[j] % (m > 0 ? m : 1);
+        }
+        gt_transform_counting_sort(nrecs, keys, m, perm, buf);
+        for (size_t j = 0; j < nrecs; j++)
+            keys[j] = lin[j] / (m > 0 ? m : 1);
+        gt_transform_counting_sort(nrecs, keys, n, perm, buf);
+
+        /* unique positions: last record wins */
+        for (size_t j = 0; j < nrecs; j++)
+        {
+            if (n_unique > 0 && upos[n_unique-1] == lin[perm[j]])
+                urec[n_unique-1] = perm[j];
+            else
+            {
+                upos[n_unique] = lin[perm[j]];
+                urec[n_unique++] = perm[j];
+            }
+        }
+
+        for (size_t k = 0; k < nvals; k++)
+        {
+            bool def_stored = gt_transform_stored(defaults[k]);
+            size_t nnz = 0;
+            mxArray* mx_arr;
+            mwIndex* mx_rows;
+            mwIndex* mx_cols;
+            double* mx_values;
+
+            /* count nonzeros */
+            for (size_t u = 0; u < n_unique; u++)
+                if (gt_transform_stored(values[k][urec[u]]))
+                    nnz++;
+            if (def_stored)
+                nnz += m * n - n_unique;
+
+            mx_arr = mxCreateSparse(m, n, nnz > 0 ? nnz : 1, mxREAL);
+            mx_rows = mxGetIr(mx_arr);
+            mx_cols = mxGetJc(mx_arr);
+            mx_values = GT_GET_DOUBLES(mx_arr);
+
+            /* fill column by column */
+            nnz = 0;
+            mx_cols[0] = 0;
+            for (size_t c = 0, u = 0; c < n; c++)
+            {
+                if (def_stored)
+                {
+                    for (size_t r = 0; r < m; r++)
+                    {
+                        double value = defaults[k];
+                        if (u < n_unique && upos[u] == c * m + r)
+                            value = values[k][urec[u++]];
+                        if (!gt_transform_stored(value))
+                            continue;
+                        mx_rows[nnz] = r;
+                        mx_values[nnz++] = value;
+                    }
+                }
+                else
+                {
+                    for (; u < n_unique && upos[u] < (c + 1) * m; u++)
+                    {
+                        double value = values[k][urec[u]];
+                        if (!gt_transform_stored(value))
+                            continue;
+                        mx_rows[nnz] = upos[u] - c * m;
+                        mx_values[nnz++] = value;
+                    }
+                }
+                mx_cols[c+1] = nnz;
+            }
+            mxSetCell(plhs[0], k, mx_arr);
+        }
+
+        mxFree(urec);
+        mxFree(upos);
+        mxFree(keys);
+        mxFree(buf);
+        mxFree(perm);
+    }
+
+    mxFree(values);
+    mxFree(lin);
+}
+
+static void gt_transform_to_tabular(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    const mxArray*  prhs[]          /** inputs */
+)
+{
+    size_t ndims, numel, nvals, dim, nrecs;
+    bool sparse;
+    mwSize sizes[GLOBAL_MAX_INDEX_DIM];
+    size_t strides[GLOBAL_MAX_INDEX_DIM];
+    size_t idx[GLOBAL_MAX_INDEX_DIM];
+    const mxArray** mx_arr_matrices = NULL;
+    double* defaults = NULL;
+    double** mx_indices = NULL;
+    double** mx_values = NULL;
+
+    if (nrhs != 5)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 5 required.", nrhs);
+    if (!mxIsCell(prhs[1]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need cell");
+    nvals = mxGetNumberOfElements(prhs[1]);
+    numel = gt_transform_get_size(prhs[2], 3, &ndims, sizes);
+    if (!mxIsDouble(prhs[3]) || mxGetNumberOfElements(prhs[3]) != nvals)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 4 has invalid type: need double vector of "
+            "length %zu", nvals);
+    defaults = GT_GET_DOUBLES(prhs[3]);
+    if (!mxIsDouble(prhs[4]) || mxGetNumberOfElements(prhs[4]) != 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 5 has invalid type: need double scalar");
+    dim = (size_t) mxGetScalar(prhs[4]);
+    if (dim > ndims)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 5 exceeds number of elements of argument 3.");
+
+    mx_arr_matrices = (const mxArray**) mxCalloc(nvals > 0 ? nvals : 1, sizeof(*mx_arr_matrices));
+    sparse = false;
+    for (size_t k = 0; k < nvals; k++)
+    {
+        mx_arr_matrices[k] = mxGetCell(prhs[1], k);
+        if (!mx_arr_matrices[k] || !mxIsDouble(mx_arr_matrices[k]) ||
+            mxGetNumberOfElements(mx_arr_matrices[k]) != numel)
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need cell of double "
+                "matrices with %zu elements", numel);
+        if (k == 0)
+            sparse = mxIsSparse(mx_arr_matrices[k]);
+        else if (sparse != mxIsSparse(mx_arr_matrices[k]))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 must not mix dense and sparse matrices.");
+        if (sparse && (ndims != 2 || mxGetM(mx_arr_matrices[k]) != sizes[0]))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Sparse matrix does not support dimension larger than 2.");
+    }
+
+    for (size_t k = 0, s = 1; k < ndims; k++)
+    {
+        strides[k] = s;
+        s *= sizes[k];
+    }
+
+    plhs[0] = mxCreateCellMatrix(1, dim);
+    plhs[1] = mxCreateCellMatrix(1, nvals);
+    mx_indices = (double**) mxCalloc(dim > 0 ? dim : 1, sizeof(double*));
+    mx_values = (double**) mxCalloc(nvals > 0 ? nvals : 1, sizeof(double*));
+
+    if (!sparse)
+    {
+        const double** values = (const double**) mxCalloc(nvals > 0 ? nvals : 1, sizeof(double*));
+        for (size_t k = 0; k < nvals; k++)
+            values[k] = GT_GET_DOUBLES(mx_arr_matrices[k]);
+
+        /* visit entries in row-major order (last dimension fastest); pass 0 counts, pass 1 stores */
+        for (int pass = 0; pass < 2; pass++)
+        {
+            size_t j = 0, lin = 0;
+            memset(idx, 0, sizeof(idx));
+            for (size_t i = 0; i < numel; i++)
+            {
+                bool keep = false;
+                for (size_t k = 0; k < nvals && !keep; k++)
+                    keep = gt_transform_differs(values[k][lin], defaults[k]);
+                if (keep && pass == 1)
+                {
+                    for (size_t d = 0; d < dim; d++)
+                        mx_indices[d][j] = (double) (idx[d] + 1);
+                    for (size_t k = 0; k < nvals; k++)
+                        mx_values[k][j] = values[k][lin];
+                }
+                if (keep)
+                    j++;
+
+                /* next row-major index */
+                for (size_t d1 = ndims; d1 > 0; d1--)
+                {
+                    size_t d = d1 - 1;
+                    if (++idx[d] < sizes[d])
+                    {
+                        lin += strides[d];
+                        break;
+                    }
+                    lin -= (sizes[d] - 1) * strides[d];
+                    idx[d] = 0;
+                }
+            }
+
+            if (pass == 0)
+            {
+                nrecs = j;
+                for (size_t d = 0; d < dim; d++)
+                {
+                    mxArray* mx_arr = mxCreateDoubleMatrix(nrecs, 1, mxREAL);
+                    mx_indices[d] = GT_GET_DOUBLES(mx_arr);
+                    mxSetCell(plhs[0], d, mx_arr);
+                }
+                for (size_t k = 0; k < nvals; k++)
+                {
+                    mxArray* mx_arr = mxCreateDoubleMatrix(nrecs, 1, mxREAL);
+                    mx_values[k] = GT_GET_DOUBLES(mx_arr);
+                    mxSetCell(plhs[1], k, mx_arr);
+                }
+            }
+        }
+        mxFree((void*) values);
+    }
+    else
+    {
+        size_t m = sizes[0], n = sizes[1], max_nnz = 0, n_entries = 0;
+        bool all_rows = false;
+        size_t* ptr = (size_t*) mxCalloc(nvals > 0 ? nvals : 1, sizeof(size_t));
+        size_t* rows;
+        size_t* cols;
+        size_t* perm;
+        size_t* buf;
+        double* entries;
+
+        /* entries of union pattern (all positions if a default is stored in sparse matrices) */
+        for (size_t k = 0; k < nvals; k++)
+        {
+            max_nnz += mxGetJc(mx_arr_matrices[k])[n];
+            all_rows = all_rows || gt_transform_stored(defaults[k]);
+        }
+        if (all_rows)
+            max_nnz = m * n;
+        rows = (size_t*) mxMalloc((max_nnz > 0 ? max_nnz : 1) * sizeof(size_t));
+        cols = (size_t*) mxMalloc((max_nnz > 0 ? max_nnz : 1) * sizeof(size_t));
+        perm = (size_t*) mxMalloc((max_nnz > 0 ? max_nnz : 1) * sizeof(size_t));
+        buf = (size_t*) mxMalloc((max_nnz > 0 ? max_nnz : 1) * sizeof(size_t));
+        entries = (double*) mxMalloc((max_nnz > 0 ? max_nnz : 1) * (nvals > 0 ? nvals : 1) * sizeof(double));
+
+        /* merge columns of all matrices (column-major) and keep entries that differ */
+        for (size_t c = 0; c < n; c++)
+        {
+            for (size_t k = 0; k < nvals; k++)
+                ptr[k] = mxGetJc(mx_arr_matrices[k])[c];
+            for (size_t r = 0; r < m; )
+            {
+                bool keep = false;
+                size_t next = m;
+
+                /* next row with stored entry */
+                if (!all_rows)
+                {
+                    for (size_t k = 0; k < nvals; k++)
+                        if (ptr[k] < mxGetJc(mx_arr_matrices[k])[c+1] && mxGetIr(mx_arr_matrices[k])[ptr[k]] < next)
+                            next = mxGetIr(mx_arr_matrices[k])[ptr[k]];
+                    if (next >= m)
+                        break;
+                    r = next;
+                }
+
+                for (size_t k = 0; k < nvals; k++)
+                {
+                    double value = 0.0;
+                    if (ptr[k] < mxGetJc(mx_arr_matrices[k])[c+1] && mxGetIr(mx_arr_matrices[k])[ptr[k]] == r)
+                        value = GT_GET_DOUBLES(mx_arr_matrices[k])[ptr[k]++];
+                    entries[n_entries * nvals + k] = value;
+                    keep = keep || gt_transform_differs(value, defaults[k]);
+                }
+                if (keep)
+                {
+                    rows[n_entries] = r;
+                    cols[n_entries] = c;
+                    perm[n_entries] = n_entries;
+                    n_entries++;
+                }
+                r++;
+            }
+        }
+
+        /* row-major order: stable sort by row (columns are ascending already) */
+        gt_transform_counting_sort(n_entries, rows, m, perm, buf);
+
+        for (size_t d = 0; d < dim; d++)
+        {
+            mxArray* mx_arr = mxCreateDoubleMatrix(n_entries, 1, mxREAL);
+            mx_indices[d] = GT_GET_DOUBLES(mx_arr);
+            mxSetCell(plhs[0], d, mx_arr);
+        }
+        for (size_t k = 0; k < nvals; k++)
+        {
+            mxArray* mx_arr = mxCreateDoubleMatrix(n_entries, 1, mxREAL);
+            mx_values[k] = GT_GET_DOUBLES(mx_arr);
+            mxSetCell(plhs[1], k, mx_arr);
+        }
+        for (size_t j = 0; j < n_entries; j++)
+        {
+            if (dim > 0)
+                mx_indices[0][j] = (double) (rows[perm[j]] + 1);
+            if (dim > 1)
+                mx_indices[1][j] = (double) (cols[perm[j]] + 1);
+            for (size_t k = 0; k < nvals; k++)
+                mx_values[k][j] = entries[perm[j] * nvals + k];
+        }
+
+        mxFree(entries);
+        mxFree(buf);
+        mxFree(perm);
+        mxFree(cols);
+        mxFree(rows);
+        mxFree(ptr);
+    }
+
+    mxFree(mx_values);
+    mxFree(mx_indices);
+    mxFree((void*) mx_arr_matrices);
+}
+
+static void gt_transform_tensor(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    const mxArray*  prhs[]          /** inputs */
+)
+{
+    size_t ndims, numel, nrecs, dim;
+    mwSize sizes[GLOBAL_MAX_INDEX_DIM];
+    size_t* codes = NULL;
+    size_t* keys = NULL;
+    size_t* perm = NULL;
+    size_t* buf = NULL;
+    const UINT64_T* index = NULL;
+    double* mx_perm = NULL;
+
+    if (nrhs != 4)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 4 required.", nrhs);
+    if (!mxIsUint64(prhs[1]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 2 has invalid type: need uint64");
+    numel = gt_transform_get_size(prhs[2], 3, &ndims, sizes);
+    if (!mxIsDouble(prhs[3]) || mxGetNumberOfElements(prhs[3]) != 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 4 has invalid type: need double scalar");
+    dim = (size_t) mxGetScalar(prhs[3]);
+    if (dim > ndims)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 4 exceeds number of elements of argument 3.");
+
+    nrecs = mxGetNumberOfElements(prhs[1]);
+    index = GT_GET_UINT64S(prhs[1]);
+    for (size_t j = 0; j < nrecs; j++)
+        if (index[j] < 1 || index[j] > numel)
+            mexErrMsgIdAndTxt(ERRID"index", "Record %zu has invalid linear index.", j + 1);
+
+    /* decode domain codes (0-based) per dimension */
+    codes = (size_t*) mxMalloc((nrecs * dim > 0 ? nrecs * dim : 1) * sizeof(size_t));
+    for (size_t j = 0; j < nrecs; j++)
+    {
+        size_t lin = (size_t) (index[j] - 1);
+        for (size_t d = 0; d < dim; d++)
+        {
+            codes[d * nrecs + j] = lin % sizes[d];
+            lin /= sizes[d];
+        }
+    }
+
+    /* row-major order: stable counting sorts from last to first dimension */
+    perm = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+    buf = (size_t*) mxMalloc((nrecs > 0 ? nrecs : 1) * sizeof(size_t));
+    for (size_t j = 0; j < nrecs; j++)
+        perm[j] = j;
+    for (size_t d1 = dim; d1 > 0; d1--)
+    {
+        keys = &codes[(d1 - 1) * nrecs];
+        gt_transform_counting_sort(nrecs, keys, sizes[d1-1], perm, buf);
+    }
+
+    plhs[0] = mxCreateCellMatrix(1, dim);
+    for (size_t d = 0; d < dim; d++)
+    {
+        mxArray* mx_arr = mxCreateDoubleMatrix(nrecs, 1, mxREAL);
+        double* mx_codes = GT_GET_DOUBLES(mx_arr);
+        for (size_t j = 0; j < nrecs; j++)
+            mx_codes[j] = (double) (codes[d * nrecs + perm[j]] + 1);
+        mxSetCell(plhs[0], d, mx_arr);
+    }
+    if (nlhs > 1)
+    {
+        plhs[1] = mxCreateDoubleMatrix(nrecs, 1, mxREAL);
+        mx_perm = GT_GET_DOUBLES(plhs[1]);
+        for (size_t j = 0; j < nrecs; j++)
+            mx_perm[j] = (double) (perm[j] + 1);
+    }
+
+    mxFree(buf);
+    mxFree(perm);
+    mxFree(codes);
+}
+
+void mexFunction(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    char mode[8];
+
+    if (nlhs > 2)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of outputs (%d). 0 to 2 required.", nlhs);
+    if (nrhs < 1 || !mxIsChar(prhs[0]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need char");
+    mxGetString(prhs[0], mode, 8);
+
+    if (!strcmp(mode, "matrix"))
+        gt_transform_to_matrix(nlhs, plhs, nrhs, prhs);
+    else if (!strcmp(mode, "tabular"))
+        gt_transform_to_tabular(nlhs, plhs, nrhs, prhs);
+    else if (!strcmp(mode, "tensor"))
+        gt_transform_tensor(nlhs, plhs, nrhs, prhs);
+    else
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 must be one of the following: matrix, "
+            "tabular, tensor.");
+}
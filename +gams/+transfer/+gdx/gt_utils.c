@@ -37,6 +37,7 @@
 #include <windows.h>
 typedef DWORD64 UINT64;
 #else
+#include <time.h>
 typedef unsigned long long int UINT64;
 #endif
 
@@ -58,6 +59,12 @@ typedef signed long long int INT64;
 #define GT_IS_NAN(x) (!((x) == (x)))
 #endif
 
+/* largest tensor size with exact linear indices in doubles */
+#define GT_TENSOR_MAX_NUMEL (((UINT64) 1) << 53)
+
+/* bit pattern of GAMS NA */
+#define GT_NA_BITS ((((UINT64) 0xffffffff) << 32) | 0xfffffffe)
+
 typedef union rec64 {
   INT64 i64;
   double x;
@@ -70,12 +77,24 @@ typedef struct gt_domain_sort
     int* domain_uels;
 } gt_domain_sort_t;
 
+typedef struct gt_tensor_sort
+{
+    UINT64 key;
+    size_t idx;
+} gt_tensor_sort_t;
+
 /** comparison function for sorting gt_domain_sort_t */
 static int gt_utils_domain_sort_comp(
     const void*     a,
     const void*     b
 );
 
+/** comparison function for sorting gt_tensor_sort_t */
+static int gt_utils_tensor_sort_comp(
+    const void*     a,
+    const void*     b
+);
+
 double gt_utils_getna(void)
 {
     rec64_t na;
@@ -89,14 +108,11 @@ bool gt_utils_isna(
     double          x               /** value to be checked for NA */
 )
 {
-    rec64_t r64, na;
+    rec64_t r64;
     if (!GT_IS_NAN(x))
         return false;
     r64.x = x;
-    na.i64 = 0xffffffff;
-    na.i64 = na.i64 << 32;
-    na.i64 |= 0xfffffffe;
-    return na.i64 == r64.i64;
+    return (UINT64) r64.i64 == GT_NA_BITS;
 }
 
 double gt_utils_geteps(void)
@@ -111,6 +127,128 @@ bool gt_utils_iseps(
     return x == 0.0 && signbit(x);
 }
 
+double gt_utils_wtime(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double) count.QuadPart / (double) freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + 1e-9 * (double) ts.tv_nsec;
+#endif
+}
+
+/* alignment of arena allocations */
+#define GT_ARENA_ALIGN 16
+#define GT_ARENA_ROUND(n) (((n) + GT_ARENA_ALIGN - 1) & ~((size_t) GT_ARENA_ALIGN - 1))
+#define GT_ARENA_HEADER GT_ARENA_ROUND(sizeof(GT_ARENA_BLOCK))
+
+void gt_arena_init(
+    GT_ARENA*       arena,          /** arena */
+    size_t          min_block_size, /** minimal usable bytes of a block */
+    size_t          max_keep_size   /** maximal usable bytes kept for reuse on reset */
+)
+{
+    arena->block = NULL;
+    arena->min_block_size = GT_ARENA_ROUND(min_block_size);
+    arena->max_keep_size = MAX(max_keep_size, arena->min_block_size);
+}
+
+void* gt_arena_malloc(
+    GT_ARENA*       arena,          /** arena */
+    size_t          n,              /** number of elements */
+    size_t          size            /** size of an element */
+)
+{
+    GT_ARENA_BLOCK* block = arena->block;
+    size_t bytes;
+    char* ptr;
+
+    if (size > 0 && n > ((size_t) -1 - GT_ARENA_HEADER - GT_ARENA_ALIGN) / size)
+        mexErrMsgIdAndTxt(ERRID"arena", "Allocation size overflow.");
+    bytes = GT_ARENA_ROUND(n * size);
+
+    /* new block if current one is full; blocks are allocated on the Matlab heap such that
+     * Matlab releases them in case of an error */
+    if (!block || block->size - block->used < bytes)
+    {
+        size_t block_size = MAX(bytes, arena->min_block_size);
+        if (block)
+            block_size = MAX(block_size, 2 * block->size);
+        block = (GT_ARENA_BLOCK*) mxMalloc(GT_ARENA_HEADER + block_size);
+        block->next = arena->block;
+        block->size = block_size;
+        block->used = 0;
+        arena->block = block;
+    }
+
+    ptr = (char*) block + GT_ARENA_HEADER + block->used;
+    block->used += bytes;
+    return ptr;
+}
+
+void* gt_arena_calloc(
+    GT_ARENA*       arena,          /** arena */
+    size_t          n,              /** number of elements */
+    size_t          size            /** size of an element */
+)
+{
+    void* ptr = gt_arena_malloc(arena, n, size);
+    memset(ptr, 0, n * size);
+    return ptr;
+}
+
+void gt_arena_reset(
+    GT_ARENA*       arena           /** arena */
+)
+{
+    GT_ARENA_BLOCK* block = arena->block;
+    size_t total = 0;
+
+    if (!block)
+        return;
+    for (; block; block = block->next)
+        total += block->size;
+
+    /* give memory of a single large allocation (e.g. a huge symbol) back instead of keeping it
+     * for all following (typically small) symbols */
+    if (total > arena->max_keep_size)
+    {
+        gt_arena_free(arena);
+        return;
+    }
+    if (!arena->block->next)
+    {
+        arena->block->used = 0;
+        return;
+    }
+
+    /* merge blocks into one such that the next round of allocations fits into one block */
+    gt_arena_free(arena);
+    arena->block = (GT_ARENA_BLOCK*) mxMalloc(GT_ARENA_HEADER + total);
+    arena->block->next = NULL;
+    arena->block->size = total;
+    arena->block->used = 0;
+}
+
+void gt_arena_free(
+    GT_ARENA*       arena           /** arena */
+)
+{
+    GT_ARENA_BLOCK* block = arena->block;
+
+    while (block)
+    {
+        GT_ARENA_BLOCK* next = block->next;
+        mxFree(block);
+        block = next;
+    }
+    arena->block = NULL;
+}
+
 double gt_utils_sv_gams2matlab(
     double          value,          /** original value */
     int             n_acronyms,     /** number of acronyms */
@@ -372,15 +510,17 @@ void gt_utils_sort_domains(
 #endif
 {
     gt_domain_sort_t* sortrecs = NULL;
+    int* domain_uels = NULL;
 
-    sortrecs = (gt_domain_sort_t*) mxMalloc(nrecs * sizeof(gt_domain_sort_t));
+    sortrecs = (gt_domain_sort_t*) mxMalloc(MAX(nrecs, 1) * sizeof(gt_domain_sort_t));
+    domain_uels = (int*) mxMalloc(MAX(nrecs * dim, 1) * sizeof(int));
 
     /* init sort records */
     for (size_t i = 0; i < nrecs; i++)
     {
         sortrecs[i].dim = dim;
         sortrecs[i].idx = idx[i];
-        sortrecs[i].domain_uels = (int*) mxMalloc(dim * sizeof(int));
+        sortrecs[i].domain_uels = domain_uels + i * dim;
         if (n_dom_uels && dom_uel_ids)
             for (size_t j = 0; j < dim; j++)
             {
@@ -406,8 +546,7 @@ void gt_utils_sort_domains(
         idx[i] = sortrecs[i].idx;
 
     /* free memory */
-    for (size_t i = 0; i < nrecs; i++)
-        mxFree(sortrecs[i].domain_uels);
+    mxFree(domain_uels);
     mxFree(sortrecs);
 }
 
@@ -434,3 +573,108 @@ static int gt_utils_domain_sort_comp(
 
     return 0;
 }
+
+void gt_utils_check_tensor_shape(
+    const char*     symname,        /** name of symbol */
+    size_t          dim,            /** dimension of symbol */
+    const size_t*   sizes           /** shape of tensor (length: dim) */
+)
+{
+    UINT64 numel = 1;
+
+    for (size_t j = 0; j < dim; j++)
+    {
+        if (sizes[j] == 0)
+            return;
+        if (numel > GT_TENSOR_MAX_NUMEL / sizes[j])
+            numel = GT_TENSOR_MAX_NUMEL + 1;
+        else
+            numel *= sizes[j];
+    }
+    if (numel > GT_TENSOR_MAX_NUMEL)
+        mexErrMsgIdAndTxt(ERRID"check_tensor_shape", "Symbol '%s' has a tensor "
+            "shape with more than 2^53 elements. Linear indices would not be exact.", symname);
+}
+
+#ifdef WITH_R2018A_OR_NEWER
+void gt_utils_sort_tensor_index(
+    const char*     symname,        /** name of symbol */
+    size_t          nrecs,          /** number of records */
+    size_t          dim,            /** dimension of symbol */
+    size_t*         sizes,          /** shape of tensor (length: dim) */
+    mxUint64*       mx_index,       /** linear (column-major) tensor index (length: nrecs) */
+    size_t*         idx             /** index (length: nrecs; assumed to hold initial indexing) */
+)
+#else
+void gt_utils_sort_tensor_index(
+    const char*     symname,        /** name of symbol */
+    size_t          nrecs,          /** number of records */
+    size_t          dim,            /** dimension of symbol */
+    size_t*         sizes,          /** shape of tensor (length: dim) */
+    UINT64_T*       mx_index,       /** linear (column-major) tensor index (length: nrecs) */
+    size_t*         idx             /** index (length: nrecs; assumed to hold initial indexing) */
+)
+#endif
+{
+    size_t pos[GLOBAL_MAX_INDEX_DIM];
+    gt_tensor_sort_t* sortrecs = NULL;
+
+    gt_utils_check_tensor_shape(symname, dim, sizes);
+
+    sortrecs = (gt_tensor_sort_t*) mxMalloc(MAX(nrecs, 1) * sizeof(gt_tensor_sort_t));
+
+    /* init sort records: column-major index to row-major key */
+    for (size_t i = 0; i < nrecs; i++)
+    {
+        UINT64 lin = mx_index[idx[i]];
+
+        if (lin < 1)
+            mexErrMsgIdAndTxt(ERRID"sort_tensor_index", "Symbol '%s' has "
+                "invalid tensor index: %d.", symname, (int) lin);
+        lin--;
+        for (size_t j = 0; j < dim; j++)
+        {
+            if (sizes[j] == 0)
+                mexErrMsgIdAndTxt(ERRID"sort_tensor_index", "Symbol '%s' has "
+                    "tensor index out of shape.", symname);
+            pos[j] = lin % sizes[j];
+            lin /= sizes[j];
+        }
+        if (lin > 0)
+            mexErrMsgIdAndTxt(ERRID"sort_tensor_index", "Symbol '%s' has "
+                "tensor index out of shape.", symname);
+
+        sortrecs[i].idx = idx[i];
+        sortrecs[i].key = 0;
+        for (size_t j = 0; j < dim; j++)
+            sortrecs[i].key = sortrecs[i].key * sizes[j] + pos[j];
+    }
+
+    /* sort */
+    qsort(sortrecs, nrecs, sizeof(gt_tensor_sort_t), gt_utils_tensor_sort_comp);
+
+    /* get sorted indices */
+    for (size_t i = 0; i < nrecs; i++)
+        idx[i] = sortrecs[i].idx;
+
+    mxFree(sortrecs);
+}
+
+static int gt_utils_tensor_sort_comp(
+    const void*     a,
+    const void*     b
+)
+{
+    gt_tensor_sort_t* x = (gt_tensor_sort_t*) a;
+    gt_tensor_sort_t* y = (gt_tensor_sort_t*) b;
+
+    if (x->key < y->key)
+        return -1;
+    if (x->key > y->key)
+        return 1;
+    if (x->idx < y->idx)
+        return -1;
+    if (x->idx > y->idx)
+        return 1;
+    return 0;
+}
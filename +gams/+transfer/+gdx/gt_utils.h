@@ -40,6 +40,7 @@ typedef enum
     GT_FORMAT_DENSEMAT = 3,
     GT_FORMAT_SPARSEMAT = 4,
     GT_FORMAT_TABLE = 5,
+    GT_FORMAT_SPARSETENSOR = 6,
 } GT_FORMAT;
 
 typedef enum
@@ -49,6 +50,22 @@ typedef enum
     GT_FILTER_BOOL,
 } GT_FILTER;
 
+/** memory block of arena allocator */
+typedef struct gt_arena_block
+{
+    struct gt_arena_block* next;    /** next (older) block */
+    size_t          size;           /** usable bytes of block */
+    size_t          used;           /** used bytes of block */
+} GT_ARENA_BLOCK;
+
+/** bump allocator for scratch data that is released at once (e.g. per symbol) */
+typedef struct
+{
+    GT_ARENA_BLOCK* block;          /** current block (NULL: none) */
+    size_t          min_block_size; /** minimal usable bytes of a new block */
+    size_t          max_keep_size;  /** maximal usable bytes kept for reuse on reset */
+} GT_ARENA;
+
 /* min of two values */
 #define MIN(a,b) (((a) > (b)) ? (b) : (a))
 /* max of two values */
@@ -74,6 +91,41 @@ bool gt_utils_iseps(
     double          x               /** value to be checked for EPS */
 );
 
+/** returns wall clock time in seconds (arbitrary origin, monotonic) */
+double gt_utils_wtime(void);
+
+/** initializes arena without allocating memory */
+void gt_arena_init(
+    GT_ARENA*       arena,          /** arena */
+    size_t          min_block_size, /** minimal usable bytes of a block */
+    size_t          max_keep_size   /** maximal usable bytes kept for reuse on reset */
+);
+
+/** returns uninitialized memory for n elements of given size from arena (like mxMalloc) */
+void* gt_arena_malloc(
+    GT_ARENA*       arena,          /** arena */
+    size_t          n,              /** number of elements */
+    size_t          size            /** size of an element */
+);
+
+/** returns zero initialized memory for n elements of given size from arena (like mxCalloc) */
+void* gt_arena_calloc(
+    GT_ARENA*       arena,          /** arena */
+    size_t          n,              /** number of elements */
+    size_t          size            /** size of an element */
+);
+
+/** releases all allocations of arena; keeps memory of the same total size for reuse unless it
+ *  exceeds the high-water limit max_keep_size, in which case all memory is released */
+void gt_arena_reset(
+    GT_ARENA*       arena           /** arena */
+);
+
+/** releases all memory of arena */
+void gt_arena_free(
+    GT_ARENA*       arena           /** arena */
+);
+
 /** translates GAMS double values to Matlab double values */
 double gt_utils_sv_gams2matlab(
     double          value,          /** original value */
@@ -149,6 +201,34 @@ void gt_utils_sort_domains(
 );
 #endif
 
+/** checks that a linear index into a tensor of the given shape is exact in doubles (< 2^53) */
+void gt_utils_check_tensor_shape(
+    const char*     symname,        /** name of symbol */
+    size_t          dim,            /** dimension of symbol */
+    const size_t*   sizes           /** shape of tensor (length: dim) */
+);
+
+/** sort sparse tensor records in row-major (GDX) order of their linear index */
+#ifdef WITH_R2018A_OR_NEWER
+void gt_utils_sort_tensor_index(
+    const char*     symname,        /** name of symbol */
+    size_t          nrecs,          /** number of records */
+    size_t          dim,            /** dimension of symbol */
+    size_t*         sizes,          /** shape of tensor (length: dim) */
+    mxUint64*       mx_index,       /** linear (column-major) tensor index (length: nrecs) */
+    size_t*         idx             /** index (length: nrecs; assumed to hold initial indexing) */
+);
+#else
+void gt_utils_sort_tensor_index(
+    const char*     symname,        /** name of symbol */
+    size_t          nrecs,          /** number of records */
+    size_t          dim,            /** dimension of symbol */
+    size_t*         sizes,          /** shape of tensor (length: dim) */
+    UINT64_T*       mx_index,       /** linear (column-major) tensor index (length: nrecs) */
+    size_t*         idx             /** index (length: nrecs; assumed to hold initial indexing) */
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
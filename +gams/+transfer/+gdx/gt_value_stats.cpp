@@ -0,0 +1,393 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Statistics of value columns
+ *
+ * Usage:
+ *   stats = gt_value_stats(columns)
+ *
+ * columns is a cell of double arrays (dense or sparse). stats is a 1 x numel(columns)
+ * struct array with the following fields per column:
+ *   count          number of elements (including implicit zeros of sparse arrays)
+ *   sum            sum of all elements (NaN if any element is NaN)
+ *   min, max       smallest / largest element ignoring NaN (NaN if all are NaN)
+ *   max_abs        largest absolute element ignoring NaN (NaN if all are NaN)
+ *   where_min, where_max, where_max_abs
+ *                  linear index of first occurrence (1 if all elements are NaN, 0 if
+ *                  column is empty), like Matlab's min and max
+ *   na, undef, eps, posinf, neginf
+ *                  number of GAMS special values
+ *
+ * All statistics are computed in a single pass. Large inputs are split into chunks
+ * that are processed by several threads.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "mex.h"
+#include "gt_utils.h"
+
+#define ERRID "gams:transfer:cmex:gt_value_stats:"
+
+/** minimal number of elements to use several threads */
+#define GT_STATS_PARALLEL_MIN 1000000
+
+/** maximal number of elements of one chunk */
+#define GT_STATS_CHUNK_SIZE 262144
+
+/** maximal number of threads */
+#define GT_STATS_MAX_THREADS 16
+
+/** statistics of (a part of) a column */
+typedef struct
+{
+    double          sum;            /** sum of elements */
+    double          min;            /** smallest element */
+    double          max;            /** largest element */
+    double          max_abs;        /** largest absolute element */
+    size_t          where_min;      /** linear index of min (0-based) */
+    size_t          where_max;      /** linear index of max (0-based) */
+    size_t          where_max_abs;  /** linear index of max_abs (0-based) */
+    bool            has_value;      /** found element that is not NaN */
+    size_t          n_na;           /** number of NA */
+    size_t          n_undef;        /** number of UNDEF (other NaN) */
+    size_t          n_eps;          /** number of EPS */
+    size_t          n_posinf;       /** number of PINF */
+    size_t          n_neginf;       /** number of MINF */
+} GT_STATS;
+
+/** part of a column processed at once */
+typedef struct
+{
+    size_t          column;         /** column index */
+    const double*   values;         /** values (dense) or stored values (sparse) */
+    const mwIndex*  rows;           /** row indices of stored values (sparse) or NULL */
+    const mwIndex*  cols;           /** column starts of stored values (sparse) or NULL */
+    size_t          nrows;          /** number of rows (sparse) */
+    size_t          begin;          /** first element */
+    size_t          end;            /** last element + 1 */
+    GT_STATS        stats;          /** statistics of chunk */
+} GT_STATS_CHUNK;
+
+static void gt_stats_init(
+    GT_STATS*       stats           /** statistics */
+)
+{
+    memset(stats, 0, sizeof(GT_STATS));
+    stats->min = stats->max = stats->max_abs = NAN;
+}
+
+/** adds element to statistics (elements must be added in ascending index order) */
+static inline void gt_stats_add(
+    GT_STATS*       stats,          /** statistics */
+    double          value,          /** element */
+    size_t          index           /** linear index of element */
+)
+{
+    stats->sum += value;
+    if (value != value)
+    {
+        if (gt_utils_isna(value))
+            stats->n_na++;
+        else
+            stats->n_undef++;
+        return;
+    }
+    if (value == 0.0 && signbit(value))
+        stats->n_eps++;
+    else if (value == INFINITY)
+        stats->n_posinf++;
+    else if (value == -INFINITY)
+        stats->n_neginf++;
+
+    if (!stats->has_value)
+    {
+        stats->has_value = true;
+        stats->min = stats->max = value;
+        stats->max_abs = fabs(value);
+        stats->where_min = stats->where_max = stats->where_max_abs = index;
+        return;
+    }
+    if (value < stats->min)
+    {
+        stats->min = value;
+        stats->where_min = index;
+    }
+    if (value > stats->max)
+    {
+        stats->max = value;
+        stats->where_max = index;
+    }
+    if (fabs(value) > stats->max_abs)
+    {
+        stats->max_abs = fabs(value);
+        stats->where_max_abs = index;
+    }
+}
+
+/** merges statistics (ties are resolved by the smaller index) */
+static void gt_stats_merge(
+    GT_STATS*       stats,          /** statistics (in / out) */
+    const GT_STATS* other           /** statistics to be merged */
+)
+{
+    stats->sum += other->sum;
+    stats->n_na += other->n_na;
+    stats->n_undef += other->n_undef;
+    stats->n_eps += other->n_eps;
+    stats->n_posinf += other->n_posinf;
+    stats->n_neginf += other->n_neginf;
+    if (!other->has_value)
+        return;
+    if (!stats->has_value)
+    {
+        stats->has_value = true;
+        stats->min = other->min;
+        stats->max = other->max;
+        stats->max_abs = other->max_abs;
+        stats->where_min = other->where_min;
+        stats->where_max = other->where_max;
+        stats->where_max_abs = other->where_max_abs;
+        return;
+    }
+    if (other->min < stats->min || (other->min == stats->min && other->where_min < stats->where_min))
+    {
+        stats->min = other->min;
+        stats->where_min = other->where_min;
+    }
+    if (other->max > stats->max || (other->max == stats->max && other->where_max < stats->where_max))
+    {
+        stats->max = other->max;
+        stats->where_max = other->where_max;
+    }
+    if (other->max_abs > stats->max_abs || (other->max_abs == stats->max_abs &&
+        other->where_max_abs < stats->where_max_abs))
+    {
+        stats->max_abs = other->max_abs;
+        stats->where_max_abs = other->where_max_abs;
+    }
+}
+
+static void gt_stats_chunk(
+    GT_STATS_CHUNK* chunk           /** chunk */
+)
+{
+    gt_stats_init(&chunk->stats);
+    if (!chunk->rows)
+    {
+        for (size_t i = chunk->begin; i < chunk->end; i++)
+            gt_stats_add(&chunk->stats, chunk->values[i], i);
+        return;
+    }
+    for (size_t c = 0; chunk->cols[c] < chunk->end; c++)
+        for (size_t p = chunk->cols[c]; p < chunk->cols[c+1]; p++)
+            gt_stats_add(&chunk->stats, chunk->values[p], c * chunk->nrows + chunk->rows[p]);
+}
+
+static void gt_stats_worker(
+    GT_STATS_CHUNK* chunks,         /** chunks */
+    size_t          n_chunks,       /** number of chunks */
+    std::atomic<size_t>* next       /** next chunk to be processed */
+)
+{
+    for (size_t i = (*next)++; i < n_chunks; i = (*next)++)
+        gt_stats_chunk(&chunks[i]);
+}
+
+/** returns linear index of first implicit zero of sparse array */
+static size_t gt_stats_first_zero(
+    const mxArray*  mx_arr          /** sparse array */
+)
+{
+    const mwIndex* rows = mxGetIr(mx_arr);
+    const mwIndex* cols = mxGetJc(mx_arr);
+    size_t m = mxGetM(mx_arr);
+    for (size_t c = 0; c < mxGetN(mx_arr); c++)
+    {
+        size_t r = 0;
+        if (cols[c+1] - cols[c] == m)
+            continue;
+        for (size_t p = cols[c]; p < cols[c+1] && rows[p] == r; p++)
+            r++;
+        return c * m + r;
+    }
+    return 0;
+}
+
+void mexFunction(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    size_t n_columns, n_chunks = 0, n_elements = 0, n_threads = 1;
+    GT_STATS_CHUNK* chunks = NULL;
+    GT_STATS* stats = NULL;
+    std::atomic<size_t> next(0);
+    const char* fields[] = {"count", "sum", "min", "where_min", "max", "where_max", "max_abs",
+        "where_max_abs", "na", "undef", "eps", "posinf", "neginf"};
+
+    if (nlhs > 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of outputs (%d). 0 or 1 required.", nlhs);
+    if (nrhs != 1)
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Incorrect number of inputs (%d). 1 required.", nrhs);
+    if (!mxIsCell(prhs[0]))
+        mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need cell");
+    n_columns = mxGetNumberOfElements(prhs[0]);
+
+    /* split columns into chunks */
+    for (size_t k = 0; k < n_columns; k++)
+    {
+        const mxArray* mx_arr = mxGetCell(prhs[0], k);
+        if (!mx_arr || !mxIsDouble(mx_arr) || mxIsComplex(mx_arr))
+            mexErrMsgIdAndTxt(ERRID"check_argument", "Argument 1 has invalid type: need cell of real double arrays");
+        if (mxIsSparse(mx_arr))
+            n_chunks++;
+        else
+            n_chunks += (mxGetNumberOfElements(mx_arr) + GT_STATS_CHUNK_SIZE - 1) / GT_STATS_CHUNK_SIZE;
+    }
+    chunks = (GT_STATS_CHUNK*) mxCalloc(n_chunks > 0 ? n_chunks : 1, sizeof(GT_STATS_CHUNK));
+    n_chunks = 0;
+    for (size_t k = 0; k < n_columns; k++)
+    {
+        const mxArray* mx_arr = mxGetCell(prhs[0], k);
+#ifdef WITH_R2018A_OR_NEWER
+        const double* values = mxGetDoubles(mx_arr);
+#else
+        const double* values = mxGetPr(mx_arr);
+#endif
+        if (mxIsSparse(mx_arr))
+        {
+            GT_STATS_CHUNK* chunk = &chunks[n_chunks++];
+            chunk->column = k;
+            chunk->values = values;
+            chunk->rows = mxGetIr(mx_arr);
+            chunk->cols = mxGetJc(mx_arr);
+            chunk->nrows = mxGetM(mx_arr);
+            chunk->begin = 0;
+            chunk->end = chunk->cols[mxGetN(mx_arr)];
+            n_elements += chunk->end;
+            continue;
+        }
+        for (size_t i = 0; i < mxGetNumberOfElements(mx_arr); i += GT_STATS_CHUNK_SIZE)
+        {
+            GT_STATS_CHUNK* chunk = &chunks[n_chunks++];
+            chunk->column = k;
+            chunk->values = values;
+            chunk->begin = i;
+            chunk->end = i + GT_STATS_CHUNK_SIZE;
+            if (chunk->end > mxGetNumberOfElements(mx_arr))
+                chunk->end = mxGetNumberOfElements(mx_arr);
+        }
+        n_elements += mxGetNumberOfElements(mx_arr);
+    }
+
+    /* compute statistics of chunks */
+    if (n_elements >= GT_STATS_PARALLEL_MIN && n_chunks > 1)
+    {
+        n_threads = std::thread::hardware_concurrency();
+        if (n_threads < 1)
+            n_threads = 1;
+        if (n_threads > GT_STATS_MAX_THREADS)
+            n_threads = GT_STATS_MAX_THREADS;
+        if (n_threads > n_chunks)
+            n_threads = n_chunks;
+    }
+    if (n_threads > 1)
+    {
+        std::vector<std::thread> threads;
+        try
+        {
+            for (size_t t = 0; t < n_threads; t++)
+                threads.push_back(std::thread(gt_stats_worker, chunks, n_chunks, &next));
+        }
+        catch (...)
+        {
+            /* remaining chunks are processed by this thread */
+        }
+        gt_stats_worker(chunks, n_chunks, &next);
+        for (size_t t = 0; t < threads.size(); t++)
+            threads[t].join();
+    }
+    else
+        gt_stats_worker(chunks, n_chunks, &next);
+
+    /* merge chunks of columns */
+    stats = (GT_STATS*) mxCalloc(n_columns > 0 ? n_columns : 1, sizeof(GT_STATS));
+    for (size_t k = 0; k < n_columns; k++)
+        gt_stats_init(&stats[k]);
+    for (size_t i = 0; i < n_chunks; i++)
+        gt_stats_merge(&stats[chunks[i].column], &chunks[i].stats);
+
+    /* create output */
+    plhs[0] = mxCreateStructMatrix(1, n_columns, 13, fields);
+    for (size_t k = 0; k < n_columns; k++)
+    {
+        const mxArray* mx_arr = mxGetCell(prhs[0], k);
+        size_t count = mxGetNumberOfElements(mx_arr);
+        double where_min = 0, where_max = 0, where_max_abs = 0;
+
+        /* implicit zeros of sparse arrays */
+        if (mxIsSparse(mx_arr) && count > mxGetJc(mx_arr)[mxGetN(mx_arr)])
+        {
+            GT_STATS zero;
+            gt_stats_init(&zero);
+            gt_stats_add(&zero, 0.0, gt_stats_first_zero(mx_arr));
+            gt_stats_merge(&stats[k], &zero);
+        }
+
+        if (stats[k].has_value)
+        {
+            where_min = (double) stats[k].where_min + 1;
+            where_max = (double) stats[k].where_max + 1;
+            where_max_abs = (double) stats[k].where_max_abs + 1;
+        }
+        else if (count > 0)
+            where_min = where_max = where_max_abs = 1;
+
+        mxSetFieldByNumber(plhs[0], k, 0, mxCreateDoubleScalar((double) count));
+        mxSetFieldByNumber(plhs[0], k, 1, mxCreateDoubleScalar(stats[k].sum));
+        mxSetFieldByNumber(plhs[0], k, 2, mxCreateDoubleScalar(stats[k].min));
+        mxSetFieldByNumber(plhs[0], k, 3, mxCreateDoubleScalar(where_min));
+        mxSetFieldByNumber(plhs[0], k, 4, mxCreateDoubleScalar(stats[k].max));
+        mxSetFieldByNumber(plhs[0], k, 5, mxCreateDoubleScalar(where_max));
+        mxSetFieldByNumber(plhs[0], k, 6, mxCreateDoubleScalar(stats[k].max_abs));
+        mxSetFieldByNumber(plhs[0], k, 7, mxCreateDoubleScalar(where_max_abs));
+        mxSetFieldByNumber(plhs[0], k, 8, mxCreateDoubleScalar((double) stats[k].n_na));
+        mxSetFieldByNumber(plhs[0], k, 9, mxCreateDoubleScalar((double) stats[k].n_undef));
+        mxSetFieldByNumber(plhs[0], k, 10, mxCreateDoubleScalar((double) stats[k].n_eps));
+        mxSetFieldByNumber(plhs[0], k, 11, mxCreateDoubleScalar((double) stats[k].n_posinf));
+        mxSetFieldByNumber(plhs[0], k, 12, mxCreateDoubleScalar((double) stats[k].n_neginf));
+    }
+
+    mxFree(stats);
+    mxFree(chunks);
+}
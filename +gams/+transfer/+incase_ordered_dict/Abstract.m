@@ -33,7 +33,7 @@
 % Attention: Internal classes or functions have limited documentation and its properties, methods
 % and method or function signatures can change without notice.
 %
-classdef (Abstract, Hidden) Abstract
+classdef (Abstract, Hidden) Abstract < gams.transfer.utils.Handle
 
     %#ok<*INUSD,*STOUT>
 
@@ -99,6 +99,11 @@ classdef (Abstract, Hidden) Abstract
             error('Method ''%s'' not supported by ''%s''.', st(1).name, class(obj));
         end
 
+        function s = toStruct(obj)
+            st = dbstack;
+            error('Method ''%s'' not supported by ''%s''.', st(1).name, class(obj));
+        end
+
     end
 
 end
@@ -0,0 +1,290 @@
+% Struct based Case Insensitive Ordered Dictionary (internal)
+%
+% ------------------------------------------------------------------------------
+%
+% GAMS - General Algebraic Modeling System
+% GAMS Transfer Matlab
+%
+% Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+% Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+%
+% Permission is hereby granted, free of charge, to any person obtaining a copy
+% of this software and associated documentation files (the 'Software'), to deal
+% in the Software without restriction, including without limitation the rights
+% to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+% copies of the Software, and to permit persons to whom the Software is
+% furnished to do so, subject to the following conditions:
+%
+% The above copyright notice and this permission notice shall be included in all
+% copies or substantial portions of the Software.
+%
+% THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+% IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+% FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+% AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+% LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+% OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+% SOFTWARE.
+%
+% ------------------------------------------------------------------------------
+%
+% Hash Indexed Case Insensitive Ordered Dictionary (internal)
+%
+% Entries are stored in insertion order in slots. A containers.Map maps the lower case key to the
+% slot, such that lookups (also of multiple keys in one call) are independent of the number of
+% entries. Removed entries leave an empty slot behind that is dropped once half of the slots are
+% empty; until then maps between slots and positions translate between both. These maps are rebuilt
+% lazily on the first lookup after removals, such that removing k entries one by one costs O(k)
+% plus one rebuild. The struct of all entries (toStruct) is cached until the next modification.
+%
+% Attention: Internal classes or functions have limited documentation and its properties, methods
+% and method or function signatures can change without notice.
+%
+classdef (Hidden) Hashed < gams.transfer.incase_ordered_dict.Abstract
+
+    %#ok<*INUSD,*STOUT>
+
+    properties (Hidden, SetAccess = protected)
+        count_ = 0
+        n_slots_ = 0
+        keys_ = cell(0, 1)
+        entries_ = cell(0, 1)
+        used_ = false(0, 1)
+        positions_ = zeros(0, 1)
+        slots_ = zeros(0, 1)
+        maps_valid_ = true
+        struct_ = []
+        index_
+    end
+
+    methods
+
+        function obj = Hashed()
+            obj.index_ = gams.transfer.incase_ordered_dict.Hashed.createIndex({});
+        end
+
+        function n = count(obj)
+            n = obj.count_;
+        end
+
+        function flag = exists(obj, keys)
+            flag = obj.findSlots(keys, false) > 0;
+        end
+
+        function keys = keys(obj, keys)
+            if nargin == 1
+                keys = obj.keys_(obj.used_);
+            elseif iscell(keys)
+                keys = reshape(obj.keys_(obj.findSlots(keys, true)), size(keys));
+            else
+                keys = obj.keys_{obj.findSlots(keys, true)};
+            end
+        end
+
+        function keys = keysAt(obj, indices)
+            slots = obj.slotsAt(indices);
+            if isscalar(indices)
+                keys = obj.keys_{slots};
+            else
+                keys = obj.keys_(slots);
+            end
+        end
+
+        function indices = find(obj, keys)
+            indices = obj.findSlots(keys, false);
+            if obj.n_slots_ > obj.count_
+                obj.updateMaps();
+                is_found = indices > 0;
+                indices(is_found) = obj.positions_(indices(is_found));
+            end
+        end
+
+        function entries = entries(obj, keys)
+            if nargin == 1
+                entries = obj.entries_(obj.used_);
+            elseif iscell(keys)
+                entries = reshape(obj.entries_(obj.findSlots(keys, true)), size(keys));
+            else
+                entries = obj.entries_{obj.findSlots(keys, true)};
+            end
+        end
+
+        function entries = entriesAt(obj, indices)
+            slots = obj.slotsAt(indices);
+            if isscalar(indices)
+                entries = obj.entries_{slots};
+            else
+                entries = obj.entries_(slots);
+            end
+        end
+
+        function obj = add(obj, key, entry)
+            if obj.exists(key)
+                error('Entry ''%s'' already exists.', key);
+            end
+
+            % grow slots geometrically
+            if obj.n_slots_ == numel(obj.keys_)
+                capacity = max(16, 2 * obj.n_slots_);
+                obj.keys_{capacity,1} = [];
+                obj.entries_{capacity,1} = [];
+                obj.used_(capacity,1) = false;
+                obj.positions_(capacity,1) = 0;
+                obj.slots_(capacity,1) = 0;
+            end
+
+            obj.n_slots_ = obj.n_slots_ + 1;
+            obj.count_ = obj.count_ + 1;
+            obj.keys_{obj.n_slots_} = key;
+            obj.entries_{obj.n_slots_} = entry;
+            obj.used_(obj.n_slots_) = true;
+            if obj.maps_valid_
+                obj.positions_(obj.n_slots_) = obj.count_;
+                obj.slots_(obj.count_) = obj.n_slots_;
+            end
+            obj.index_(lower(key)) = obj.n_slots_;
+            if ~isempty(obj.struct_)
+                obj.struct_.(key) = entry;
+            end
+        end
+
+        function obj = clear(obj)
+            obj.count_ = 0;
+            obj.n_slots_ = 0;
+            obj.keys_ = cell(0, 1);
+            obj.entries_ = cell(0, 1);
+            obj.used_ = false(0, 1);
+            obj.positions_ = zeros(0, 1);
+            obj.slots_ = zeros(0, 1);
+            obj.maps_valid_ = true;
+            obj.struct_ = [];
+            obj.index_ = gams.transfer.incase_ordered_dict.Hashed.createIndex({});
+        end
+
+        function [obj, symbol] = rename(obj, oldkey, newkey)
+            symbol = [];
+            slot = obj.findSlots(oldkey, false);
+            if slot < 1
+                return
+            end
+            newslot = obj.findSlots(newkey, false);
+            if newslot > 0 && newslot ~= slot
+                error('Entry ''%s'' already exists.', newkey);
+            end
+            remove(obj.index_, lower(obj.keys_{slot}));
+            obj.index_(lower(newkey)) = slot;
+            obj.keys_{slot} = newkey;
+            obj.struct_ = [];
+            symbol = obj.entries_{slot};
+        end
+
+        function obj = remove(obj, keys)
+            if ~iscell(keys)
+                keys = {keys};
+            end
+            slots = obj.findSlots(keys, false);
+            slots = unique(slots(slots > 0));
+            if isempty(slots)
+                return
+            end
+            remove(obj.index_, lower(obj.keys_(slots)));
+            obj.keys_(slots) = {[]};
+            obj.entries_(slots) = {[]};
+            obj.used_(slots) = false;
+            obj.count_ = obj.count_ - numel(slots);
+            obj.maps_valid_ = false;
+            obj.struct_ = [];
+
+            % drop empty slots once they dominate
+            if obj.n_slots_ > 2 * obj.count_
+                obj.compact();
+            end
+        end
+
+        function obj = reorder(obj, permutation)
+            obj.compact();
+            obj.keys_(1:obj.count_) = obj.keys_(permutation);
+            obj.entries_(1:obj.count_) = obj.entries_(permutation);
+            obj.index_ = gams.transfer.incase_ordered_dict.Hashed.createIndex(obj.keys_(1:obj.count_));
+            obj.struct_ = [];
+        end
+
+        function s = toStruct(obj)
+            if isempty(obj.struct_)
+                if obj.count_ == 0
+                    obj.struct_ = struct();
+                else
+                    obj.struct_ = cell2struct(obj.entries_(obj.used_), obj.keys_(obj.used_), 1);
+                end
+            end
+            s = obj.struct_;
+        end
+
+    end
+
+    methods (Hidden, Access = protected)
+
+        function slots = findSlots(obj, keys, required)
+            keys = cellstr(keys);
+            slots = zeros(size(keys));
+            if isempty(keys)
+                return
+            end
+            lower_keys = lower(keys);
+            is_key = isKey(obj.index_, lower_keys);
+            if any(is_key(:))
+                slots(is_key) = cell2mat(values(obj.index_, lower_keys(is_key)));
+            end
+            if required && ~all(is_key(:))
+                error('Entry ''%s'' does not exist.', keys{find(~is_key, 1)});
+            end
+        end
+
+        function slots = slotsAt(obj, indices)
+            if obj.n_slots_ > obj.count_
+                obj.updateMaps();
+                slots = obj.slots_(indices);
+            else
+                slots = indices;
+            end
+        end
+
+        function compact(obj)
+            if obj.n_slots_ == obj.count_
+                return
+            end
+            obj.keys_ = obj.keys_(obj.used_);
+            obj.entries_ = obj.entries_(obj.used_);
+            obj.used_ = true(obj.count_, 1);
+            obj.positions_ = (1:obj.count_)';
+            obj.slots_ = (1:obj.count_)';
+            obj.maps_valid_ = true;
+            obj.n_slots_ = obj.count_;
+            obj.index_ = gams.transfer.incase_ordered_dict.Hashed.createIndex(obj.keys_);
+        end
+
+        function updateMaps(obj)
+            if obj.maps_valid_
+                return
+            end
+            obj.positions_(1:obj.n_slots_) = cumsum(obj.used_(1:obj.n_slots_));
+            obj.slots_(1:obj.count_) = find(obj.used_(1:obj.n_slots_));
+            obj.maps_valid_ = true;
+        end
+
+    end
+
+    methods (Hidden, Static, Access = protected)
+
+        function index = createIndex(keys)
+            if isempty(keys)
+                index = containers.Map('KeyType', 'char', 'ValueType', 'double');
+            else
+                index = containers.Map(lower(reshape(keys, 1, [])), num2cell(1:numel(keys)), ...
+                    'UniformValues', true);
+            end
+        end
+
+    end
+
+end
@@ -174,6 +174,10 @@ classdef (Hidden) Struct < gams.transfer.incase_ordered_dict.Abstract
             obj.entries_ = orderfields(obj.entries_, permutation);
             obj.keys_ = orderfields(obj.keys_, permutation);
         end
+
+        function s = toStruct(obj)
+            s = obj.entries_;
+        end
     end
 
 end
@@ -134,54 +134,88 @@ classdef (Abstract, Hidden) Abstract
             end
         end
 
-        function value = getMeanValue_(obj, def)
+        function columns = getValueColumns_(obj, def)
+            columns = cell(1, numel(def.values));
+            for i = 1:numel(def.values)
+                columns{i} = obj.records_.(def.values{i}.label);
+            end
+        end
+
+        function stats = getValueStatistics_(obj, def)
+            stats = gams.transfer.gdx.gt_value_stats(obj.getValueColumns_(def));
+        end
+
+        function value = getMeanValue_(obj, def, stats)
             st = dbstack;
             error('Method ''%s'' not supported by ''%s''.', st(1).name, class(obj));
         end
 
-        function [value, where] = getMinValue_(obj, def, axes)
+        function [value, where] = getMinValue_(obj, def, axes, stats)
+            if nargin < 4
+                stats = obj.getValueStatistics_(def);
+            end
             if nargout >= 2
-                [value, where] = obj.getFunValue_(@min, def, axes);
+                [value, where] = obj.getFunValue_('min', def, axes, stats);
             else
-                value = obj.getFunValue_(@min, def, axes);
+                value = obj.getFunValue_('min', def, axes, stats);
             end
         end
 
-        function [value, where] = getMaxValue_(obj, def, axes)
+        function [value, where] = getMaxValue_(obj, def, axes, stats)
+            if nargin < 4
+                stats = obj.getValueStatistics_(def);
+            end
             if nargout >= 2
-                [value, where] = obj.getFunValue_(@max, def, axes);
+                [value, where] = obj.getFunValue_('max', def, axes, stats);
             else
-                value = obj.getFunValue_(@max, def, axes);
+                value = obj.getFunValue_('max', def, axes, stats);
             end
         end
 
-        function [value, where] = getMaxAbsValue_(obj, def, axes)
-            fun = @(x) (max(abs(x)));
+        function [value, where] = getMaxAbsValue_(obj, def, axes, stats)
+            if nargin < 4
+                stats = obj.getValueStatistics_(def);
+            end
             if nargout >= 2
-                [value, where] = obj.getFunValue_(fun, def, axes);
+                [value, where] = obj.getFunValue_('max_abs', def, axes, stats);
             else
-                value = obj.getFunValue_(fun, def, axes);
+                value = obj.getFunValue_('max_abs', def, axes, stats);
             end
         end
 
-        function n = countNA_(obj, def)
-            n = obj.countFun_(@gams.transfer.SpecialValues.isNA, def);
+        function n = countNA_(obj, def, stats)
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
+            end
+            n = sum([stats.na]);
         end
 
-        function n = countUndef_(obj, def)
-            n = obj.countFun_(@gams.transfer.SpecialValues.isUndef, def);
+        function n = countUndef_(obj, def, stats)
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
+            end
+            n = sum([stats.undef]);
         end
 
-        function n = countEps_(obj, def)
-            n = obj.countFun_(@gams.transfer.SpecialValues.isEps, def);
+        function n = countEps_(obj, def, stats)
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
+            end
+            n = sum([stats.eps]);
         end
 
-        function n = countPosInf_(obj, def)
-            n = obj.countFun_(@gams.transfer.SpecialValues.isPosInf, def);
+        function n = countPosInf_(obj, def, stats)
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
+            end
+            n = sum([stats.posinf]);
         end
 
-        function n = countNegInf_(obj, def)
-            n = obj.countFun_(@gams.transfer.SpecialValues.isNegInf, def);
+        function n = countNegInf_(obj, def, stats)
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
+            end
+            n = sum([stats.neginf]);
         end
 
         function obj = dropDefaults_(obj, def)
@@ -332,9 +366,9 @@ classdef (Abstract, Hidden) Abstract
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
             gams.transfer.utils.Validator('axes', 2, axes).type('gams.transfer.symbol.unique_labels.Axes');
             if nargout >= 2
-                [value, where] = obj.getFunValue_(@min, def, axes);
+                [value, where] = obj.getMinValue_(def, axes);
             else
-                value = obj.getFunValue_(@min, def, axes);
+                value = obj.getMinValue_(def, axes);
             end
         end
 
@@ -342,46 +376,45 @@ classdef (Abstract, Hidden) Abstract
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
             gams.transfer.utils.Validator('axes', 2, axes).type('gams.transfer.symbol.unique_labels.Axes');
             if nargout >= 2
-                [value, where] = obj.getFunValue_(@max, def, axes);
+                [value, where] = obj.getMaxValue_(def, axes);
             else
-                value = obj.getFunValue_(@max, def, axes);
+                value = obj.getMaxValue_(def, axes);
             end
         end
 
         function [value, where] = getMaxAbsValue(obj, def, axes)
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
             gams.transfer.utils.Validator('axes', 2, axes).type('gams.transfer.symbol.unique_labels.Axes');
-            fun = @(x) (max(abs(x)));
             if nargout >= 2
-                [value, where] = obj.getFunValue_(fun, def, axes);
+                [value, where] = obj.getMaxAbsValue_(def, axes);
             else
-                value = obj.getFunValue_(fun, def, axes);
+                value = obj.getMaxAbsValue_(def, axes);
             end
         end
 
         function n = countNA(obj, def)
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
-            n = obj.countFun_(@gams.transfer.SpecialValues.isNA, def);
+            n = obj.countNA_(def);
         end
 
         function n = countUndef(obj, def)
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
-            n = obj.countFun_(@gams.transfer.SpecialValues.isUndef, def);
+            n = obj.countUndef_(def);
         end
 
         function n = countEps(obj, def)
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
-            n = obj.countFun_(@gams.transfer.SpecialValues.isEps, def);
+            n = obj.countEps_(def);
         end
 
         function n = countPosInf(obj, def)
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
-            n = obj.countFun_(@gams.transfer.SpecialValues.isPosInf, def);
+            n = obj.countPosInf_(def);
         end
 
         function n = countNegInf(obj, def)
             gams.transfer.utils.Validator('def', 1, def).type('gams.transfer.symbol.definition.Abstract');
-            n = obj.countFun_(@gams.transfer.SpecialValues.isNegInf, def);
+            n = obj.countNegInf_(def);
         end
 
         function obj = dropDefaults(obj, def)
@@ -488,22 +521,21 @@ classdef (Abstract, Hidden) Abstract
 
     methods (Hidden, Access = private)
 
-        function [value, where] = getFunValue_(obj, fun, def, axes)
-            value = zeros(1, numel(def.values));
-            where = cell(1, numel(def.values));
-            found = false;
-            for i = 1:numel(def.values)
-                [value_, where_] = fun(obj.records_.(def.values{i}.label)(:));
-                if ~isempty(value_)
-                    value(i) = value_;
-                    where{i} = where_;
-                    found = true;
+        function [value, where] = getFunValue_(obj, fun, def, axes, stats)
+            % columns without a value (empty) are skipped, columns with NaN only are considered
+            % like Matlab's min and max do it
+            value = [stats.(fun)];
+            where = [stats.(['where_', fun])];
+            columns = find(where > 0);
+            if ~isempty(columns)
+                if strcmp(fun, 'min')
+                    [value, idx] = min(value(columns));
+                else
+                    [value, idx] = max(value(columns));
                 end
-            end
-            if found
-                [value, idx] = fun(value);
                 if nargout >= 2
-                    idx = obj.ind2sub_(axes, def.values{idx}, where{idx});
+                    idx = columns(idx);
+                    idx = obj.ind2sub_(axes, def.values{idx}, where(idx));
                     where = cell(1, axes.dimension);
                     for i = 1:axes.dimension
                         where{i} = axes.axis(i).unique_labels.getAt_(idx(i));
@@ -516,13 +548,6 @@ classdef (Abstract, Hidden) Abstract
             end
         end
 
-        function n = countFun_(obj, fun, def)
-            n = 0;
-            for i = 1:numel(def.values)
-                n = n + sum(fun(obj.records_.(def.values{i}.label)(:)));
-            end
-        end
-
     end
 
 end
@@ -114,15 +114,14 @@ classdef (Abstract, Hidden) Matrix < gams.transfer.symbol.data.Abstract
             nrecs = nan;
         end
 
-        function value = getMeanValue_(obj, def)
-            value = 0;
-            for i = 1:numel(def.values)
-                value = value + mean(obj.records_.(def.values{i}.label)(:));
+        function value = getMeanValue_(obj, def, stats)
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
             end
             if numel(def.values) == 0
                 value = nan;
             else
-                value = value / numel(def.values);
+                value = sum([stats.sum] ./ [stats.count]) / numel(def.values);
             end
         end
 
@@ -130,23 +129,19 @@ classdef (Abstract, Hidden) Matrix < gams.transfer.symbol.data.Abstract
         end
 
         function obj = dropNA_(obj, def)
-            fun = @(i) (gams.transfer.SpecialValues.isNA(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'na'});
         end
 
         function obj = dropUndef_(obj, def)
-            fun = @(i) (gams.transfer.SpecialValues.isUndef(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'undef'});
         end
 
         function obj = dropMissing_(obj, def)
-            fun = @(i) (isnan(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'missing'});
         end
 
         function obj = dropEps_(obj, def)
-            fun = @(i) (gams.transfer.SpecialValues.isEps(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'eps'});
         end
 
         function indices = findDuplicates_(obj, def, keep)
@@ -173,25 +168,14 @@ classdef (Abstract, Hidden) Matrix < gams.transfer.symbol.data.Abstract
             dim = axes.dimension;
             size_ = axes.matrixSize();
 
-            % get all possible indices (sorted by column)
-            indices_ = cell(1, dim);
-            [indices_{:}] = ind2sub(size_, 1:prod(size_));
-            indices = zeros(prod(size_), dim);
-            for i = 1:dim
-                indices(:, i) = indices_{i};
-            end
-            [indices, indices_perm] = sortrows(indices, 1:dim);
-
-            % get sparse indices
-            keep_indices = false(1, prod(size_));
+            % gather entries where any value differs from its default (sorted by domain)
+            values = cell(1, numel(def.values));
+            defaults = zeros(1, numel(def.values));
             for i = 1:numel(def.values)
-                [row, col, val] = find(obj.records_.(def.values{i}.label));
-                idx = sub2ind(size(obj.records_.(def.values{i}.label)), row, col);
-                keep_indices(idx(val ~= def.values{i}.default)) = true;
+                values{i} = obj.records_.(def.values{i}.label);
+                defaults(i) = def.values{i}.default;
             end
-            keep_indices = keep_indices(indices_perm);
-            indices(~keep_indices, :) = [];
-            indices_perm(~keep_indices) = [];
+            [indices, values] = gams.transfer.gdx.gt_transform_records('tabular', values, size_, defaults, dim);
 
             % domain columns
             for i = 1:dim
@@ -199,10 +183,10 @@ classdef (Abstract, Hidden) Matrix < gams.transfer.symbol.data.Abstract
                 switch axis.domain.index_type.value
                 case gams.transfer.symbol.domain.IndexType.CATEGORICAL
                     data.records.(axis.domain.label) = ...
-                        axis.unique_labels.createCategoricalIndexFromInteger_(indices(:, i));
+                        axis.unique_labels.createCategoricalIndexFromInteger_(indices{i});
                 case gams.transfer.symbol.domain.IndexType.INTEGER
                     data.records.(axis.domain.label) = ...
-                        axis.unique_labels.createIntegerIndexFromInteger_(indices(:, i));
+                        axis.unique_labels.createIntegerIndexFromInteger_(indices{i});
                 otherwise
                     error('Unsupported domain index type: %s', axis.domain.index_type.select);
                 end
@@ -210,7 +194,33 @@ classdef (Abstract, Hidden) Matrix < gams.transfer.symbol.data.Abstract
 
             % values columns
             for i = 1:numel(def.values)
-                data.records.(def.values{i}.label) = full(obj.records_.(def.values{i}.label)(indices_perm));
+                data.records.(def.values{i}.label) = values{i};
+            end
+        end
+
+    end
+
+    methods (Hidden, Access = protected)
+
+        function data = transformToSparseTensor_(obj, def, axes, data)
+            size_ = axes.matrixSize();
+
+            % keep entries where any value differs from its default
+            if isa(obj, 'gams.transfer.symbol.data.SparseMatrix')
+                keep = logical(sparse(size_(1), size_(2)));
+            else
+                keep = false(size_);
+            end
+            for i = 1:numel(def.values)
+                keep = keep | (obj.records_.(def.values{i}.label) ~= def.values{i}.default);
+            end
+            index = find(keep);
+
+            data.records_ = struct();
+            data.records_.index = uint64(index(:));
+            data.records_.shape = size_;
+            for i = 1:numel(def.values)
+                data.records_.(def.values{i}.label) = full(obj.records_.(def.values{i}.label)(index(:)));
             end
         end
 
@@ -218,9 +228,11 @@ classdef (Abstract, Hidden) Matrix < gams.transfer.symbol.data.Abstract
 
     methods (Hidden, Access = private)
 
-        function obj = dropFun_(obj, def, fun)
+        function obj = dropClasses_(obj, def, classes)
+            % resets values of the special value classes (see gt_sv_class) to their default
             for i = 1:numel(def.values)
-                obj.records_.(def.values{i}.label)(fun(i)) = def.values{i}.default;
+                mask = gams.transfer.gdx.gt_sv_class({obj.records_.(def.values{i}.label)}, classes);
+                obj.records_.(def.values{i}.label)(mask) = def.values{i}.default;
             end
         end
 
@@ -94,6 +94,8 @@ classdef (Hidden) SparseMatrix < gams.transfer.symbol.data.Matrix
                 for i = 1:numel(def.values)
                     data.records_.(def.values{i}.label) = obj.records_.(def.values{i}.label);
                 end
+            elseif isa(data, 'gams.transfer.symbol.data.SparseTensor')
+                data = obj.transformToSparseTensor_(def, axes, data);
             else
                 error('Invalid data: %s', class(data));
             end
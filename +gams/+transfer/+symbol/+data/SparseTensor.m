@@ -0,0 +1,321 @@
+% Sparse Tensor Data (internal)
+%
+% ------------------------------------------------------------------------------
+%
+% GAMS - General Algebraic Modeling System
+% GAMS Transfer Matlab
+%
+% Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+% Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+%
+% Permission is hereby granted, free of charge, to any person obtaining a copy
+% of this software and associated documentation files (the 'Software'), to deal
+% in the Software without restriction, including without limitation the rights
+% to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+% copies of the Software, and to permit persons to whom the Software is
+% furnished to do so, subject to the following conditions:
+%
+% The above copyright notice and this permission notice shall be included in all
+% copies or substantial portions of the Software.
+%
+% THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+% IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+% FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+% AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+% LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+% OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+% SOFTWARE.
+%
+% ------------------------------------------------------------------------------
+%
+% Sparse Tensor Data (internal)
+%
+% Stores records of arbitrary dimension in coordinate form: a linear (column-major) index into a
+% dense array of size 'shape' plus one value vector per value field. Entries not listed take the
+% default value of the corresponding field.
+%
+% Attention: Internal classes or functions have limited documentation and its properties, methods
+% and method or function signatures can change without notice.
+%
+classdef (Hidden) SparseTensor < gams.transfer.symbol.data.Matrix
+
+    %#ok<*INUSD,*STOUT>
+
+    properties (Constant)
+        name = 'sparse_tensor'
+    end
+
+    properties (Constant, Hidden)
+        INDEX_LABELS = {'index', 'shape'}
+    end
+
+    methods (Hidden, Access = {?gams.transfer.symbol.data.Abstract, ?gams.transfer.Container, ?gams.transfer.symbol.Abstract})
+
+        function obj = SparseTensor(records)
+            obj.records_ = struct();
+            if nargin >= 1
+                obj.records_ = records;
+            end
+        end
+
+    end
+
+    methods (Static)
+
+        function obj = construct(records)
+            if nargin == 0
+                obj = gams.transfer.symbol.data.SparseTensor();
+            else
+                obj = gams.transfer.symbol.data.SparseTensor(records);
+            end
+        end
+
+    end
+
+    methods
+
+        function labels = getLabels(obj)
+            if isstruct(obj.records_)
+                labels = fieldnames(obj.records_);
+                labels = labels(~ismember(labels, obj.INDEX_LABELS));
+            else
+                labels = {};
+            end
+        end
+
+    end
+
+    methods (Hidden, Access = {?gams.transfer.symbol.data.Abstract, ?gams.transfer.symbol.Abstract, ...
+        ?gams.transfer.unique_labels.Abstract})
+
+        function flag = isLabel_(obj, label)
+            flag = isfield(obj.records_, label) && ~ismember(label, obj.INDEX_LABELS);
+        end
+
+        function status = isValid_(obj, def, axes)
+            if ~isstruct(obj.records_)
+                status = gams.transfer.utils.Status("Record data must be 'struct'.");
+                return
+            end
+            if ~isfield(obj.records_, 'index') || ~isfield(obj.records_, 'shape')
+                status = gams.transfer.utils.Status("Records must have fields 'index' and 'shape'.");
+                return
+            end
+
+            shape = obj.records_.shape;
+            if ~isnumeric(shape) || ~isequal(size(shape), size(axes.matrixSize())) || ...
+                any(shape ~= axes.matrixSize())
+                status = gams.transfer.utils.Status("Records shape must equal symbol (matrix) size.");
+                return
+            end
+            if prod(shape) > flintmax
+                status = gams.transfer.utils.Status("Records shape must not exceed 2^53 elements (exact linear index).");
+                return
+            end
+
+            index = obj.records_.index;
+            if ~isnumeric(index) || issparse(index) || (~isempty(index) && ~iscolumn(index))
+                status = gams.transfer.utils.Status("Records index must be numeric column vector.");
+                return
+            end
+            if ~isempty(index) && (any(index ~= round(index)) || min(index) < 1 || max(index) > prod(shape))
+                status = gams.transfer.utils.Status(sprintf("Records index must have values in [%d,%d].", 1, prod(shape)));
+                return
+            end
+
+            for i = 1:numel(def.values)
+                label = def.values{i}.label;
+
+                switch class(def.values{i})
+                case 'gams.transfer.symbol.value.Numeric'
+                    if isempty(obj.records_.(label))
+                    elseif isnumeric(obj.records_.(label))
+                    else
+                        status = gams.transfer.utils.Status(sprintf("Records value '%s' must be numeric or empty.", label));
+                        return
+                    end
+                case 'gams.transfer.symbol.value.String'
+                    if ~isempty(obj.records_.(label))
+                        status = gams.transfer.utils.Status(sprintf("Records value '%s' must be empty.", label));
+                        return
+                    end
+                otherwise
+                    error('Unknown symbol value type: %s', class(def.values{i}));
+                end
+
+                if isempty(obj.records_.(label))
+                    continue
+                end
+
+                if issparse(obj.records_.(label))
+                    status = gams.transfer.utils.Status(sprintf("Records value '%s' must not be sparse.", label));
+                    return
+                end
+
+                if any(size(index) ~= size(obj.records_.(label)))
+                    status = gams.transfer.utils.Status(sprintf("Records value '%s' must have same size as index.", label));
+                    return
+                end
+            end
+
+            status = gams.transfer.utils.Status.ok();
+        end
+
+        function indices = usedUniqueLabels_(obj, def, dimension)
+            if ~isfield(obj.records_, 'shape') || numel(def.values) == 0
+                indices = [];
+            else
+                indices = 1:obj.records_.shape(dimension);
+            end
+        end
+
+        function nrecs = getNumberRecords_(obj, def)
+            if isfield(obj.records_, 'index')
+                nrecs = numel(obj.records_.index);
+            else
+                nrecs = 0;
+            end
+        end
+
+        function nvals = getNumberValues_(obj, def)
+            nvals = obj.getNumberRecords_(def) * numel(def.values);
+        end
+
+        function value = getMeanValue_(obj, def, stats)
+            if numel(def.values) == 0
+                value = nan;
+                return
+            end
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
+            end
+            n_dense = prod(obj.records_.shape);
+            n_implicit = n_dense - obj.getNumberRecords_(def);
+            value = 0;
+            for i = 1:numel(def.values)
+                value = value + stats(i).sum + n_implicit * def.values{i}.default;
+            end
+            value = value / (n_dense * numel(def.values));
+        end
+
+        function obj = dropDefaults_(obj, def)
+            keep = false(obj.getNumberRecords_(def), 1);
+            for i = 1:numel(def.values)
+                keep = keep | obj.records_.(def.values{i}.label) ~= def.values{i}.default;
+            end
+            obj = obj.removeRows_(~keep);
+        end
+
+        function obj = dropNA_(obj, def)
+            obj = obj.dropRecordsClasses_(def, {'na'});
+        end
+
+        function obj = dropUndef_(obj, def)
+            obj = obj.dropRecordsClasses_(def, {'undef'});
+        end
+
+        function obj = dropMissing_(obj, def)
+            obj = obj.dropRecordsClasses_(def, {'missing'});
+        end
+
+        function obj = dropEps_(obj, def)
+            obj = obj.dropRecordsClasses_(def, {'eps'});
+        end
+
+        function indices = findDuplicates_(obj, def, keep)
+            indices = gams.transfer.gdx.gt_find_duplicates({uint64(obj.records_.index(:))}, false, keep);
+        end
+
+        function obj = dropDuplicates_(obj, def, keep)
+            obj = obj.removeRows_(obj.findDuplicates_(def, keep));
+        end
+
+        function subindex = ind2sub_(obj, axes, value, linindex)
+            subindex = cell(1, numel(obj.records_.shape));
+            [subindex{:}] = ind2sub(obj.records_.shape, double(obj.records_.index(linindex)));
+            subindex = [subindex{:}];
+            subindex = subindex(1:axes.dimension);
+        end
+
+        function data = transformToTabular_(obj, def, axes, data)
+            dim = axes.dimension;
+
+            % decode linear indices and sort records by domain (row-major)
+            [indices, indices_perm] = gams.transfer.gdx.gt_transform_records('tensor', ...
+                uint64(obj.records_.index(:)), obj.records_.shape, dim);
+
+            % domain columns
+            for i = 1:dim
+                axis = axes.axis(i);
+                switch axis.domain.index_type.value
+                case gams.transfer.symbol.domain.IndexType.CATEGORICAL
+                    data.records.(axis.domain.label) = ...
+                        axis.unique_labels.createCategoricalIndexFromInteger_(indices{i});
+                case gams.transfer.symbol.domain.IndexType.INTEGER
+                    data.records.(axis.domain.label) = ...
+                        axis.unique_labels.createIntegerIndexFromInteger_(indices{i});
+                otherwise
+                    error('Unsupported domain index type: %s', axis.domain.index_type.select);
+                end
+            end
+
+            % values columns
+            for i = 1:numel(def.values)
+                data.records.(def.values{i}.label) = obj.records_.(def.values{i}.label)(indices_perm);
+            end
+        end
+
+        function data = transformToMatrix_(obj, def, axes, data)
+            if isa(data, 'gams.transfer.symbol.data.SparseTensor')
+                data.records_ = obj.records_;
+                return
+            elseif ~isa(data, 'gams.transfer.symbol.data.DenseMatrix') && ...
+                ~isa(data, 'gams.transfer.symbol.data.SparseMatrix')
+                error('Invalid data: %s', class(data));
+            end
+            if isa(data, 'gams.transfer.symbol.data.SparseMatrix') && axes.dimension > 2
+                error('Sparse matrix does not support dimension larger than 2.');
+            end
+
+            % scatter records into matrices
+            values = cell(1, numel(def.values));
+            defaults = zeros(1, numel(def.values));
+            for i = 1:numel(def.values)
+                values{i} = obj.records_.(def.values{i}.label);
+                defaults(i) = def.values{i}.default;
+            end
+            values = gams.transfer.gdx.gt_transform_records('matrix', uint64(obj.records_.index(:)), ...
+                axes.matrixSize(), values, defaults, isa(data, 'gams.transfer.symbol.data.SparseMatrix'));
+            for i = 1:numel(def.values)
+                data.records_.(def.values{i}.label) = values{i};
+            end
+        end
+
+    end
+
+    methods (Hidden, Access = private)
+
+        function obj = dropRecordsClasses_(obj, def, classes)
+            % drops records where any value is of one of the special value classes (see gt_sv_class)
+            if numel(def.values) == 0
+                return
+            end
+            drop_indices = gams.transfer.gdx.gt_sv_class(obj.getValueColumns_(def), classes);
+            obj = obj.removeRows_(drop_indices(:));
+        end
+
+        function obj = removeRows_(obj, indices)
+            disable = false(numel(obj.records_.index), 1);
+            disable(indices) = true;
+            obj.records_.index = obj.records_.index(~disable);
+            labels = obj.getLabels();
+            for i = 1:numel(labels)
+                if ~isempty(obj.records_.(labels{i}))
+                    obj.records_.(labels{i}) = obj.records_.(labels{i})(~disable);
+                end
+            end
+        end
+
+    end
+
+end
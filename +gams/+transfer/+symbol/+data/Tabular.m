@@ -153,11 +153,11 @@ classdef (Abstract, Hidden) Tabular < gams.transfer.symbol.data.Abstract
             nvals = obj.getNumberRecords_(def) * numel(def.values);
         end
 
-        function value = getMeanValue_(obj, def)
-            value = 0;
-            for i = 1:numel(def.values)
-                value = value + sum(obj.records_.(def.values{i}.label)(:));
+        function value = getMeanValue_(obj, def, stats)
+            if nargin < 3
+                stats = obj.getValueStatistics_(def);
             end
+            value = sum([stats.sum]);
             n_values = obj.getNumberValues_(def);
             if n_values == 0
                 value = nan;
@@ -167,28 +167,31 @@ classdef (Abstract, Hidden) Tabular < gams.transfer.symbol.data.Abstract
         end
 
         function obj = dropDefaults_(obj, def)
-            fun = @(i) (obj.records_.(def.values{i}.label) == def.values{i}.default);
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {}, true);
         end
 
         function obj = dropNA_(obj, def)
-            fun = @(i) (gams.transfer.SpecialValues.isNA(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'na'}, false);
         end
 
         function obj = dropUndef_(obj, def)
-            fun = @(i) (gams.transfer.SpecialValues.isUndef(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'undef'}, false);
         end
 
         function obj = dropMissing_(obj, def)
-            fun = @(i) (isnan(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'missing'}, false);
         end
 
         function obj = dropEps_(obj, def)
-            fun = @(i) (gams.transfer.SpecialValues.isEps(obj.records_.(def.values{i}.label)));
-            obj = obj.dropFun_(def, fun);
+            obj = obj.dropClasses_(def, {'eps'}, false);
+        end
+
+        function n = countDuplicates_(obj, def)
+            n = obj.findDuplicateDomains_(def, 'count');
+        end
+
+        function indices = findDuplicates_(obj, def, keep)
+            indices = obj.findDuplicateDomains_(def, keep);
         end
 
         function obj = dropDuplicates_(obj, def, keep)
@@ -227,35 +230,40 @@ classdef (Abstract, Hidden) Tabular < gams.transfer.symbol.data.Abstract
             % get matrix size
             size_ = axes.matrixSize();
 
-            % convert indices to matrix (linear) indices
-            if dim == 0
-                idx = 1;
-            else
-                idx = cell(1, dim);
-                for i = 1:dim
-                    idx{i} = uint64(obj.records_.(axes.axis(i).domain.label));
-                end
-                idx = sub2ind(size_, idx{:});
+            % domain codes
+            codes = cell(1, dim);
+            for i = 1:dim
+                codes{i} = uint64(obj.records_.(axes.axis(i).domain.label));
+                codes{i} = codes{i}(:);
             end
 
-            % init matrix records
-            if isa(data, 'gams.transfer.symbol.data.DenseMatrix')
-                for i = 1:numel(def.values)
-                    data.records.(def.values{i}.label) = def.values{i}.default * ones(size_);
+            % sparse tensor only stores linear indices
+            if isa(data, 'gams.transfer.symbol.data.SparseTensor')
+                if dim == 0
+                    idx = ones(obj.getNumberRecords_(def), 1, 'uint64');
+                else
+                    idx = sub2ind(size_, codes{:});
                 end
-            elseif isa(data, 'gams.transfer.symbol.data.SparseMatrix')
+                data.records = struct();
+                data.records.index = uint64(idx(:));
+                data.records.shape = size_;
                 for i = 1:numel(def.values)
-                    if def.values{i}.default == 0
-                        data.records.(def.values{i}.label) = sparse(size_(1), size_(2));
-                    else
-                        data.records.(def.values{i}.label) = sparse(def.values{i}.default * ones(size_));
-                    end
+                    data.records.(def.values{i}.label) = obj.records_.(def.values{i}.label)(:);
                 end
+                return
             end
 
-            % copy records to matrices
+            % scatter records into matrices
+            values = cell(1, numel(def.values));
+            defaults = zeros(1, numel(def.values));
             for i = 1:numel(def.values)
-                data.records.(def.values{i}.label)(idx) = obj.records_.(def.values{i}.label);
+                values{i} = obj.records_.(def.values{i}.label);
+                defaults(i) = def.values{i}.default;
+            end
+            values = gams.transfer.gdx.gt_transform_records('matrix', codes, size_, values, defaults, ...
+                isa(data, 'gams.transfer.symbol.data.SparseMatrix'));
+            for i = 1:numel(def.values)
+                data.records.(def.values{i}.label) = values{i};
             end
         end
 
@@ -292,16 +300,59 @@ classdef (Abstract, Hidden) Tabular < gams.transfer.symbol.data.Abstract
 
     methods (Hidden, Access = private)
 
-        function obj = dropFun_(obj, def, fun)
+        function obj = dropClasses_(obj, def, classes, use_defaults)
+            % drops rows where any value is of one of the special value classes (see gt_sv_class)
+            % or, if use_defaults is true, equals its default value
             nrecs = obj.getNumberRecords_(def);
-            if isnan(nrecs)
+            if isnan(nrecs) || numel(def.values) == 0
                 return
             end
-            drop_indices = false(nrecs, 1);
-            for i = 1:numel(def.values)
-                drop_indices = drop_indices | fun(i);
+            columns = obj.getValueColumns_(def);
+            if use_defaults
+                defaults = zeros(1, numel(def.values));
+                for i = 1:numel(def.values)
+                    defaults(i) = def.values{i}.default;
+                end
+                drop_indices = gams.transfer.gdx.gt_sv_class(columns, classes, defaults);
+            else
+                drop_indices = gams.transfer.gdx.gt_sv_class(columns, classes);
+            end
+            obj = obj.removeRows_(drop_indices(:));
+        end
+
+        function indices = findDuplicateDomains_(obj, def, keep)
+            nrecs = obj.getNumberRecords_(def);
+            if isnan(nrecs) && strcmp(keep, 'count')
+                indices = 0;
+                return
+            elseif isnan(nrecs)
+                indices = [];
+                return
+            end
+
+            % without domains all records refer to the same entry
+            dim = numel(def.domains);
+            if dim == 0
+                switch keep
+                case 'count'
+                    indices = max(nrecs - 1, 0);
+                case 'first'
+                    indices = 2:nrecs;
+                case 'last'
+                    indices = 1:nrecs-1;
+                end
+                return
+            end
+
+            % undefined categorical labels (code 0) are never duplicates
+            codes = cell(1, dim);
+            undefined = false(1, dim);
+            for i = 1:dim
+                records = obj.records_.(def.domains{i}.label);
+                undefined(i) = iscategorical(records);
+                codes{i} = uint64(records(:));
             end
-            obj = obj.removeRows_(drop_indices);
+            indices = gams.transfer.gdx.gt_find_duplicates(codes, undefined, keep);
         end
 
     end
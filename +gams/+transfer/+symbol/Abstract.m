@@ -54,6 +54,7 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
         def_
         data_
         unique_labels_ = {}
+        deferred_unique_labels_ = {}
         modified_ = true
         cache_axes_
         cache_is_valid_
@@ -241,6 +242,14 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
         end
 
         function unique_labels = get.unique_labels(obj)
+            if ~isempty(obj.deferred_unique_labels_)
+                labels = obj.deferred_unique_labels_;
+                obj.deferred_unique_labels_ = {};
+                obj.unique_labels_ = cell(1, numel(labels));
+                for i = 1:numel(labels)
+                    obj.unique_labels_{i} = gams.transfer.unique_labels.OrderedLabelSet(labels{i});
+                end
+            end
             dimension = numel(obj.unique_labels_);
             symbol_dimension = obj.dimension;
             if symbol_dimension < dimension
@@ -252,6 +261,7 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
         end
 
         function set.unique_labels(obj, unique_labels)
+            obj.deferred_unique_labels_ = {};
             dimension = numel(obj.unique_labels_);
             symbol_dimension = obj.dimension;
             if symbol_dimension < dimension
@@ -414,6 +424,8 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
                 obj.data_ = gams.transfer.symbol.data.DenseMatrix(obj.records);
             case 'sparse_matrix'
                 obj.data_ = gams.transfer.symbol.data.SparseMatrix(obj.records);
+            case 'sparse_tensor'
+                obj.data_ = gams.transfer.symbol.data.SparseTensor(obj.records);
             otherwise
                 error('Unknown format');
             end
@@ -782,7 +794,7 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
             end
 
             old_data = obj.data_;
-            old_unique_labels = obj.unique_labels_;
+            old_unique_labels = obj.unique_labels;
             obj.data_ = data;
 
             % check records format
@@ -803,7 +815,8 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
         %>
         %> **Required Arguments:**
         %> 1. target_format (`string`):
-        %>    Name of format to transform data to (table, struct, dense_matrix or sparse_matrix).
+        %>    Name of format to transform data to (table, struct, dense_matrix, sparse_matrix or
+        %>    sparse_tensor).
         %>
         %> If the target format is a matrix format, the UELs will be updated to the ones from the
         %> domain plus the added ones. Thus, if there are no domain violations, the matrix size
@@ -816,7 +829,8 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
             %
             % Required Arguments:
             % 1. target_format (string):
-            %    Name of format to transform data to (table, struct, dense_matrix or sparse_matrix).
+            %    Name of format to transform data to (table, struct, dense_matrix, sparse_matrix or
+            %    sparse_tensor).
             %
             % If the target format is a matrix format, the UELs will be updated to the ones from the
             % domain plus the added ones. Thus, if there are no domain violations, the matrix size
@@ -834,6 +848,8 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
                 data = gams.transfer.symbol.data.DenseMatrix();
             case 'sparse_matrix'
                 data = gams.transfer.symbol.data.SparseMatrix();
+            case 'sparse_tensor'
+                data = gams.transfer.symbol.data.SparseTensor();
             otherwise
                 error('Unknown format');
             end
@@ -1810,6 +1826,7 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
             obj.description_ = symbol.description;
             obj.def_ = symbol.def;
             obj.data_ = symbol.data;
+            obj.deferred_unique_labels_ = {};
             obj.unique_labels_ = cell(1, symbol.dimension);
             for i = 1:symbol.dimension
                 if isempty(symbol.unique_labels{i})
@@ -1822,6 +1839,67 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
             obj.clearCache();
         end
 
+        function refreshed = refreshRecords_(obj, data, unique_labels)
+            % replaces the value fields of the records by the ones of data if format, other fields
+            % (domains, index) and unique labels are unchanged; replaces all records otherwise
+            refreshed = isequal(class(obj.data_), class(data)) && obj.isRefreshable_(data, unique_labels);
+            if refreshed
+                records = obj.data_.records;
+                labels = data.getLabels();
+                for i = 1:numel(labels)
+                    records.(labels{i}) = data.records.(labels{i});
+                end
+                obj.data_.records = records;
+            else
+                obj.data_ = data;
+                obj.unique_labels_ = {};
+                obj.deferred_unique_labels_ = unique_labels;
+            end
+            obj.modified_ = true;
+            obj.clearCache();
+        end
+
+        function flag = isRefreshable_(obj, data, unique_labels)
+            flag = false;
+            old_labels = obj.data_.getLabels();
+            labels = data.getLabels();
+            value_labels = cellfun(@(v) v.label, obj.def_.values, 'UniformOutput', false);
+            is_value = ismember(labels, value_labels);
+            if ~all(ismember(labels, old_labels)) || ~isequal(sort(labels(~is_value)), ...
+                sort(old_labels(~ismember(old_labels, value_labels))))
+                return
+            end
+
+            % other fields must be equal, values of equal size
+            for i = 1:numel(labels)
+                old_column = obj.data_.records.(labels{i});
+                column = data.records.(labels{i});
+                if is_value(i)
+                    if ~isequal(size(old_column), size(column))
+                        return
+                    end
+                elseif iscategorical(old_column) ~= iscategorical(column) || (iscategorical(column) && ...
+                    ~isequal(categories(old_column), categories(column))) || ~isequal(old_column, column)
+                    return
+                end
+            end
+
+            % unique labels (if not given by categorical columns) must be equal
+            for i = 1:numel(unique_labels)
+                if numel(obj.deferred_unique_labels_) >= i
+                    old_labels = obj.deferred_unique_labels_{i};
+                elseif numel(obj.unique_labels_) >= i && ~isempty(obj.unique_labels_{i})
+                    old_labels = obj.unique_labels_{i}.get();
+                else
+                    return
+                end
+                if ~isequal(reshape(old_labels, [], 1), reshape(unique_labels{i}, [], 1))
+                    return
+                end
+            end
+            flag = true;
+        end
+
         function domain = getDomain_(obj, dimension)
             domain = obj.def_.domains{dimension};
         end
@@ -2089,6 +2167,65 @@ classdef (Abstract) Abstract < gams.transfer.utils.Handle
 
     end
 
+    methods (Hidden, Static)
+
+        function descr = describeValues_(symbols, values)
+            % Returns min, mean, max and max abs (including where they are) of the given value
+            % fields (all if empty) for each symbol. The statistics of all symbols are computed by
+            % a single call of the native statistics kernel that processes the value columns of
+            % all symbols in parallel.
+
+            n = numel(symbols);
+            defs = cell(1, n);
+            columns = cell(1, n);
+            for i = 1:n
+                if isempty(values)
+                    defs{i} = symbols{i}.parseValues();
+                else
+                    defs{i} = symbols{i}.parseValues('values', values);
+                end
+                columns{i} = symbols{i}.data_.getValueColumns_(defs{i});
+            end
+            stats = gams.transfer.gdx.gt_value_stats(horzcat({}, columns{:}));
+
+            descr = struct();
+            descr.min = zeros(n, 1);
+            descr.mean = zeros(n, 1);
+            descr.max = zeros(n, 1);
+            descr.max_abs = zeros(n, 1);
+            descr.where_min = cell(n, 1);
+            descr.where_max = cell(n, 1);
+            descr.where_max_abs = cell(n, 1);
+            k = 0;
+            for i = 1:n
+                data = symbols{i}.data_;
+                axes = symbols{i}.getAxes_();
+                stats_i = stats(k+1:k+numel(columns{i}));
+                k = k + numel(columns{i});
+                descr.mean(i) = data.getMeanValue_(defs{i}, stats_i);
+                [descr.min(i), where] = data.getMinValue_(defs{i}, axes, stats_i);
+                descr.where_min{i} = gams.transfer.symbol.Abstract.where2str_(descr.min(i), where);
+                [descr.max(i), where] = data.getMaxValue_(defs{i}, axes, stats_i);
+                descr.where_max{i} = gams.transfer.symbol.Abstract.where2str_(descr.max(i), where);
+                [descr.max_abs(i), where] = data.getMaxAbsValue_(defs{i}, axes, stats_i);
+                descr.where_max_abs{i} = gams.transfer.symbol.Abstract.where2str_(descr.max_abs(i), where);
+            end
+        end
+
+    end
+
+    methods (Hidden, Static, Access = private)
+
+        function str = where2str_(value, where)
+            if isnan(value)
+                str = '';
+            else
+                str = gams.transfer.utils.list2str(where);
+            end
+        end
+
+    end
+
     methods
 
         %> Returns the UELs used in this symbol
@@ -369,6 +369,7 @@ classdef Equation < gams.transfer.symbol.Abstract
             descr.mean_level = zeros(numel(symbols), 1);
             descr.max_level = zeros(numel(symbols), 1);
             descr.where_max_abs_level = cell(numel(symbols), 1);
+            stats = gams.transfer.symbol.Abstract.describeValues_(symbols, {'level'});
 
             for i = 1:numel(symbols)
                 descr.name{i} = symbols{i}.name;
@@ -381,15 +382,10 @@ classdef Equation < gams.transfer.symbol.Abstract
                 descr.number_records(i) = symbols{i}.getNumberRecords();
                 descr.number_values(i) = symbols{i}.getNumberValues();
                 descr.sparsity(i) = symbols{i}.getSparsity();
-                descr.min_level(i) = symbols{i}.getMinValue('values', {'level'});
-                descr.mean_level(i) = symbols{i}.getMeanValue('values', {'level'});
-                descr.max_level(i) = symbols{i}.getMaxValue('values', {'level'});
-                [absmax, descr.where_max_abs_level{i}] = symbols{i}.getMaxAbsValue('values', {'level'});
-                if isnan(absmax)
-                    descr.where_max_abs_level{i} = '';
-                else
-                    descr.where_max_abs_level{i} = gams.transfer.utils.list2str(descr.where_max_abs_level{i});
-                end
+                descr.min_level(i) = stats.min(i);
+                descr.mean_level(i) = stats.mean(i);
+                descr.max_level(i) = stats.max(i);
+                descr.where_max_abs_level{i} = stats.where_max_abs{i};
             end
 
             % convert to categorical if possible
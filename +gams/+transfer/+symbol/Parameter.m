@@ -358,6 +358,7 @@ classdef Parameter < gams.transfer.symbol.Abstract
             descr.max = zeros(numel(symbols), 1);
             descr.where_min = cell(numel(symbols), 1);
             descr.where_max = cell(numel(symbols), 1);
+            stats = gams.transfer.symbol.Abstract.describeValues_(symbols, {});
 
             for i = 1:numel(symbols)
                 descr.name{i} = symbols{i}.name;
@@ -369,19 +370,11 @@ classdef Parameter < gams.transfer.symbol.Abstract
                 descr.number_records(i) = symbols{i}.getNumberRecords();
                 descr.number_values(i) = symbols{i}.getNumberValues();
                 descr.sparsity(i) = symbols{i}.getSparsity();
-                [descr.min(i), descr.where_min{i}] = symbols{i}.getMinValue();
-                if isnan(descr.min(i))
-                    descr.where_min{i} = '';
-                else
-                    descr.where_min{i} = gams.transfer.utils.list2str(descr.where_min{i});
-                end
-                descr.mean(i) = symbols{i}.getMeanValue();
-                [descr.max(i), descr.where_max{i}] = symbols{i}.getMaxValue();
-                if isnan(descr.max(i))
-                    descr.where_max{i} = '';
-                else
-                    descr.where_max{i} = gams.transfer.utils.list2str(descr.where_max{i});
-                end
+                descr.min(i) = stats.min(i);
+                descr.where_min{i} = stats.where_min{i};
+                descr.mean(i) = stats.mean(i);
+                descr.max(i) = stats.max(i);
+                descr.where_max{i} = stats.where_max{i};
             end
 
             % convert to categorical if possible
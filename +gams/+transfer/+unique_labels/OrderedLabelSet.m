@@ -37,9 +37,9 @@ classdef (Hidden) OrderedLabelSet < gams.transfer.unique_labels.Abstract
 
     %#ok<*INUSD,*STOUT>
 
-    properties (Hidden, SetAccess = private)
-        uels_label2ids_
-        uels_id2labels_
+    properties (Hidden, SetAccess = private, Transient)
+        handle_
+        labels_
         modified_ = true;
     end
 
@@ -63,12 +63,25 @@ classdef (Hidden) OrderedLabelSet < gams.transfer.unique_labels.Abstract
     methods
 
         function obj = OrderedLabelSet(labels)
-            obj.clear();
             if nargin >= 1
-                obj.add(labels);
+                labels = gams.transfer.utils.Validator('labels', 1, labels).string2char().cellstr().value;
+                obj.handle_ = gams.transfer.gdx.gt_label_set('create', labels);
+            else
+                obj.handle_ = gams.transfer.gdx.gt_label_set('create');
+            end
+        end
+
+        function delete(obj)
+            if ~isempty(obj.handle_)
+                gams.transfer.gdx.gt_label_set('delete', obj.handle_);
+                obj.handle_ = [];
             end
         end
 
+        function s = saveobj(obj)
+            s = struct('labels', {obj.get()}, 'modified', obj.modified_);
+        end
+
     end
 
     methods (Static)
@@ -81,21 +94,38 @@ classdef (Hidden) OrderedLabelSet < gams.transfer.unique_labels.Abstract
             end
         end
 
+        function obj = loadobj(s)
+            obj = gams.transfer.unique_labels.OrderedLabelSet(s.labels);
+            obj.modified_ = s.modified;
+        end
+
     end
 
     methods
 
         function unique_labels = copy(obj)
-            unique_labels = gams.transfer.unique_labels.OrderedLabelSet(obj.get());
+            % copy on write: labels are shared until one of the sets is modified
+            unique_labels = gams.transfer.unique_labels.OrderedLabelSet();
+            gams.transfer.gdx.gt_label_set('delete', unique_labels.handle_);
+            unique_labels.handle_ = gams.transfer.gdx.gt_label_set('share', obj.handle_);
+            unique_labels.labels_ = obj.labels_;
+        end
+
+        function count = count(obj)
+            count = gams.transfer.gdx.gt_label_set('count', obj.handle_);
         end
 
         function labels = get(obj)
-            labels = obj.uels_id2labels_;
+            if ~iscell(obj.labels_)
+                obj.labels_ = gams.transfer.gdx.gt_label_set('get', obj.handle_);
+            end
+            labels = obj.labels_;
         end
 
         function clear(obj)
-            obj.uels_label2ids_ = javaObject("java.util.LinkedHashMap");
-            obj.uels_id2labels_ = {};
+            obj.unshare(false);
+            gams.transfer.gdx.gt_label_set('clear', obj.handle_);
+            obj.labels_ = [];
             obj.modified_ = true;
         end
 
@@ -103,39 +133,34 @@ classdef (Hidden) OrderedLabelSet < gams.transfer.unique_labels.Abstract
 
     methods (Hidden, Access = {?gams.transfer.unique_labels.Abstract, ...
         ?gams.transfer.symbol.Abstract, ?gams.transfer.symbol.data.Abstract, ...
-        ?gams.transfer.symbol.domain.Abstract})
+        ?gams.transfer.symbol.domain.Abstract, ?gams.transfer.Container})
+
+        function [flag, indices] = find_(obj, labels)
+            [flag, indices] = gams.transfer.gdx.gt_label_set('find', obj.handle_, labels);
+        end
 
         function add_(obj, labels)
-            for i = 1:numel(labels)
-                if ~obj.uels_label2ids_.containsKey(labels{i})
-                    obj.uels_label2ids_.put(labels{i}, obj.uels_label2ids_.size() + 1);
-                end
-            end
-            if numel(labels) > 0
-                obj.updateId2Label_();
-            end
+            obj.unshare(true);
+            gams.transfer.gdx.gt_label_set('add', obj.handle_, labels);
+            obj.labels_ = [];
             obj.modified_ = true;
         end
 
         function set_(obj, labels)
-            obj.clear();
-            obj.add_(labels);
+            obj.unshare(false);
+            gams.transfer.gdx.gt_label_set('set', obj.handle_, labels);
+            obj.labels_ = [];
+            obj.modified_ = true;
         end
 
         function [flag, indices] = remove_(obj, labels)
+            obj.unshare(true);
             if nargout > 0
-                oldlabels = obj.get();
-            end
-            for i = 1:numel(labels)
-                obj.uels_label2ids_.remove(labels{i});
-            end
-            obj.updateId2Label_();
-            for i = 1:numel(obj.uels_id2labels_)
-                obj.uels_label2ids_.put(obj.uels_id2labels_{i}, i);
-            end
-            if nargout > 0
-                [flag, indices] = obj.updatedIndices_(oldlabels, [], []);
+                [flag, indices] = gams.transfer.gdx.gt_label_set('remove', obj.handle_, labels);
+            else
+                gams.transfer.gdx.gt_label_set('remove', obj.handle_, labels);
             end
+            obj.labels_ = [];
             obj.modified_ = true;
         end
 
@@ -143,62 +168,30 @@ classdef (Hidden) OrderedLabelSet < gams.transfer.unique_labels.Abstract
             if numel(oldlabels) == 0
                 return
             end
-
-            labels = obj.uels_id2labels_;
-            for i = 1:numel(oldlabels)
-                if strcmp(oldlabels{i}, newlabels{i}) || ~obj.uels_label2ids_.containsKey(oldlabels{i})
-                    continue
-                end
-                if obj.uels_label2ids_.containsKey(newlabels{i})
-                    error('Unique label ''%s'' already exists', newlabels{i});
-                end
-                labels{obj.uels_label2ids_.get(oldlabels{i})} = newlabels{i};
-            end
-            obj.set(labels);
+            obj.unshare(true);
+            gams.transfer.gdx.gt_label_set('rename', obj.handle_, oldlabels, newlabels);
+            obj.labels_ = [];
             obj.modified_ = true;
         end
 
         function [flag, indices] = merge_(obj, oldlabels, newlabels)
+            obj.unshare(true);
             if nargout > 0
-                oldlabels_ = obj.get();
-            end
-
-            for i = 1:numel(oldlabels)
-                if strcmp(oldlabels{i}, newlabels{i}) || ~obj.uels_label2ids_.containsKey(oldlabels{i})
-                    continue
-                end
-                labels = obj.uels_id2labels_;
-                if obj.uels_label2ids_.containsKey(newlabels{i})
-                    labels(obj.uels_label2ids_.get(oldlabels{i})) = [];
-                else
-                    labels{obj.uels_label2ids_.get(oldlabels{i})} = newlabels{i};
-                end
-                obj.clear();
-                for j = 1:numel(labels)
-                    obj.uels_label2ids_.put(labels{j}, obj.uels_label2ids_.size() + 1);
-                end
-                obj.updateId2Label_();
-            end
-
-            if nargout > 0
-                [flag, indices] = obj.updatedIndices_(oldlabels_, oldlabels, newlabels);
+                [flag, indices] = gams.transfer.gdx.gt_label_set('merge', obj.handle_, oldlabels, newlabels);
+            else
+                gams.transfer.gdx.gt_label_set('merge', obj.handle_, oldlabels, newlabels);
             end
+            obj.labels_ = [];
             obj.modified_ = true;
         end
 
     end
 
-    methods (Hidden, Access = protected)
+    methods (Hidden, Access = private)
 
-        function updateId2Label_(obj)
-            obj.uels_id2labels_ = cell(1, obj.uels_label2ids_.keySet().size());
-            it = obj.uels_label2ids_.keySet().iterator();
-            i = 1;
-            while it.hasNext()
-                obj.uels_id2labels_{i} = char(it.next());
-                i = i + 1;
-            end
-            obj.modified_ = true;
+        function unshare(obj, keep)
+            % obtains an exclusive label set before modifying it (copying the labels if keep)
+            obj.handle_ = gams.transfer.gdx.gt_label_set('unshare', obj.handle_, keep);
         end
 
     end
@@ -0,0 +1,118 @@
+% Sorted unique that also works for Octave (internal)
+%
+% ------------------------------------------------------------------------------
+%
+% GAMS - General Algebraic Modeling System
+% GAMS Transfer Matlab
+%
+% Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+% Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+%
+% Permission is hereby granted, free of charge, to any person obtaining a copy
+% of this software and associated documentation files (the 'Software'), to deal
+% in the Software without restriction, including without limitation the rights
+% to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+% copies of the Software, and to permit persons to whom the Software is
+% furnished to do so, subject to the following conditions:
+%
+% The above copyright notice and this permission notice shall be included in all
+% copies or substantial portions of the Software.
+%
+% THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+% IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+% FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+% AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+% LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+% OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+% SOFTWARE.
+%
+% ------------------------------------------------------------------------------
+%
+% Topological order of nodes 1..n (internal)
+%
+% Kahn's algorithm on the dependencies from(k) -> to(k) (node from(k) must be placed before node
+% to(k)) in O(n + number of dependencies). Nodes are kept in their given order as far as possible:
+% A node is placed when the scan over 1..n reaches it and all its dependencies are placed, or
+% immediately after its last dependency is placed if the scan has passed it already. Thus, the
+% order is 1:n if all dependencies point forward.
+%
+% order: placed nodes in topological order
+% cyclic: nodes that are part of a cycle (or lie on a path between cycles). Nodes that are neither
+%         placed nor cyclic only depend on cyclic nodes.
+%
+% Attention: Internal classes or functions have limited documentation and its properties, methods
+% and method or function signatures can change without notice.
+%
+function [order, cyclic] = topological_order(n, from, to)
+    from = reshape(double(from), [], 1);
+    to = reshape(double(to), [], 1);
+    if isempty(from)
+        order = 1:n;
+        cyclic = zeros(1, 0);
+        return
+    end
+
+    % successors of node i: succ(succ_ptr(i)+1:succ_ptr(i+1))
+    [~, perm] = sort(from);
+    succ = to(perm);
+    succ_ptr = [0; cumsum(accumarray(from, 1, [n 1]))];
+    in_degree = accumarray(to, 1, [n 1]);
+
+    % Kahn's algorithm: nodes that become ready behind the scan position are queued
+    order = zeros(1, n);
+    n_order = 0;
+    queue = zeros(1, n);
+    for i = 1:n
+        if in_degree(i) > 0
+            continue
+        end
+        queue(1) = i;
+        head = 1;
+        tail = 1;
+        while head <= tail
+            node = queue(head);
+            head = head + 1;
+            n_order = n_order + 1;
+            order(n_order) = node;
+            for k = succ_ptr(node)+1:succ_ptr(node+1)
+                s = succ(k);
+                in_degree(s) = in_degree(s) - 1;
+                if in_degree(s) == 0 && s < i
+                    tail = tail + 1;
+                    queue(tail) = s;
+                end
+            end
+        end
+    end
+    order = order(1:n_order);
+    if n_order == n
+        cyclic = zeros(1, 0);
+        return
+    end
+
+    % remove unplaced nodes that no unplaced node depends on (reverse Kahn)
+    remaining = true(n, 1);
+    remaining(order) = false;
+    [~, perm] = sort(to);
+    pred = from(perm);
+    pred_ptr = [0; cumsum(accumarray(to, 1, [n 1]))];
+    out_degree = accumarray(from, double(remaining(from) & remaining(to)), [n 1]);
+    queue = find(remaining & out_degree == 0)';
+    head = 1;
+    while head <= numel(queue)
+        node = queue(head);
+        head = head + 1;
+        remaining(node) = false;
+        for k = pred_ptr(node)+1:pred_ptr(node+1)
+            p = pred(k);
+            if ~remaining(p)
+                continue
+            end
+            out_degree(p) = out_degree(p) - 1;
+            if out_degree(p) == 0
+                queue(end+1) = p; %#ok<AGROW>
+            end
+        end
+    end
+    cyclic = find(remaining)';
+end
@@ -96,7 +96,7 @@ classdef Container < gams.transfer.utils.Handle
     methods
 
         function data = get.data(obj)
-            data = obj.data_.entries_;
+            data = obj.data_.toStruct();
         end
 
         function modified = get.modified(obj)
@@ -141,7 +141,7 @@ classdef Container < gams.transfer.utils.Handle
         function obj = Container(varargin)
             % Constructs a GAMS Transfer Container, see class help
 
-            obj.data_ = gams.transfer.incase_ordered_dict.Struct();
+            obj.data_ = gams.transfer.incase_ordered_dict.Hashed();
 
             % parse input arguments
             has_source = false;
@@ -256,8 +256,9 @@ classdef Container < gams.transfer.utils.Handle
         %> See \ref GAMS_TRANSFER_MATLAB_CONTAINER_READ for more information.
         %>
         %> **Required Arguments:**
-        %> 1. source (`string` or `Container`):
-        %>    Path to GDX file or a \ref gams::transfer::Container "Container" object to be read
+        %> 1. source (`string`, `GDXSession` or `Container`):
+        %>    Path to GDX file, a \ref gams::transfer::GDXSession "GDXSession" of an open GDX file
+        %>    or a \ref gams::transfer::Container "Container" object to be read
         %>
         %> **Parameter Arguments:**
         %> - symbols (`cell`):
@@ -271,6 +272,27 @@ classdef Container < gams.transfer.utils.Handle
         %>   fields should be read. Default is all.
         %> - indexed (`logical`):
         %>   Specifies if indexed GDX should be read. Default is `false`.
+        %> - profile (`logical`):
+        %>   Enables profiling of reading. Default is `false`.
+        %> - cache (`logical`):
+        %>   Keeps a snapshot of the data read next to the GDX file (`<source>.snapshot`) and reuses
+        %>   it in later reads with the same arguments as long as the GDX file is unchanged. Ignored
+        %>   for indexed GDX or if profiling is enabled. Default is `false`.
+        %> - cache_verify (`logical`):
+        %>   Hashes the content of the GDX file on every cached read. Otherwise, the snapshot is
+        %>   validated on size and modification time of the GDX file, hashing its content only if
+        %>   these are ambiguous (GDX file modified shortly before the snapshot was written).
+        %>   Default is `false`.
+        %> - refresh (`logical`):
+        %>   Refreshes symbols that exist in the container already instead of raising an error. If
+        %>   records format, domain columns and unique labels of a symbol are unchanged, only the
+        %>   value columns read are replaced. Otherwise, all records are replaced. The symbol object
+        %>   and its domain are kept in both cases. Default is `false`.
+        %>
+        %> - `profile = c.read(_, 'profile', true)` returns a struct with a field for each read
+        %>   symbol (except aliases) holding the wall time in seconds per phase (`time`) as well as
+        %>   the number of records and UELs, the bytes of record arrays and the number of calls into
+        %>   Matlab. See \ref GAMS_TRANSFER_MATLAB_CONTAINER_READ for more information.
         %>
         %> **Example:**
         %> ```
@@ -278,13 +300,17 @@ classdef Container < gams.transfer.utils.Handle
         %> c.read('path/to/file.gdx');
         %> c.read('path/to/file.gdx', 'format', 'dense_matrix');
         %> c.read('path/to/file.gdx', 'symbols', {'x', 'z'}, 'format', 'struct', 'values', {'level'});
+        %> profile = c.read('path/to/file.gdx', 'profile', true);
+        %> c.read('path/to/file.gdx', 'cache', true);
+        %> c.read('path/to/file.gdx', 'symbols', {'x'}, 'values', {'level', 'marginal'}, 'refresh', true);
         %> ```
-        function read(obj, varargin)
+        function profile = read(obj, varargin)
             % Reads symbols from GDX file
             %
             % Required Arguments:
-            % 1. source (string or (Const)Container):
-            %    Path to GDX file, a (Const)Container object to be read
+            % 1. source (string, GDXSession or (Const)Container):
+            %    Path to GDX file, a GDXSession of an open GDX file or a (Const)Container object
+            %    to be read
             %
             % Parameter Arguments:
             % - symbols (cell):
@@ -298,12 +324,36 @@ classdef Container < gams.transfer.utils.Handle
             %   fields should be read. Default is all.
             % - indexed (logical):
             %   Specifies if indexed GDX should be read. Default is false.
+            % - profile (logical):
+            %   Enables profiling of reading. Default is false.
+            % - cache (logical):
+            %   Keeps a snapshot of the data read next to the GDX file (<source>.snapshot) and
+            %   reuses it in later reads with the same arguments as long as the GDX file is
+            %   unchanged. Ignored for indexed GDX or if profiling is enabled. Default is false.
+            % - cache_verify (logical):
+            %   Hashes the content of the GDX file on every cached read. Otherwise, the snapshot
+            %   is validated on size and modification time of the GDX file, hashing its content
+            %   only if these are ambiguous (GDX file modified shortly before the snapshot was
+            %   written). Default is false.
+            % - refresh (logical):
+            %   Refreshes symbols that exist in the container already instead of raising an error.
+            %   If records format, domain columns and unique labels of a symbol are unchanged, only
+            %   the value columns read are replaced. Otherwise, all records are replaced. The symbol
+            %   object and its domain are kept in both cases. Default is false.
+            %
+            % profile = c.read(_, 'profile', true) returns a struct with a field for each read
+            % symbol (except aliases) holding the wall time in seconds per phase (time) as well as
+            % the number of records and UELs, the bytes of record arrays and the number of calls
+            % into Matlab.
             %
             % Example:
             % c = Container();
             % c.read('path/to/file.gdx');
             % c.read('path/to/file.gdx', 'format', 'dense_matrix');
             % c.read('path/to/file.gdx', 'symbols', {'x', 'z'}, 'format', 'struct', 'values', {'level'});
+            % profile = c.read('path/to/file.gdx', 'profile', true);
+            % c.read('path/to/file.gdx', 'cache', true);
+            % c.read('path/to/file.gdx', 'symbols', {'x'}, 'values', {'level', 'marginal'}, 'refresh', true);
 
             % parse input arguments
             symbols = {};
@@ -312,11 +362,16 @@ classdef Container < gams.transfer.utils.Handle
             records = true;
             values = {'level', 'marginal', 'lower', 'upper', 'scale'};
             indexed = false;
+            with_profile = false;
+            cache = false;
+            cache_verify = false;
+            refresh = false;
+            profile = struct();
             try
                 gams.transfer.utils.Validator.minargin(numel(varargin), 1);
                 valid = gams.transfer.utils.Validator('source', 1, varargin{1}) ...
-                    .types({'gams.transfer.Container', 'string', 'char'});
-                if ~isa(valid.value, 'gams.transfer.Container')
+                    .types({'gams.transfer.Container', 'gams.transfer.GDXSession', 'string', 'char'});
+                if ~isa(valid.value, 'gams.transfer.Container') && ~isa(valid.value, 'gams.transfer.GDXSession')
                     valid.string2char().fileExtension('.gdx').fileExists();
                 end
                 source = valid.value;
@@ -353,6 +408,30 @@ classdef Container < gams.transfer.utils.Handle
                         indexed = gams.transfer.utils.Validator('indexed', index, varargin{index}) ...
                             .type('logical').scalar().value;
                         index = index + 1;
+                    elseif strcmpi(varargin{index}, 'profile')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        with_profile = gams.transfer.utils.Validator('profile', index, varargin{index}) ...
+                            .type('logical').scalar().value;
+                        index = index + 1;
+                    elseif strcmpi(varargin{index}, 'cache')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        cache = gams.transfer.utils.Validator('cache', index, varargin{index}) ...
+                            .type('logical').scalar().value;
+                        index = index + 1;
+                    elseif strcmpi(varargin{index}, 'cache_verify')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        cache_verify = gams.transfer.utils.Validator('cache_verify', index, ...
+                            varargin{index}).type('logical').scalar().value;
+                        index = index + 1;
+                    elseif strcmpi(varargin{index}, 'refresh')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        refresh = gams.transfer.utils.Validator('refresh', index, varargin{index}) ...
+                            .type('logical').scalar().value;
+                        index = index + 1;
                     else
                         error('Invalid argument at position %d', index);
                     end
@@ -379,13 +458,15 @@ classdef Container < gams.transfer.utils.Handle
                 format = int32(3);
             case 'sparse_matrix'
                 format = int32(4);
+            case 'sparse_tensor'
+                format = int32(6);
             case 'table'
                 format = int32(5);
                 if ~gams.transfer.Constants.SUPPORTS_TABLE
                     format = int32(2);
                 end
             otherwise
-                error('Argument ''format'' must be ''struct'', ''table'', ''dense_matrix'' or ''sparse_matrix''.');
+                error('Argument ''format'' must be ''struct'', ''table'', ''dense_matrix'', ''sparse_matrix'' or ''sparse_tensor''.');
             end
             values_bool = false(5,1);
             for e = values
@@ -406,24 +487,143 @@ classdef Container < gams.transfer.utils.Handle
             end
             values = values_bool;
 
-            % read records
-            if indexed
-                symbols = gams.transfer.gdx.gt_idx_read(source, symbols, format, records);
-            else
-                symbols = gams.transfer.gdx.gt_gdx_read(source, symbols, format, records, ...
-                    values, gams.transfer.Constants.SUPPORTS_CATEGORICAL, false);
+            % read from open GDX file (session handle instead of file name)
+            if isa(source, 'gams.transfer.GDXSession')
+                if ~source.isOpen()
+                    error('Argument ''source'' (at position 1) must be an open GDX session.');
+                end
+                if indexed
+                    error('Indexed GDX files cannot be read from a GDX session.');
+                end
+                cache = false;
+                source = source.handle_;
+            end
+
+            % snapshot of a previous read with same arguments (key) of unchanged GDX file
+            cache = cache && ~indexed && ~with_profile;
+            cache_hit = false;
+            if cache
+                cache_file = [source, '.snapshot'];
+                cache_key = sprintf('%s|%s|%d|%d|%s|%d', source, strjoin(reshape(symbols, 1, []), ','), format, ...
+                    records, sprintf('%d', values), gams.transfer.Constants.SUPPORTS_CATEGORICAL);
+                [outputs, cache_hit] = gams.transfer.gdx.gt_snapshot('read', cache_file, source, ...
+                    cache_key, cache_verify);
+                outputs = {outputs};
+            end
+
+            % read records (second output: profile)
+            if ~cache_hit
+                outputs = cell(1, 1 + with_profile);
+                if indexed
+                    [outputs{:}] = gams.transfer.gdx.gt_idx_read(source, symbols, format, records);
+                else
+                    [outputs{:}] = gams.transfer.gdx.gt_gdx_read(source, symbols, format, records, ...
+                        values, gams.transfer.Constants.SUPPORTS_CATEGORICAL, false);
+                end
+                if cache
+                    try
+                        gams.transfer.gdx.gt_snapshot('write', cache_file, source, cache_key, outputs{1});
+                    catch e
+                        warning('Cannot write snapshot of ''%s'': %s', source, e.message);
+                    end
+                end
+            end
+            symbols = outputs{1};
+            if with_profile
+                profile = outputs{2};
             end
             symbol_names = fieldnames(symbols);
 
+            % refresh symbols that exist already (symbol objects are kept)
+            refreshed_names = {};
+            if refresh
+                is_refreshed = false(1, numel(symbol_names));
+                for i = 1:numel(symbol_names)
+                    symbol = symbols.(symbol_names{i});
+                    if ~obj.hasSymbols(symbol.name)
+                        continue
+                    end
+                    is_refreshed(i) = true;
+                    old_symbol = obj.getSymbols(symbol.name);
+                    switch symbol.symbol_type
+                    case {gams.transfer.gdx.SymbolType.ALIAS, 'alias'}
+                        symbol_class = 'gams.transfer.alias.Abstract';
+                    case {gams.transfer.gdx.SymbolType.SET, 'set'}
+                        symbol_class = 'gams.transfer.symbol.Set';
+                    case {gams.transfer.gdx.SymbolType.PARAMETER, 'parameter'}
+                        symbol_class = 'gams.transfer.symbol.Parameter';
+                    case {gams.transfer.gdx.SymbolType.VARIABLE, 'variable'}
+                        symbol_class = 'gams.transfer.symbol.Variable';
+                    case {gams.transfer.gdx.SymbolType.EQUATION, 'equation'}
+                        symbol_class = 'gams.transfer.symbol.Equation';
+                    otherwise
+                        error('Invalid symbol type');
+                    end
+                    if ~isa(old_symbol, symbol_class) || (~isa(old_symbol, 'gams.transfer.alias.Abstract') && ...
+                        old_symbol.dimension ~= symbol.dimension)
+                        error('Symbol ''%s'' cannot be refreshed: Symbol type or dimension differs.', symbol.name);
+                    end
+                    if isa(old_symbol, 'gams.transfer.alias.Abstract') || ~isfield(symbol, 'format')
+                        continue
+                    end
+                    if isfield(symbol, 'uels')
+                        unique_labels = symbol.uels;
+                    else
+                        unique_labels = {};
+                    end
+                    old_symbol.refreshRecords_(gams.transfer.Container.createData(symbol.format, ...
+                        symbol.records), unique_labels);
+                    old_symbol.description_ = symbol.description;
+                end
+                refreshed_names = symbol_names(is_refreshed);
+                symbols = rmfield(symbols, refreshed_names);
+                symbol_names = symbol_names(~is_refreshed);
+            end
+
+            % resolve domains and aliased sets among the symbols read in one pass (symbol index or
+            % 0 if not read, self reference or relaxed domain) and create them before their
+            % dependent symbols (independent of the order stored in GDX)
+            n_symbols = numel(symbol_names);
+            references = repmat({{}}, 1, n_symbols);
+            is_relaxed = false(1, n_symbols);
+            for i = 1:n_symbols
+                symbol = symbols.(symbol_names{i});
+                if isfield(symbol, 'alias_with')
+                    references{i} = {symbol.alias_with};
+                elseif ~indexed
+                    references{i} = reshape(symbol.domain, 1, []);
+                    is_relaxed(i) = symbol.domain_type == 2;
+                end
+            end
+            n_references = cellfun(@numel, references);
+            [~, reference_index] = ismember(horzcat({}, references{:}), symbol_names);
+            reference_index = reshape(reference_index, 1, []);
+            to = repelem(1:n_symbols, n_references);
+            reference_index(reference_index == to | is_relaxed(to)) = 0;
+            references_ptr = [0, cumsum(n_references)];
+            is_dependency = reference_index > 0;
+            order = gams.transfer.utils.topological_order(n_symbols, reference_index(is_dependency), ...
+                to(is_dependency));
+            is_placed = false(1, n_symbols);
+            is_placed(order) = true;
+            order = [order, find(~is_placed)];
+
             % transform data into Symbol object
-            for i = 1:numel(symbol_names)
+            new_symbols = cell(1, n_symbols);
+            for i = order
                 symbol = symbols.(symbol_names{i});
+                symbol_references = reference_index(references_ptr(i)+1:references_ptr(i+1));
+                if with_profile
+                    time_objects = tic;
+                end
 
                 % create symbol object
                 switch symbol.symbol_type
                 case {gams.transfer.gdx.SymbolType.ALIAS, 'alias'}
                     if strcmp(symbol.alias_with, gams.transfer.Constants.UNIVERSE_NAME)
                         new_symbol = gams.transfer.alias.Universe(obj, symbol.name);
+                    elseif symbol_references(1) > 0 && ~isempty(new_symbols{symbol_references(1)})
+                        new_symbol = gams.transfer.alias.Set(obj, symbol.name, new_symbols{symbol_references(1)});
                     elseif obj.hasSymbols(symbol.alias_with)
                         new_symbol = gams.transfer.alias.Set(obj, symbol.name, obj.getSymbols(symbol.alias_with));
                     else
@@ -441,18 +641,19 @@ classdef Container < gams.transfer.utils.Handle
                     error('Invalid symbol type');
                 end
                 obj.data_ = obj.data_.add(symbol.name, new_symbol);
+                new_symbols{i} = new_symbol;
                 if isa(new_symbol, 'gams.transfer.alias.Abstract')
                     continue
                 end
 
-                % set domain
+                % set domain (scalars keep the default)
                 if indexed
                     new_symbol.size = symbol.size;
-                else
+                elseif numel(symbol.domain) > 0
                     for j = 1:numel(symbol.domain)
-                        if ~strcmp(symbol.domain{j}, gams.transfer.Constants.UNIVERSE_NAME) && ...
-                            symbol.domain_type ~= 2 && obj.hasSymbols(symbol.domain{j}) && ...
-                            isfield(symbols, symbol.domain{j}) && ~strcmpi(symbol.name, symbol.domain{j})
+                        if symbol_references(j) > 0 && ~isempty(new_symbols{symbol_references(j)})
+                            symbol.domain{j} = new_symbols{symbol_references(j)};
+                        elseif symbol.domain_type ~= 2 && any(strcmpi(symbol.domain{j}, refreshed_names))
                             symbol.domain{j} = obj.getSymbols(symbol.domain{j});
                         end
                     end
@@ -461,23 +662,12 @@ classdef Container < gams.transfer.utils.Handle
 
                 % set data
                 if isfield(symbol, 'format')
-                    switch symbol.format
-                    case {1, 2}
-                        new_symbol.data_ = gams.transfer.symbol.data.Struct(symbol.records);
-                    case 3
-                        new_symbol.data_ = gams.transfer.symbol.data.DenseMatrix(symbol.records);
-                    case 4
-                        new_symbol.data_ = gams.transfer.symbol.data.SparseMatrix(symbol.records);
-                    case 5
-                        new_symbol.data_ = gams.transfer.symbol.data.Table(symbol.records);
-                    end
+                    new_symbol.data_ = gams.transfer.Container.createData(symbol.format, symbol.records);
                 end
 
-                % set uels
+                % set uels (label sets are created on first access)
                 if isfield(symbol, 'uels')
-                    for j = 1:new_symbol.dimension
-                        new_symbol.unique_labels{j} = gams.transfer.unique_labels.OrderedLabelSet(symbol.uels{j});
-                    end
+                    new_symbol.deferred_unique_labels_ = symbol.uels;
                 end
 
                 % set other properties
@@ -485,6 +675,13 @@ classdef Container < gams.transfer.utils.Handle
                 if isfield(symbol, 'domain_labels') && numel(symbol.domain_labels) == symbol.dimension
                     new_symbol.def_.setDomainLabels_(symbol.domain_labels);
                 end
+
+                % add time of creating Matlab objects to profile
+                if with_profile && isfield(profile, symbol_names{i})
+                    time_objects = toc(time_objects);
+                    profile.(symbol_names{i}).time.objects = time_objects;
+                    profile.(symbol_names{i}).time.total = profile.(symbol_names{i}).time.total + time_objects;
+                end
             end
         end
 
@@ -501,23 +698,46 @@ classdef Container < gams.transfer.utils.Handle
         %>   List of symbols to be written. List of symbols to be considered. Case doesn't matter. Default is all.
         %> - compress (`logical`):
         %>   Flag to compress GDX file (`true`) or not (`false`). Default is `false`.
+        %> - compress_threshold (`double`):
+        %>   Minimum number of values (see \ref gams::transfer::symbol::Abstract::getNumberValues
+        %>   "symbol.Abstract.getNumberValues") of all symbols to be written for which compression is
+        %>   applied. Smaller GDX files are written uncompressed. GDX only supports compressing
+        %>   the whole file at a fixed level, so there are no compression levels, per-symbol
+        %>   thresholds or parallel compression. Symbols copied from `source` are counted by their
+        %>   number of records in the source GDX file. Default is `0`.
         %> - sorted (`logical`):
-        %>   Flag to define records as sorted (`true`) or not (`false`). Default is `false`.
+        %>   Flag to define records as sorted (`true`) or not (`false`). For records format
+        %>   `sparse_tensor`, sorted means row-major order of the (column-major) linear index, i.e.
+        %>   the last dimension varies fastest; other orders raise an error. Default is `false`.
         %> - uel_priority (`cellstr`):
         %>   UELs to be registered first before any symbol UELs. Default: `{}`.
         %> - indexed (`logical`):
         %>   Specifies if indexed GDX should be written. Default is `false`.
         %> - eps_to_zero (`logical`):
         %>   Specifies if EPS values should be written as zero. Default is `true`.
+        %> - source (`string`):
+        %>   Path to GDX file the container has been read from. Records of symbols that have not
+        %>   been \ref gams::transfer::symbol::Abstract::modified "modified" are copied from this
+        %>   file instead of being written from their records (`eps_to_zero` applies to them as
+        %>   well). Default is `''` (no source).
+        %> - profile (`logical`):
+        %>   Enables profiling of writing. Default is `false`.
+        %>
+        %> - `profile = c.write(_, 'profile', true)` returns a struct with a field for each written
+        %>   symbol (except aliases) holding the wall time in seconds per phase (`time`) as well as
+        %>   the number of records and UELs, the bytes of record arrays and the number of calls into
+        %>   Matlab.
         %>
         %> **Example:**
         %> ```
         %> c.write('path/to/file.gdx');
         %> c.write('path/to/file.gdx', 'compress', true, 'sorted', true);
+        %> c.write('path/to/file.gdx', 'source', 'path/to/source.gdx');
+        %> profile = c.write('path/to/file.gdx', 'profile', true);
         %> ```
         %>
         %> @see \ref gams::transfer::Container::getDomainViolations "Container.getDomainViolations"
-        function write(obj, varargin)
+        function profile = write(obj, varargin)
             % Writes symbols with symbol records to GDX file
             %
             % There are different issues that can occur when writing to GDX: e.g. domain violations
@@ -539,28 +759,55 @@ classdef Container < gams.transfer.utils.Handle
             %   List of symbols to be written. Case doesn't matter. Default is all.
             % - compress (logical):
             %   Flag to compress GDX file (true) or not (false). Default is false.
+            % - compress_threshold (double):
+            %   Minimum number of values (see gams.transfer.symbol.Abstract.getNumberValues) of all
+            %   symbols to be written for which compression is applied. Smaller GDX files are
+            %   written uncompressed. GDX only supports compressing the whole file at a fixed
+            %   level, so there are no compression levels, per-symbol thresholds or parallel
+            %   compression. Symbols copied from source are counted by their number of records in
+            %   the source GDX file. Default is 0.
             % - sorted (logical):
-            %   Flag to define records as sorted (true) or not (false). Default is false.
+            %   Flag to define records as sorted (true) or not (false). For records format
+            %   sparse_tensor, sorted means row-major order of the (column-major) linear index,
+            %   i.e. the last dimension varies fastest; other orders raise an error. Default is
+            %   false.
             % - uel_priority (cellstr):
             %   UELs to be registered first before any symbol UELs. Default: {}.
             % - indexed (logical):
             %   Specifies if indexed GDX should be written. Default is false.
             % - eps_to_zero (logical):
             %   Specifies if EPS values should be written as zero. Default is true.
+            % - source (string):
+            %   Path to GDX file the container has been read from. Records of symbols that have
+            %   not been modified are copied from this file instead of being written from their
+            %   records (eps_to_zero applies to them as well). Default is '' (no source).
+            % - profile (logical):
+            %   Enables profiling of writing. Default is false.
+            %
+            % profile = c.write(_, 'profile', true) returns a struct with a field for each written
+            % symbol (except aliases) holding the wall time in seconds per phase (time) as well as
+            % the number of records and UELs, the bytes of record arrays and the number of calls
+            % into Matlab.
             %
             % Example:
             % c.write('path/to/file.gdx');
             % c.write('path/to/file.gdx', 'compress', true, 'sorted', true);
+            % c.write('path/to/file.gdx', 'source', 'path/to/source.gdx');
+            % profile = c.write('path/to/file.gdx', 'profile', true);
             %
             % See also: gams.transfer.Container.getDomainViolations
 
             % parse input arguments
             has_symbols = false;
             compress = false;
+            compress_threshold = 0;
             sorted = false;
             uel_priority = {};
             indexed = false;
             eps_to_zero = true;
+            source = '';
+            with_profile = false;
+            profile = struct();
             try
                 gams.transfer.utils.Validator.minargin(numel(varargin), 1);
                 filename = gams.transfer.utils.absolute_path(gams.transfer.utils.Validator(...
@@ -586,6 +833,12 @@ classdef Container < gams.transfer.utils.Handle
                         compress = gams.transfer.utils.Validator('compress', index, varargin{index}) ...
                             .type('logical').scalar().value;
                         index = index + 1;
+                    elseif strcmpi(varargin{index}, 'compress_threshold')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        compress_threshold = gams.transfer.utils.Validator('compress_threshold', ...
+                            index, varargin{index}).integer().scalar().min(0).value;
+                        index = index + 1;
                     elseif strcmpi(varargin{index}, 'sorted')
                         index = index + 1;
                         gams.transfer.utils.Validator.minargin(numel(varargin), index);
@@ -604,6 +857,19 @@ classdef Container < gams.transfer.utils.Handle
                         eps_to_zero = gams.transfer.utils.Validator('eps_to_zero', index, varargin{index}) ...
                             .type('logical').scalar().value;
                         index = index + 1;
+                    elseif strcmpi(varargin{index}, 'source')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        source = gams.transfer.utils.absolute_path(gams.transfer.utils.Validator(...
+                            'source', index, varargin{index}).string2char().type('char') ...
+                            .fileExtension('.gdx').fileExists().value);
+                        index = index + 1;
+                    elseif strcmpi(varargin{index}, 'profile')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        with_profile = gams.transfer.utils.Validator('profile', index, varargin{index}) ...
+                            .type('logical').scalar().value;
+                        index = index + 1;
                     else
                         error('Invalid argument at position %d', index);
                     end
@@ -648,16 +914,68 @@ classdef Container < gams.transfer.utils.Handle
             if compress && indexed
                 error('Compression not supported for indexed GDX.');
             end
+            if ~isempty(source) && indexed
+                error('Source GDX not supported for indexed GDX.');
+            end
+            if ~isempty(source) && strcmp(source, filename)
+                error('Source GDX must differ from GDX file to write to.');
+            end
 
-            % write data
+            % create copy flags: unmodified symbols are copied from source GDX
+            copy = false(size(enable));
+            if ~isempty(source)
+                entries = obj.data_.entries();
+                for i = 1:numel(entries)
+                    copy(i) = enable(i) && ~entries{i}.modified;
+                end
+            end
+
+            % skip compression for small files (compression is applied to the whole file by GDX);
+            % records of copied symbols may not have been read, so they are counted in source GDX
+            if compress && compress_threshold > 0
+                entries = obj.data_.entries();
+                source_nrecs = nan(size(enable));
+                if any(copy)
+                    source_symbols = gams.transfer.gdx.gt_gdx_read(source, {}, int32(2), false, ...
+                        false(5,1), gams.transfer.Constants.SUPPORTS_CATEGORICAL, false);
+                    source_names = fieldnames(source_symbols);
+                    [is_source, source_idx] = ismember(lower(obj.data_.keys()), lower(source_names));
+                    for i = find(copy(:)' & is_source(:)')
+                        source_nrecs(i) = double(source_symbols.(source_names{source_idx(i)}).number_records);
+                    end
+                end
+                n_values = 0;
+                for i = 1:numel(entries)
+                    if ~enable(i) || ~isa(entries{i}, 'gams.transfer.symbol.Abstract')
+                        continue
+                    end
+                    if isnan(source_nrecs(i))
+                        n_values = n_values + entries{i}.getNumberValues();
+                    else
+                        n_values = n_values + source_nrecs(i) * numel(entries{i}.def.values);
+                    end
+                    if n_values >= compress_threshold
+                        break
+                    end
+                end
+                compress = n_values >= compress_threshold;
+            end
+
+            % write data (optional output: profile)
             if indexed
-                gams.transfer.gdx.gt_idx_write(filename, obj.data_.entries_, ...
-                    enable, sorted, eps_to_zero, gams.transfer.Constants.SUPPORTS_TABLE);
+                write_fun = @gams.transfer.gdx.gt_idx_write;
+                args = {filename, obj.data_.toStruct(), enable, sorted, eps_to_zero, ...
+                    gams.transfer.Constants.SUPPORTS_TABLE};
+            else
+                write_fun = @gams.transfer.gdx.gt_gdx_write;
+                args = {filename, obj.data_.toStruct(), enable, uel_priority, compress, sorted, ...
+                    eps_to_zero, gams.transfer.Constants.SUPPORTS_TABLE, ...
+                    gams.transfer.Constants.SUPPORTS_CATEGORICAL, source, copy};
+            end
+            if with_profile
+                profile = write_fun(args{:});
             else
-                gams.transfer.gdx.gt_gdx_write(filename, obj.data_.entries_, ...
-                    enable, uel_priority, compress, sorted, eps_to_zero, ...
-                    gams.transfer.Constants.SUPPORTS_TABLE, ...
-                    gams.transfer.Constants.SUPPORTS_CATEGORICAL);
+                write_fun(args{:});
             end
         end
 
@@ -890,10 +1208,108 @@ classdef Container < gams.transfer.utils.Handle
             end
         end
 
+        function symbols = resolveUELSymbols(obj, symbols)
+            % symbols owning the UELs of the given symbols: aliases are replaced by their aliased
+            % set (universe alias: all symbols) and duplicates are dropped
+            if any(cellfun(@(s) isa(s, 'gams.transfer.alias.Universe'), symbols))
+                symbols = obj.data_.entries();
+            end
+            for i = 1:numel(symbols)
+                while isa(symbols{i}, 'gams.transfer.alias.Set')
+                    symbols{i} = symbols{i}.alias_with;
+                end
+            end
+            symbols = symbols(cellfun(@(s) isa(s, 'gams.transfer.symbol.Abstract'), symbols));
+            if isempty(symbols)
+                return
+            end
+            names = cellfun(@(s) lower(s.name), symbols, 'UniformOutput', false);
+            [~, idx] = unique(names, 'first');
+            symbols = symbols(sort(idx));
+        end
+
+        function convertUELs(obj, symbols, convert)
+            % converts the union of UELs of all axes once and merges the changed UELs of each axis
+            % (labels of axes modified before are converted separately)
+            symbols = obj.resolveUELSymbols(symbols);
+            union = gams.transfer.unique_labels.OrderedLabelSet();
+            for i = 1:numel(symbols)
+                for j = 1:symbols{i}.dimension
+                    union.add_(symbols{i}.getAxisLabels_(j));
+                end
+            end
+            converted = convert(union.get());
+
+            for i = 1:numel(symbols)
+                for j = 1:symbols{i}.dimension
+                    labels = symbols{i}.getAxisLabels_(j);
+                    if isempty(labels)
+                        continue
+                    end
+                    [flag, indices] = union.find_(labels);
+                    newlabels = labels;
+                    newlabels(flag) = converted(indices(flag));
+                    newlabels(~flag) = convert(labels(~flag));
+                    changed = ~strcmp(labels, newlabels);
+                    if any(changed(:))
+                        symbols{i}.mergeAxisLabels_(j, labels(changed), newlabels(changed));
+                    end
+                end
+            end
+        end
+
     end
 
     methods (Hidden, Static, Access = private)
 
+        function data = createData(format, records)
+            % records data object of records read in given format (GDX reader format id)
+            switch format
+            case {1, 2}
+                data = gams.transfer.symbol.data.Struct(records);
+            case 3
+                data = gams.transfer.symbol.data.DenseMatrix(records);
+            case 4
+                data = gams.transfer.symbol.data.SparseMatrix(records);
+            case 5
+                data = gams.transfer.symbol.data.Table(records);
+            case 6
+                data = gams.transfer.symbol.data.SparseTensor(records);
+            otherwise
+                error('Invalid records format');
+            end
+        end
+
+        function names = getDependencyNames(symbol)
+            % names of symbols that must precede symbol in GDX (domain sets or aliased set)
+            if isa(symbol, 'gams.transfer.alias.Set')
+                names = {symbol.alias_with.name};
+            elseif isa(symbol, 'gams.transfer.symbol.Abstract')
+                domains = symbol.def.domains;
+                names = cell(1, numel(domains));
+                is_regular = false(1, numel(domains));
+                for i = 1:numel(domains)
+                    if isa(domains{i}, 'gams.transfer.symbol.domain.Regular')
+                        names{i} = domains{i}.name;
+                        is_regular(i) = true;
+                    end
+                end
+                names = names(is_regular);
+            else
+                names = {};
+            end
+        end
+
+        function [from, to] = findDependencies(names, dependencies)
+            % dependency edges from(k) -> to(k) as indices into names (case insensitive), where
+            % dependencies{i} lists the names node i depends on; unknown names are ignored
+            to = repelem(1:numel(names), cellfun(@numel, dependencies));
+            dependencies = cellfun(@(x) reshape(x, 1, []), dependencies, 'UniformOutput', false);
+            [is_known, from] = ismember(lower(horzcat({}, dependencies{:})), lower(names));
+            from = from(is_known);
+            to = to(is_known);
+        end
+
         function [is_valid, types] = parseArgumentsListSymbols(args, has_types)
             is_valid = nan;
             types = {};
@@ -1892,26 +2308,19 @@ classdef Container < gams.transfer.utils.Handle
             end
 
             if isstring(names) || ischar(names)
-                names = {names};
+                names = cellstr(names);
             end
 
-            removed_symbols = cell(1, numel(names));
-            j = 0;
             % remove symbols from data
-            for i = 1:numel(names)
-                if ~obj.hasSymbols(names{i})
-                    continue;
-                end
-                j = j + 1;
-                removed_symbols{j} = obj.getSymbols(names{i});
-
-                % remove symbol
-                obj.data_ = obj.data_.remove(removed_symbols{j}.name);
+            names = names(obj.hasSymbols(names));
+            removed_symbols = obj.getSymbols(names);
+            obj.data_ = obj.data_.remove(names);
 
-                % force recheck of deleted symbol (it may still live within an
-                % alias, domain or in the user's program)
-                removed_symbols{j}.isValid(false, true);
-                removed_symbols{j}.container = [];
+            % force recheck of deleted symbol (it may still live within an alias, domain or in the
+            % user's program)
+            for i = 1:numel(removed_symbols)
+                removed_symbols{i}.isValid(false, true);
+                removed_symbols{i}.container = [];
             end
 
             % remove aliases to removed sets
@@ -1947,70 +2356,28 @@ classdef Container < gams.transfer.utils.Handle
 
             symbols = obj.getSymbols();
 
-            % get number of set/alias
-            n_sets = 0;
-            for i = 1:numel(symbols)
-                if isa(symbols{i}, 'gams.transfer.symbol.Set') || isa(symbols{i}, 'gams.transfer.alias.Abstract')
-                    n_sets = n_sets + 1;
-                end
-            end
-            n_other = numel(symbols) - n_sets;
-
-            sets = cell(1, n_sets);
-            idx_sets = zeros(1, n_sets);
-            idx_other = zeros(1, n_other);
-            n_sets = 0;
-            n_other = 0;
-
             % get index by type
+            is_set = false(1, numel(symbols));
             for i = 1:numel(symbols)
-                if isa(symbols{i}, 'gams.transfer.symbol.Set') || isa(symbols{i}, 'gams.transfer.alias.Abstract')
-                    n_sets = n_sets + 1;
-                    idx_sets(n_sets) = i;
-                    sets{n_sets} = symbols{i}.name;
-                else
-                    n_other = n_other + 1;
-                    idx_other(n_other) = i;
-                end
+                is_set(i) = isa(symbols{i}, 'gams.transfer.symbol.Set') || ...
+                    isa(symbols{i}, 'gams.transfer.alias.Abstract');
             end
+            idx_sets = find(is_set);
+            idx_other = find(~is_set);
 
             % handle set dependencies
-            if n_sets > 0
-                n_handled = 0;
-                set_handled = containers.Map(sets, false(1, n_sets));
-                set_avail = true(1, n_sets);
-                idx = 1:n_sets;
-
-                while n_handled < n_sets
-                    % check if we can add the next set
-                    curr_is_next = true;
-                    current_set = obj.getSymbols(sets{idx(n_handled+1)});
-                    for i = 1:current_set.dimension
-                        if (isa(current_set.domain{i}, 'gams.transfer.symbol.Set') || ...
-                            isa(current_set.domain{i}, 'gams.transfer.alias.Abstract')) && ...
-                            ~set_handled(current_set.domain{i}.name)
-                            curr_is_next = false;
-                            break;
-                        end
-                    end
-                    set_avail(idx(n_handled+1)) = false;
-                    if curr_is_next
-                        n_handled = n_handled + 1;
-                        set_handled(current_set.name) = true;
-                        set_avail(idx(n_handled+1:end)) = true;
-                        continue;
-                    end
-
-                    % find next available
-                    next_avail = find(set_avail(idx(n_handled+1:end)), 1);
-                    if isempty(next_avail)
-                        l = gams.transfer.utils.list2str(sets(idx(n_handled+1:end)));
-                        error('Circular domain set dependency in: %s.', l);
-                    end
-                    next_avail = next_avail + n_handled;
-                    tmp = idx(next_avail);
-                    idx(n_handled+2:next_avail) = idx(n_handled+1:next_avail-1);
-                    idx(n_handled+1) = tmp;
+            if numel(idx_sets) > 0
+                sets = cell(1, numel(idx_sets));
+                dependencies = cell(1, numel(idx_sets));
+                for i = 1:numel(idx_sets)
+                    sets{i} = symbols{idx_sets(i)}.name;
+                    dependencies{i} = gams.transfer.Container.getDependencyNames(symbols{idx_sets(i)});
+                end
+                [from, to] = gams.transfer.Container.findDependencies(sets, dependencies);
+                [idx, cyclic] = gams.transfer.utils.topological_order(numel(sets), from, to);
+                if ~isempty(cyclic)
+                    l = gams.transfer.utils.list2str(sets(cyclic));
+                    error('Circular domain set dependency in: %s.', l);
                 end
 
                 idx_sets = idx_sets(idx);
@@ -2417,28 +2784,16 @@ classdef Container < gams.transfer.utils.Handle
                 error(e.message);
             end
 
-            % check for correct order of symbols
-            correct_order = true;
-            symbol_defined = struct();
+            % check for correct order of symbols (dependencies must precede the symbol)
+            names = cell(1, numel(symbols));
+            dependencies = cell(1, numel(symbols));
             for i = 1:numel(symbols)
-                symbol_defined.(symbols{i}.name) = true;
-                if ~isa(symbols{i}, 'gams.transfer.symbol.Abstract')
-                    continue
-                end
-                for j = 1:numel(symbols{i}.def.domains)
-                    domain = symbols{i}.def.domains{j};
-                    if ~isa(domain, 'gams.transfer.symbol.domain.Regular')
-                        continue
-                    end
-                    correct_order = isfield(symbol_defined, domain.name) && symbol_defined.(domain.name);
-                    if ~correct_order
-                        break;
-                    end
-                end
-                if ~correct_order
-                    break;
-                end
+                names{i} = symbols{i}.name;
+                dependencies{i} = gams.transfer.Container.getDependencyNames(symbols{i});
             end
+            [from, to] = gams.transfer.Container.findDependencies(names, dependencies);
+            positions = obj.data_.find(names);
+            correct_order = all(positions(from) <= positions(to));
             if ~correct_order
                 obj.reorderSymbols();
             end
@@ -2494,12 +2849,24 @@ classdef Container < gams.transfer.utils.Handle
                 error(e.message);
             end
 
-            uels = {};
+            % gather the union of UELs of all axes in one hashed label set
+            union = gams.transfer.unique_labels.OrderedLabelSet();
             for i = 1:numel(symbols)
                 if isa(symbols{i}, 'gams.transfer.alias.Abstract')
                     continue
                 end
-                uels = gams.transfer.utils.unique([uels; symbols{i}.getUELs('ignore_unused', ignore_unused)]);
+                for j = 1:symbols{i}.dimension
+                    if ignore_unused
+                        union.add_(symbols{i}.getUsedAxisLabels_(j));
+                    else
+                        union.add_(symbols{i}.getAxisLabels_(j));
+                    end
+                end
+            end
+            if union.count() == 0
+                uels = {};
+            else
+                uels = reshape(union.get(), [], 1);
             end
         end
 
@@ -2543,8 +2910,25 @@ classdef Container < gams.transfer.utils.Handle
                 error(e.message);
             end
 
+            if isempty(uels)
+                for i = 1:numel(symbols)
+                    symbols{i}.removeUELs();
+                end
+                return
+            end
+
+            % look up the UELs of each axis in one hashed index of the UELs to be removed and only
+            % update axes that hold any of them
+            index = gams.transfer.unique_labels.OrderedLabelSet(cellstr(uels));
+            symbols = obj.resolveUELSymbols(symbols);
             for i = 1:numel(symbols)
-                symbols{i}.removeUELs(uels);
+                for j = 1:symbols{i}.dimension
+                    labels = symbols{i}.getAxisLabels_(j);
+                    flag = index.find_(labels);
+                    if any(flag(:))
+                        symbols{i}.removeAxisLabels_(j, labels(flag));
+                    end
+                end
             end
         end
 
@@ -2596,8 +2980,47 @@ classdef Container < gams.transfer.utils.Handle
                 error(e.message);
             end
 
+            % a full list of UELs applies to each axis separately
+            if ~isstruct(uels) && ~isa(uels, 'containers.Map')
+                for i = 1:numel(symbols)
+                    symbols{i}.renameUELs(uels, 'allow_merge', allow_merge);
+                end
+                return
+            end
+
+            if isa(uels, 'containers.Map')
+                oldlabels = gams.transfer.utils.Validator('keys(uels)', 1, keys(uels)).cellstr().value;
+                newlabels = values(uels);
+            else
+                oldlabels = gams.transfer.utils.Validator('fieldnames(uels)', 1, fieldnames(uels)).cellstr().value;
+                newlabels = struct2cell(uels);
+            end
+            oldlabels = reshape(oldlabels, 1, []);
+            newlabels = reshape(newlabels, 1, []);
+
+            % look up the UELs of each axis in one hashed index of the old UELs and pass only the
+            % pairs found (in given order). Merging chains (a new UEL is renamed itself) depend on
+            % UELs created by previous pairs and therefore need all pairs.
+            index = gams.transfer.unique_labels.OrderedLabelSet(oldlabels);
+            all_pairs = allow_merge && any(index.find_(newlabels));
+            symbols = obj.resolveUELSymbols(symbols);
             for i = 1:numel(symbols)
-                symbols{i}.renameUELs(uels, 'allow_merge', allow_merge);
+                for j = 1:symbols{i}.dimension
+                    [flag, indices] = index.find_(symbols{i}.getAxisLabels_(j));
+                    if ~any(flag(:))
+                        continue
+                    end
+                    if all_pairs
+                        pairs = 1:numel(oldlabels);
+                    else
+                        pairs = sort(indices(flag));
+                    end
+                    if allow_merge
+                        symbols{i}.mergeAxisLabels_(j, oldlabels(pairs), newlabels(pairs));
+                    else
+                        symbols{i}.renameAxisLabels_(j, oldlabels(pairs), newlabels(pairs));
+                    end
+                end
             end
         end
 
@@ -2619,9 +3042,7 @@ classdef Container < gams.transfer.utils.Handle
                 error(e.message);
             end
 
-            for i = 1:numel(symbols)
-                symbols{i}.lowerUELs();
-            end
+            obj.convertUELs(symbols, @lower);
         end
 
         %> Converts UELs to upper case
@@ -2642,9 +3063,7 @@ classdef Container < gams.transfer.utils.Handle
                 error(e.message);
             end
 
-            for i = 1:numel(symbols)
-                symbols{i}.upperUELs();
-            end
+            obj.convertUELs(symbols, @upper);
         end
 
     end
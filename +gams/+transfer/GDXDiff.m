@@ -0,0 +1,262 @@
+% GAMS GDX Diff
+%
+% ------------------------------------------------------------------------------
+%
+% GAMS - General Algebraic Modeling System
+% GAMS Transfer Matlab
+%
+% Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+% Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+%
+% Permission is hereby granted, free of charge, to any person obtaining a copy
+% of this software and associated documentation files (the 'Software'), to deal
+% in the Software without restriction, including without limitation the rights
+% to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+% copies of the Software, and to permit persons to whom the Software is
+% furnished to do so, subject to the following conditions:
+%
+% The above copyright notice and this permission notice shall be included in all
+% copies or substantial portions of the Software.
+%
+% THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+% IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+% FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+% AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+% LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+% OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+% SOFTWARE.
+%
+% ------------------------------------------------------------------------------
+% GAMS GDX Diff
+%
+% Compares the symbols of two GDX files without reading them into a Container. Records of each
+% symbol are merged from both files in label order and value fields are compared with absolute and
+% relative tolerances. Only differing records are kept.
+%
+% Example:
+% d = GDXDiff('path/to/first.gdx', 'path/to/second.gdx', 'rtol', 1e-6);
+% d.isEqual()
+% d.summary(1)
+% d.records.x
+
+%> @brief GAMS GDX Diff
+%>
+%> Compares the symbols of two GDX files without reading them into a \ref
+%> gams::transfer::Container "Container". Records of each symbol are merged from both files in
+%> label order and value fields are compared with absolute and relative tolerances. Only differing
+%> records are kept.
+%>
+%> **Example:**
+%> ```
+%> d = GDXDiff('path/to/first.gdx', 'path/to/second.gdx', 'rtol', 1e-6);
+%> d.isEqual()
+%> d.summary(1)
+%> d.records.x
+%> ```
+classdef GDXDiff
+
+    properties (SetAccess = private)
+
+        %> Absolute path of first GDX file
+
+        % first Absolute path of first GDX file
+        first = ''
+
+
+        %> Absolute path of second GDX file
+
+        % second Absolute path of second GDX file
+        second = ''
+
+
+        %> Comparison summary per symbol (struct array)
+        %>
+        %> Fields: `name`, `symbol_type`, `dimension`, `status` (`equal`, `different`,
+        %> `only_first`, `only_second` or `incompatible` if symbol type or dimension differ),
+        %> `number_records` (in first and second file, `NaN` if symbol is missing),
+        %> `number_only_first`, `number_only_second`, `number_changed` and `max_abs_diff`,
+        %> `max_rel_diff` (per value field over records contained in both files; special values
+        %> excluded).
+
+        % summary Comparison summary per symbol (struct array)
+        %
+        % Fields: name, symbol_type, dimension, status (equal, different, only_first, only_second
+        % or incompatible if symbol type or dimension differ), number_records (in first and second
+        % file, NaN if symbol is missing), number_only_first, number_only_second, number_changed
+        % and max_abs_diff, max_rel_diff (per value field over records contained in both files;
+        % special values excluded).
+        summary = struct([])
+
+
+        %> Differing records per symbol (struct)
+        %>
+        %> Records of a symbol hold the domain columns, the column `change` (`only_first`,
+        %> `only_second` or `changed`) and the value columns of both files (e.g. `level_first` and
+        %> `level_second` or `element_text_first` and `element_text_second` for sets). Records
+        %> missing in a file hold the default values. Records are stored in table format if
+        %> supported and in struct format otherwise. Symbols without differing records are not
+        %> listed.
+
+        % records Differing records per symbol (struct)
+        %
+        % Records of a symbol hold the domain columns, the column change (only_first, only_second
+        % or changed) and the value columns of both files (e.g. level_first and level_second or
+        % element_text_first and element_text_second for sets). Records missing in a file hold the
+        % default values. Records are stored in table format if supported and in struct format
+        % otherwise. Symbols without differing records are not listed.
+        records = struct()
+
+    end
+
+    methods
+
+        %> Compares two GDX files
+        %>
+        %> **Required Arguments:**
+        %> 1. first (`string`):
+        %>    Path to first GDX file.
+        %> 2. second (`string`):
+        %>    Path to second GDX file.
+        %>
+        %> **Parameter Arguments:**
+        %> - symbols (`cell`):
+        %>   List of symbols to be compared. All symbols of both files if empty. Case doesn't
+        %>   matter. Default is all.
+        %> - atol (`double` or `struct`):
+        %>   Absolute tolerance for all value fields or a struct with tolerances per value field
+        %>   (`value`, `level`, `marginal`, `lower`, `upper`, `scale`; missing fields are 0).
+        %>   Default is 0.
+        %> - rtol (`double` or `struct`):
+        %>   Relative tolerance (relative to the larger absolute value) for all value fields or
+        %>   per value field (see `atol`). Default is 0.
+        %>
+        %> Values `a` and `b` are equal if `abs(a - b) <= atol` or `abs(a - b) <= rtol *
+        %> max(abs(a), abs(b))`. Special values are only equal to the same special value (GAMS
+        %> `EPS` differs from 0). Labels are compared case insensitive. Explanatory texts of set
+        %> elements are compared exactly.
+        function obj = GDXDiff(varargin)
+            % Compares two GDX files
+            %
+            % Required Arguments:
+            % 1. first (string):
+            %    Path to first GDX file.
+            % 2. second (string):
+            %    Path to second GDX file.
+            %
+            % Parameter Arguments:
+            % - symbols (cell):
+            %   List of symbols to be compared. All symbols of both files if empty. Case doesn't
+            %   matter. Default is all.
+            % - atol (double or struct):
+            %   Absolute tolerance for all value fields or a struct with tolerances per value
+            %   field (value, level, marginal, lower, upper, scale; missing fields are 0). Default
+            %   is 0.
+            % - rtol (double or struct):
+            %   Relative tolerance (relative to the larger absolute value) for all value fields or
+            %   per value field (see atol). Default is 0.
+            %
+            % Values a and b are equal if abs(a - b) <= atol or abs(a - b) <= rtol * max(abs(a),
+            % abs(b)). Special values are only equal to the same special value (GAMS EPS differs
+            % from 0). Labels are compared case insensitive. Explanatory texts of set elements are
+            % compared exactly.
+
+            % parse input arguments
+            symbols = {};
+            atol = zeros(1, 5);
+            rtol = zeros(1, 5);
+            try
+                gams.transfer.utils.Validator.minargin(numel(varargin), 2);
+                obj.first = gams.transfer.utils.Validator('first', 1, varargin{1}).string2char() ...
+                    .type('char').fileExtension('.gdx').fileExists().value;
+                obj.second = gams.transfer.utils.Validator('second', 2, varargin{2}).string2char() ...
+                    .type('char').fileExtension('.gdx').fileExists().value;
+                index = 3;
+                while index <= numel(varargin)
+                    if strcmpi(varargin{index}, 'symbols')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        symbols = gams.transfer.utils.Validator('symbols', index, varargin{index}) ...
+                            .string2char().cellstr().value;
+                        index = index + 1;
+                    elseif strcmpi(varargin{index}, 'atol')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        atol = gams.transfer.GDXDiff.parseTolerance_('atol', index, varargin{index});
+                        index = index + 1;
+                    elseif strcmpi(varargin{index}, 'rtol')
+                        index = index + 1;
+                        gams.transfer.utils.Validator.minargin(numel(varargin), index);
+                        rtol = gams.transfer.GDXDiff.parseTolerance_('rtol', index, varargin{index});
+                        index = index + 1;
+                    else
+                        error('Invalid argument at position %d', index);
+                    end
+                end
+            catch e
+                error(e.message);
+            end
+
+            [obj.summary, obj.records] = gams.transfer.gdx.gt_gdx_diff(obj.first, obj.second, ...
+                symbols, atol, rtol);
+
+            % domain and change columns as categorical, records as table (as for reading)
+            names = fieldnames(obj.records);
+            for i = 1:numel(names)
+                recs = obj.records.(names{i});
+                if gams.transfer.Constants.SUPPORTS_CATEGORICAL
+                    labels = fieldnames(recs);
+                    for j = 1:numel(labels)
+                        if iscellstr(recs.(labels{j})) && ~strncmp(labels{j}, 'element_text_', 13)
+                            recs.(labels{j}) = categorical(recs.(labels{j}));
+                        end
+                    end
+                end
+                if gams.transfer.Constants.SUPPORTS_TABLE
+                    recs = struct2table(recs);
+                end
+                obj.records.(names{i}) = recs;
+            end
+        end
+
+        %> Checks if both GDX files are equal (within tolerances)
+        function flag = isEqual(obj)
+            % Checks if both GDX files are equal (within tolerances)
+
+            flag = all(strcmp({obj.summary.status}, 'equal'));
+        end
+
+    end
+
+    methods (Hidden, Static, Access = private)
+
+        function tol = parseTolerance_(name, index, value)
+            tol = zeros(1, 5);
+            if isstruct(value) && isscalar(value)
+                fields = fieldnames(value);
+                for i = 1:numel(fields)
+                    switch fields{i}
+                    case {'level', 'value'}
+                        k = 1;
+                    case 'marginal'
+                        k = 2;
+                    case 'lower'
+                        k = 3;
+                    case 'upper'
+                        k = 4;
+                    case 'scale'
+                        k = 5;
+                    otherwise
+                        error('Argument ''%s'' (at position %d) contains invalid value field ''%s''. Must be subset of ''level'', ''value'', ''marginal'', ''lower'', ''upper'', ''scale''.', name, index, fields{i});
+                    end
+                    tol(k) = gams.transfer.utils.Validator(sprintf('%s.%s', name, fields{i}), index, ...
+                        value.(fields{i})).type('numeric').scalar().noNanInf().min(0).value;
+                end
+            else
+                tol(:) = gams.transfer.utils.Validator(name, index, value).types({'numeric', 'struct'}) ...
+                    .scalar().noNanInf().min(0).value;
+            end
+        end
+
+    end
+
+end
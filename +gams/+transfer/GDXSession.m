@@ -0,0 +1,119 @@
+% GAMS GDX Session
+%
+% ------------------------------------------------------------------------------
+%
+% GAMS - General Algebraic Modeling System
+% GAMS Transfer Matlab
+%
+% Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+% Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+%
+% Permission is hereby granted, free of charge, to any person obtaining a copy
+% of this software and associated documentation files (the 'Software'), to deal
+% in the Software without restriction, including without limitation the rights
+% to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+% copies of the Software, and to permit persons to whom the Software is
+% furnished to do so, subject to the following conditions:
+%
+% The above copyright notice and this permission notice shall be included in all
+% copies or substantial portions of the Software.
+%
+% THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+% IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+% FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+% AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+% LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+% OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+% SOFTWARE.
+%
+% ------------------------------------------------------------------------------
+%
+% GAMS GDX Session
+%
+% Keeps a GDX file open for reading between calls of Container.read. Repeated reads of (a few)
+% symbols from the same file then neither reopen the file nor reparse its symbol and UEL tables, and
+% reuse the domain information read before. The session is closed by close or when the object is
+% deleted.
+%
+% Example:
+% s = GDXSession('path/to/file.gdx');
+% c = Container();
+% c.read(s, 'symbols', {'x'});
+% c.read(s, 'symbols', {'z'}, 'format', 'dense_matrix');
+% s.close();
+
+%> @brief GAMS GDX Session
+%>
+%> Keeps a GDX file open for reading between calls of \ref gams::transfer::Container::read
+%> "Container.read". Repeated reads of (a few) symbols from the same file then neither reopen the
+%> file nor reparse its symbol and UEL tables, and reuse the domain information read before. The
+%> session is closed by \ref gams::transfer::GDXSession::close "close" or when the object is
+%> deleted.
+%>
+%> **Example:**
+%> ```
+%> s = GDXSession('path/to/file.gdx');
+%> c = Container();
+%> c.read(s, 'symbols', {'x'});
+%> c.read(s, 'symbols', {'z'}, 'format', 'dense_matrix');
+%> s.close();
+%> ```
+classdef GDXSession < handle
+
+    properties (SetAccess = private)
+
+        %> Absolute path of GDX file (relative paths are resolved on construction)
+
+        % filename Absolute path of GDX file (relative paths are resolved on construction)
+        filename = ''
+
+    end
+
+    properties (Hidden, SetAccess = private, Transient)
+        handle_ = []
+    end
+
+    methods
+
+        %> Constructs a GDX Session
+        %>
+        %> **Required Arguments:**
+        %> 1. filename (`string`):
+        %>    Path to GDX file to be opened for reading.
+        function obj = GDXSession(filename)
+            % Constructs a GDX Session
+            %
+            % Required Arguments:
+            % 1. filename (string):
+            %    Path to GDX file to be opened for reading.
+
+            % fileExists() resolves the path to an absolute one
+            obj.filename = gams.transfer.utils.Validator('filename', 1, filename).string2char() ...
+                .type('char').fileExtension('.gdx').fileExists().value;
+            obj.handle_ = gams.transfer.gdx.gt_gdx_read('open', obj.filename);
+        end
+
+        function delete(obj)
+            obj.close();
+        end
+
+        %> Closes GDX file
+        function close(obj)
+            % Closes GDX file
+
+            if ~isempty(obj.handle_)
+                gams.transfer.gdx.gt_gdx_read('close', obj.handle_);
+                obj.handle_ = [];
+            end
+        end
+
+        %> Checks if GDX file is open
+        function flag = isOpen(obj)
+            % Checks if GDX file is open
+
+            flag = ~isempty(obj.handle_);
+        end
+
+    end
+
+end
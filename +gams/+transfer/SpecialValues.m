@@ -137,14 +137,7 @@ classdef SpecialValues
             % b = SpecialValues.isUndef([0, 1, SpecialValues.NA, SpecialValues.UNDEF])
             % b equals [0, 0, 0, 1]
 
-            if issparse(value)
-                [row, col, val] = find(value);
-                val = isnan(val) & ~gams.transfer.gdx.gt_is_sv('na', val);
-                [m, n] = size(value);
-                bool = sparse(row, col, val, m, n);
-            else
-                bool = isnan(value) & ~gams.transfer.gdx.gt_is_sv('na', value);
-            end
+            bool = gams.transfer.gdx.gt_sv_class({value}, {'undef'});
         end
 
         %> Checks if values are GAMS NA
@@ -169,14 +162,7 @@ classdef SpecialValues
             % value_uint64 = typecast(value, 'uint64');
             % bool = na_uint64 == value_uint64;
 
-            if issparse(value)
-                [row, col, val] = find(value);
-                val = gams.transfer.gdx.gt_is_sv('na', val);
-                [m, n] = size(value);
-                bool = sparse(row, col, val, m, n);
-            else
-                bool = gams.transfer.gdx.gt_is_sv('na', value);
-            end
+            bool = gams.transfer.gdx.gt_sv_class({value}, {'na'});
         end
 
         %> Checks if values are GAMS EPS
@@ -201,14 +187,7 @@ classdef SpecialValues
             % value_uint64 = typecast(value, 'uint64');
             % bool = eps_uint64 == value_uint64;
 
-            if issparse(value)
-                [row, col, val] = find(value);
-                val = gams.transfer.gdx.gt_is_sv('eps', val);
-                [m, n] = size(value);
-                bool = sparse(row, col, val, m, n);
-            else
-                bool = gams.transfer.gdx.gt_is_sv('eps', value);
-            end
+            bool = gams.transfer.gdx.gt_sv_class({value}, {'eps'});
         end
 
         %> Checks if values are GAMS PINF
@@ -37,6 +37,33 @@
 %    Path to IDX API. Use ext/idx or [GAMS]/apifiles/C/api
 % 3. zlib_path (string):
 %    Path zo ZLIB repository. Use submodule in ext/zlib or clone https://github.com/madler/zlib.
+%
+% Parameter Arguments:
+% - verbose (double):
+%   Verbosity level (0: silent, 1: print commands, 2: verbose compiler). Default: 0.
+% - optimize (logical):
+%   Compiles with -O3 (MSVC: /O2). Default: false.
+% - lto (logical):
+%   Enables link time optimization across the GDX, ZLIB and MEX sources (MSVC: /GL and /LTCG).
+%   Default: value of optimize.
+% - march (string):
+%   Target CPU, e.g. 'native' (-march=native; MSVC: /arch:<march>). Builds using this option are
+%   not portable to other CPUs. Default: '' (compiler default).
+% - pgo (string):
+%   Profile guided optimization (GCC or Clang only): 'generate' builds instrumented MEX files
+%   that record profile data in pgo_path when they are unloaded (clear mex), 'use' builds with
+%   the recorded profile data and 'auto' does both, running test/benchmark_suite.m on the GDX
+%   files in pgo_data in between. 'use' fails if a MEX file is still locked (open GDXSession or
+%   existing ordered label sets), because it would not have written its profile data.
+%   Default: '' (disabled).
+% - pgo_path (string):
+%   Directory for profile data. Default: fullfile(tempdir, 'gams_transfer_pgo').
+% - pgo_data (string):
+%   Directory of GDX files used as training data for pgo 'auto'.
+%
+% Example:
+% gams.transfer.setup('ext/gdx', 'ext/zlib', 'optimize', true);
+% gams.transfer.setup('ext/gdx', 'ext/zlib', 'optimize', true, 'pgo', 'auto', 'pgo_data', 'path/to/gdx');
 function setup(varargin)
 
     current_dir = fileparts(mfilename('fullpath'));
@@ -46,7 +73,32 @@ function setup(varargin)
     addRequired(p, 'gdx_path', is_string_char);
     addRequired(p, 'zlib_path', is_string_char);
     addParameter(p, 'verbose', 0, @isnumeric);
+    addParameter(p, 'optimize', false, @islogical);
+    addParameter(p, 'lto', [], @islogical);
+    addParameter(p, 'march', '', is_string_char);
+    addParameter(p, 'pgo', '', @(x) any(strcmp(x, {'', 'generate', 'use', 'auto'})));
+    addParameter(p, 'pgo_path', fullfile(tempdir, 'gams_transfer_pgo'), is_string_char);
+    addParameter(p, 'pgo_data', '', is_string_char);
     parse(p, varargin{:});
+    lto = p.Results.lto;
+    if isempty(lto)
+        lto = p.Results.optimize;
+    end
+    pgo_path = char(p.Results.pgo_path);
+
+    % two-stage profile guided build: instrument, train, rebuild
+    if strcmp(p.Results.pgo, 'auto')
+        if isempty(p.Results.pgo_data)
+            error('Argument ''pgo_data'' is required for pgo ''auto''.');
+        end
+        args = {p.Results.gdx_path, p.Results.zlib_path, 'verbose', p.Results.verbose, ...
+            'optimize', p.Results.optimize, 'lto', lto, 'march', p.Results.march, ...
+            'pgo_path', pgo_path};
+        gams.transfer.setup(args{:}, 'pgo', 'generate');
+        pgo_train(current_dir, char(p.Results.pgo_data));
+        gams.transfer.setup(args{:}, 'pgo', 'use');
+        return
+    end
 
     fprintf('Using GDX path: %s\n', p.Results.gdx_path);
     fprintf('Using ZLIB path: %s\n', p.Results.zlib_path);
@@ -57,14 +109,21 @@ function setup(varargin)
         fullfile(current_dir, '+gdx', 'gt_gdx_write.cpp'), ...
         fullfile(current_dir, '+gdx', 'gt_idx_read.cpp'), ...
         fullfile(current_dir, '+gdx', 'gt_idx_write.cpp'), ...
+        fullfile(current_dir, '+gdx', 'gt_gdx_diff.cpp'), ...
         fullfile(current_dir, '+gdx', 'gt_get_defaults.c'), ...
         fullfile(current_dir, '+gdx', 'gt_get_sv.c'), ...
         fullfile(current_dir, '+gdx', 'gt_is_sv.c'), ...
+        fullfile(current_dir, '+gdx', 'gt_label_set.cpp'), ...
+        fullfile(current_dir, '+gdx', 'gt_find_duplicates.cpp'), ...
+        fullfile(current_dir, '+gdx', 'gt_transform_records.c'), ...
+        fullfile(current_dir, '+gdx', 'gt_value_stats.cpp'), ...
+        fullfile(current_dir, '+gdx', 'gt_sv_class.c'), ...
+        fullfile(current_dir, '+gdx', 'gt_snapshot.cpp'), ...
     };
     use_gdx = false(1, numel(files));
-    use_gdx(1:4) = true;
+    use_gdx(1:5) = true;
     use_zlib = false(1, numel(files));
-    use_zlib(1:4) = true;
+    use_zlib(1:5) = true;
 
     % Common C/C++ files
     common_files = {
@@ -140,8 +199,78 @@ function setup(varargin)
     build.cpp_comp_flags = {
         '/std:c++17', ...
     };
+    build.optim_flags = {};
+    build.ld_optim_flags = {};
+    build.pgo = p.Results.pgo;
+    if strcmp(build.system, 'windows')
+        if p.Results.optimize
+            build.optim_flags{end+1} = '/O2';
+        end
+        if lto
+            build.optim_flags{end+1} = '/GL';
+            build.ld_optim_flags{end+1} = '/LTCG';
+        end
+        if ~isempty(p.Results.march)
+            build.optim_flags{end+1} = sprintf('/arch:%s', p.Results.march);
+        end
+        if ~isempty(build.pgo)
+            error('Profile guided optimization is not supported with MSVC.');
+        end
+    else
+        if p.Results.optimize
+            build.optim_flags{end+1} = '-O3';
+            build.ld_optim_flags{end+1} = '-O3';
+        end
+        if lto
+            build.optim_flags{end+1} = '-flto';
+            build.ld_optim_flags{end+1} = '-flto';
+        end
+        if ~isempty(p.Results.march)
+            build.optim_flags{end+1} = sprintf('-march=%s', p.Results.march);
+        end
+        pgo_data_path = fullfile(pgo_path, 'data');
+        switch build.pgo
+        case 'generate'
+            if exist(pgo_data_path, 'dir')
+                rmdir(pgo_data_path, 's');
+            end
+            mkdir(pgo_data_path);
+            build.optim_flags{end+1} = sprintf('-fprofile-generate=%s', pgo_data_path);
+            build.ld_optim_flags{end+1} = sprintf('-fprofile-generate=%s', pgo_data_path);
+        case 'use'
+            if ~exist(pgo_data_path, 'dir')
+                error('No profile data found in ''%s''. Run setup with pgo ''generate'' first.', pgo_path);
+            end
+            clear('mex');
+            pgo_check_unloaded();
+            switch build.system
+            case {'macos', 'macos_arm'}
+                % Clang: merge raw profiles
+                profdata = fullfile(pgo_data_path, 'default.profdata');
+                [status, result] = system(sprintf('xcrun llvm-profdata merge -output=%s %s', ...
+                    profdata, fullfile(pgo_data_path, '*.profraw')));
+                if status ~= 0
+                    error('Merging profile data failed: %s', result);
+                end
+                build.optim_flags{end+1} = sprintf('-fprofile-use=%s', profdata);
+                build.ld_optim_flags{end+1} = sprintf('-fprofile-use=%s', profdata);
+            otherwise
+                build.optim_flags{end+1} = sprintf('-fprofile-use=%s', pgo_data_path);
+                build.optim_flags{end+1} = '-fprofile-correction';
+                build.optim_flags{end+1} = '-Wno-missing-profile';
+                build.ld_optim_flags{end+1} = sprintf('-fprofile-use=%s', pgo_data_path);
+            end
+        end
+    end
     build.verbose = p.Results.verbose;
     build.object_path = tempname;
+    if ~isempty(build.pgo)
+        % GCC profile data is keyed by object file path: use same objects paths in both stages
+        build.object_path = fullfile(pgo_path, 'build');
+        if exist(build.object_path, 'dir')
+            rmdir(build.object_path, 's');
+        end
+    end
     if build.verbose > 1
         disp(build);
     end
@@ -188,6 +317,11 @@ function setup(varargin)
         zlib_objects = find_objects(build_zlib);
 
         fprintf('Compiling %d main files...\n', numel(files));
+        build_main = build;
+        build_main.object_path = fullfile(build.object_path, 'main');
+        if ~isempty(build.pgo)
+            mkdir(build_main.object_path);
+        end
         for i = 1:numel(files)
             fprintf('   %d: %s\n', i, files{i});
             objects = common_objects;
@@ -197,7 +331,18 @@ function setup(varargin)
             if use_zlib(i)
                 objects = vertcat(objects, zlib_objects); %#ok<AGROW>
             end
-            compile_file(build, files{i}, false, objects);
+            if isempty(build.pgo)
+                compile_file(build, files{i}, false, objects);
+            else
+                % compile to fixed object path first (see above), then link
+                [target_filepath, target_filename] = fileparts(files{i});
+                compile_file(build_main, files{i}, true, {});
+                main_object = find_objects(build_main, target_filename);
+                compile_file(build, main_object{1}, false, objects, target_filepath);
+            end
+        end
+        if strcmp(build.pgo, 'generate')
+            fprintf('Instrumented build: Run workload and ''clear mex'' to record profile data.\n');
         end
 
         rmdir(build.object_path, 's');
@@ -210,10 +355,14 @@ function setup(varargin)
 
 end
 
-function compile_file(build, filename, object_only, other_objects)
+function compile_file(build, filename, object_only, other_objects, target_filepath)
 
     % file in target directory
-    [target_filepath, target_filename, target_fileext] = fileparts(filename);
+    if nargin > 4
+        [~, target_filename, target_fileext] = fileparts(filename);
+    else
+        [target_filepath, target_filename, target_fileext] = fileparts(filename);
+    end
 
     cmd = sprintf('mex %s', filename);
     for i = 1:numel(other_objects)
@@ -275,6 +424,28 @@ function compile_file(build, filename, object_only, other_objects)
         end
     end
 
+    % optimization flags (compile: all sources; link: MEX files)
+    if ~isempty(build.optim_flags) && any(strcmpi(target_fileext, {'.c', '.cpp'}))
+        if gams.transfer.Constants.IS_OCTAVE
+            cmd = sprintf('%s %s', cmd, strjoin(build.optim_flags, ' '));
+        elseif strcmp(build.system, 'windows')
+            cmd = sprintf('%s OPTIMFLAGS=''$OPTIMFLAGS %s''', cmd, strjoin(build.optim_flags, ' '));
+        elseif strcmpi(target_fileext, '.c')
+            cmd = sprintf('%s COPTIMFLAGS=''$COPTIMFLAGS %s''', cmd, strjoin(build.optim_flags, ' '));
+        else
+            cmd = sprintf('%s CXXOPTIMFLAGS=''$CXXOPTIMFLAGS %s''', cmd, strjoin(build.optim_flags, ' '));
+        end
+    end
+    if ~isempty(build.ld_optim_flags) && ~object_only
+        if gams.transfer.Constants.IS_OCTAVE
+            cmd = sprintf('%s %s', cmd, strjoin(build.ld_optim_flags, ' '));
+        elseif strcmp(build.system, 'windows')
+            cmd = sprintf('%s LINKOPTIMFLAGS=''$LINKOPTIMFLAGS %s''', cmd, strjoin(build.ld_optim_flags, ' '));
+        else
+            cmd = sprintf('%s LDOPTIMFLAGS=''$LDOPTIMFLAGS %s''', cmd, strjoin(build.ld_optim_flags, ' '));
+        end
+    end
+
     % output level
     if build.verbose == 0 && ~gams.transfer.Constants.IS_OCTAVE
         cmd = strcat(cmd, ' -silent');
@@ -310,12 +481,15 @@ function compile_file(build, filename, object_only, other_objects)
     eval(cmd);
 end
 
-function objects = find_objects(build)
+function objects = find_objects(build, name)
+    if nargin < 2
+        name = '*';
+    end
     switch build.system
     case {'windows'}
-        object_pattern = '*.obj';
+        object_pattern = [name, '.obj'];
     otherwise
-        object_pattern = '*.o';
+        object_pattern = [name, '.o'];
     end
     objects_ = dir(fullfile(build.object_path, object_pattern));
     objects = cell(size(objects_));
@@ -323,3 +497,37 @@ function objects = find_objects(build)
         objects{i} = fullfile(objects_(i).folder, objects_(i).name);
     end
 end
+
+function pgo_train(current_dir, gdx_dir)
+    % runs benchmark suite on instrumented MEX files and unloads them to write profile data
+    test_dir = fullfile(current_dir, '..', '..', 'test');
+    if ~exist(fullfile(test_dir, 'benchmark_suite.m'), 'file')
+        error('Training requires test/benchmark_suite.m.');
+    end
+    fprintf('Running PGO training on: %s\n', gdx_dir);
+    clear('mex');
+    old_path = addpath(test_dir);
+    try
+        benchmark_suite(gdx_dir);
+    catch e
+        path(old_path);
+        clear('mex');
+        rethrow(e);
+    end
+    path(old_path);
+    clear('mex');
+    pgo_check_unloaded();
+end
+
+function pgo_check_unloaded()
+    % locked MEX files (open GDX sessions, existing ordered label sets) survive clear('mex') and
+    % therefore do not write their profile data
+    [~, mex_files] = inmem('-completenames');
+    [~, names] = cellfun(@fileparts, mex_files, 'UniformOutput', false);
+    locked = names(strncmp(names, 'gt_', 3));
+    if ~isempty(locked)
+        error(['MEX files still loaded after clear(''mex''): %s. Close all GDX sessions and ', ...
+            'clear all containers with ordered label sets before the pgo ''use'' build.'], ...
+            strjoin(locked, ', '));
+    end
+end
@@ -0,0 +1,388 @@
+function [results, passed] = benchmark_suite(varargin)
+    % Benchmarks reading and writing of all GDX files in a directory
+    %
+    % Each GDX file is read for every combination of indexed, format and values and each read
+    % container is written for every combination of sorted and compress. Per symbol times are
+    % taken from the read / write profile (minimum of all repetitions). Rows with symbol '*' hold
+    % the totals of the whole file (including the creation of symbol objects). Peak memory is the
+    % peak resident memory of the Matlab process during the operation (Linux; on Windows the
+    % memory used by Matlab after the operation; NaN otherwise).
+    %
+    % Required Arguments:
+    % 1. gdx_dir (string):
+    %    Directory of GDX files (searched recursively), e.g. generated by test/native/gt_generate
+    %
+    % Parameter Arguments:
+    % - format (cell):
+    %   Records formats. Default: {'struct', 'table', 'dense_matrix', 'sparse_matrix'}
+    % - values (cell):
+    %   List of value subsets to be read. Default: {{'level', 'marginal', 'lower', 'upper',
+    %   'scale'}, {'level'}}
+    % - indexed (logical):
+    %   List of indexed flags (indexed GDX files are never compressed). Default: false
+    % - sorted (logical):
+    %   List of sorted flags for writing. Default: [false, true]
+    % - compress (logical):
+    %   List of compress flags for writing. Default: [false, true]
+    % - repeat (double):
+    %   Number of repetitions of each read and write. Default: 1
+    % - output (string):
+    %   File (.json or .csv) the results are written to. Default: no output
+    % - baseline (string):
+    %   Results file (.json or .csv) of a previous run to compare with. Default: no baseline
+    % - tolerance (double):
+    %   Allowed relative loss of records per second w.r.t. baseline. Default: 0.2
+    % - memory_tolerance (double):
+    %   Allowed relative increase of peak memory w.r.t. baseline. Default: 0.2
+    % - min_time (double):
+    %   Rows with baseline read / write times below are not checked for regressions (timing
+    %   noise). Default: 0.05
+    % - working_dir (string):
+    %   Directory for written GDX files. Default: tempname
+    %
+    % Returns the results table and a flag that is false if any row regressed w.r.t. the
+    % baseline or failed.
+    %
+    % Example:
+    % results = benchmark_suite('path/to/gdx', 'output', 'baseline.json');
+    % [results, passed] = benchmark_suite('path/to/gdx', 'baseline', 'baseline.json', 'tolerance', 0.1);
+
+    p = inputParser();
+    is_string_char = @(x) (isstring(x) && numel(x) == 1 || ischar(x));
+    addRequired(p, 'gdx_dir', is_string_char);
+    addParameter(p, 'format', {'struct', 'table', 'dense_matrix', 'sparse_matrix'}, @iscellstr);
+    addParameter(p, 'values', {{'level', 'marginal', 'lower', 'upper', 'scale'}, {'level'}}, @iscell);
+    addParameter(p, 'indexed', false, @islogical);
+    addParameter(p, 'sorted', [false, true], @islogical);
+    addParameter(p, 'compress', [false, true], @islogical);
+    addParameter(p, 'repeat', 1, @(x) isnumeric(x) && isscalar(x) && x >= 1);
+    addParameter(p, 'output', '', is_string_char);
+    addParameter(p, 'baseline', '', is_string_char);
+    addParameter(p, 'tolerance', 0.2, @(x) isnumeric(x) && isscalar(x) && x >= 0);
+    addParameter(p, 'memory_tolerance', 0.2, @(x) isnumeric(x) && isscalar(x) && x >= 0);
+    addParameter(p, 'min_time', 0.05, @(x) isnumeric(x) && isscalar(x) && x >= 0);
+    addParameter(p, 'working_dir', tempname, is_string_char);
+    parse(p, varargin{:});
+    opts = p.Results;
+
+    root = dir(char(opts.gdx_dir));
+    root = root(1).folder;
+    files = dir(fullfile(root, '**', '*.gdx'));
+
+    results = struct();
+    keys = {'file', 'indexed', 'format', 'values', 'sorted', 'compress', 'symbol', 'records', ...
+        'read_time', 'read_rate', 'read_peak_mb', 'write_time', 'write_rate', 'write_peak_mb', ...
+        'file_mb', 'status'};
+    for i = 1:numel(keys)
+        results.(keys{i}) = {};
+    end
+
+    mkdir(opts.working_dir);
+    write_filename = fullfile(opts.working_dir, 'write.gdx');
+
+    print_header();
+    for i = 1:numel(files)
+        file = fullfile(files(i).folder, files(i).name);
+        name = strrep(file(numel(root)+2:end), '\', '/');
+        file_mb = files(i).bytes / 1024 / 1024;
+
+        for indexed = opts.indexed(:)'
+        for j = 1:numel(opts.format)
+        for k = 1:numel(opts.values)
+            format = opts.format{j};
+            values = opts.values{k};
+            values_name = strjoin(values, '+');
+
+            % read
+            try
+                [read, container] = benchmark(opts.repeat, @(c) c.read(file, 'format', format, ...
+                    'values', values, 'indexed', indexed, 'profile', true));
+                read_status = 'ok';
+            catch e
+                read = [];
+                read_status = e.message;
+            end
+
+            % write
+            for sorted = opts.sorted(:)'
+            for compress = opts.compress(:)'
+                if indexed && compress
+                    continue
+                end
+                write = [];
+                status = read_status;
+                if ~isempty(read)
+                    try
+                        write = benchmark(opts.repeat, @(c) container.write(write_filename, ...
+                            'sorted', sorted, 'compress', compress, 'indexed', indexed, ...
+                            'eps_to_zero', false, 'profile', true));
+                    catch e
+                        status = e.message;
+                    end
+                end
+
+                row = struct('file', name, 'indexed', indexed, 'format', format, 'values', ...
+                    values_name, 'sorted', sorted, 'compress', compress, 'file_mb', file_mb, ...
+                    'status', status);
+                results = add_rows(results, row, read, write);
+                print_row(results, numel(results.file));
+            end
+            end
+        end
+        end
+        end
+    end
+
+    try
+        rmdir(opts.working_dir, 's');
+    catch
+    end
+
+    for i = 1:numel(keys)
+        if ~any(strcmp(keys{i}, {'file', 'format', 'values', 'symbol', 'status'}))
+            results.(keys{i}) = cell2mat(results.(keys{i}));
+        end
+    end
+    results = struct2table(results);
+
+    % compare with baseline
+    passed = all(strcmp(results.status, 'ok'));
+    if ~isempty(opts.baseline)
+        results = compare_baseline(results, load_results(char(opts.baseline)), opts);
+        passed = passed && ~any(results.regression);
+        fprintf('\n%d of %d rows regressed w.r.t. baseline %s\n', sum(results.regression), ...
+            height(results), char(opts.baseline));
+    end
+
+    if ~isempty(opts.output)
+        save_results(char(opts.output), results);
+    end
+
+end
+
+function [bench, container] = benchmark(repeat, fun)
+    % runs fun on new containers and returns total time, peak memory and minimal per symbol
+    % times of its profile
+    bench = struct('time', inf, 'peak_mb', nan, 'symbols', struct());
+    for r = 1:repeat
+        container = gams.transfer.Container();
+        reset_peak_memory();
+        time = tic;
+        profile = fun(container);
+        bench.time = min(bench.time, toc(time));
+        bench.peak_mb = max(bench.peak_mb, peak_memory());
+
+        symbols = fieldnames(profile);
+        for i = 1:numel(symbols)
+            s = profile.(symbols{i});
+            if isfield(bench.symbols, symbols{i})
+                s.time.total = min(s.time.total, bench.symbols.(symbols{i}).time.total);
+            end
+            bench.symbols.(symbols{i}) = s;
+        end
+    end
+end
+
+function results = add_rows(results, row, read, write)
+    % adds a row per symbol and a total row ('*') to results
+    if ~isempty(read)
+        symbols = [fieldnames(read.symbols); {'*'}];
+    else
+        symbols = {'*'};
+    end
+    for i = 1:numel(symbols)
+        row.symbol = symbols{i};
+        if strcmp(symbols{i}, '*')
+            row.records = 0;
+            if ~isempty(read)
+                s = struct2cell(read.symbols);
+                for j = 1:numel(s)
+                    row.records = row.records + s{j}.number_records;
+                end
+            end
+            row.read_time = total_time(read);
+            row.write_time = total_time(write);
+        else
+            row.records = read.symbols.(symbols{i}).number_records;
+            row.read_time = read.symbols.(symbols{i}).time.total;
+            row.write_time = nan;
+            if ~isempty(write) && isfield(write.symbols, symbols{i})
+                row.write_time = write.symbols.(symbols{i}).time.total;
+            end
+        end
+        row.read_rate = row.records / row.read_time;
+        row.write_rate = row.records / row.write_time;
+        row.read_peak_mb = nan;
+        row.write_peak_mb = nan;
+        if ~isempty(read)
+            row.read_peak_mb = read.peak_mb;
+        end
+        if ~isempty(write)
+            row.write_peak_mb = write.peak_mb;
+        end
+
+        keys = fieldnames(results);
+        for j = 1:numel(keys)
+            results.(keys{j}){end+1,1} = row.(keys{j});
+        end
+    end
+end
+
+function time = total_time(bench)
+    if isempty(bench)
+        time = nan;
+    else
+        time = bench.time;
+    end
+end
+
+function results = compare_baseline(results, baseline, opts)
+    % adds ratios of records per second (current / baseline), of peak memory and a regression
+    % flag for each row found in baseline
+    map = containers.Map();
+    for i = 1:numel(baseline.file)
+        map(row_key(baseline, i)) = i;
+    end
+
+    n = height(results);
+    read_ratio = nan(n, 1);
+    write_ratio = nan(n, 1);
+    memory_ratio = nan(n, 1);
+    regression = false(n, 1);
+    for i = 1:n
+        key = row_key(results, i);
+        if ~map.isKey(key)
+            continue
+        end
+        b = map(key);
+        read_ratio(i) = results.read_rate(i) / baseline_value(baseline.read_rate, b);
+        write_ratio(i) = results.write_rate(i) / baseline_value(baseline.write_rate, b);
+        memory_ratio(i) = max(results.read_peak_mb(i), results.write_peak_mb(i)) / ...
+            max(baseline_value(baseline.read_peak_mb, b), baseline_value(baseline.write_peak_mb, b));
+
+        if baseline_value(baseline.read_time, b) >= opts.min_time && read_ratio(i) < 1 - opts.tolerance
+            regression(i) = true;
+        end
+        if baseline_value(baseline.write_time, b) >= opts.min_time && write_ratio(i) < 1 - opts.tolerance
+            regression(i) = true;
+        end
+        if strcmp(results.symbol{i}, '*') && memory_ratio(i) > 1 + opts.memory_tolerance
+            regression(i) = true;
+        end
+    end
+
+    results.read_ratio = read_ratio;
+    results.write_ratio = write_ratio;
+    results.memory_ratio = memory_ratio;
+    results.regression = regression;
+end
+
+function key = row_key(results, i)
+    key = sprintf('%s|%d|%s|%s|%d|%d|%s', cell_value(results.file, i), ...
+        baseline_value(results.indexed, i), cell_value(results.format, i), ...
+        cell_value(results.values, i), baseline_value(results.sorted, i), ...
+        baseline_value(results.compress, i), cell_value(results.symbol, i));
+end
+
+function value = cell_value(column, i)
+    if iscell(column)
+        value = column{i};
+    else
+        value = column(i, :);
+    end
+end
+
+function value = baseline_value(column, i)
+    % numeric value of row i (JSON files store NaN as null)
+    value = cell_value(column, i);
+    if isempty(value)
+        value = nan;
+    end
+    value = double(value);
+end
+
+function results = load_results(filename)
+    [~, ~, ext] = fileparts(filename);
+    switch lower(ext)
+    case '.json'
+        results = jsondecode(fileread(filename));
+        if isstruct(results)
+            % struct array to struct of columns
+            keys = fieldnames(results);
+            columns = struct();
+            for i = 1:numel(keys)
+                columns.(keys{i}) = {results.(keys{i})}';
+            end
+            results = columns;
+        elseif iscell(results)
+            % rows with null values decode into a cell of structs
+            keys = fieldnames(results{1});
+            columns = struct();
+            for i = 1:numel(keys)
+                columns.(keys{i}) = cellfun(@(r) r.(keys{i}), results, 'UniformOutput', false);
+            end
+            results = columns;
+        end
+    case '.csv'
+        results = table2struct(readtable(filename, 'Delimiter', ','), 'ToScalar', true);
+    otherwise
+        error('Unsupported results file: %s', filename);
+    end
+end
+
+function save_results(filename, results)
+    [~, ~, ext] = fileparts(filename);
+    switch lower(ext)
+    case '.json'
+        fid = fopen(filename, 'w');
+        fprintf(fid, '%s', jsonencode(table2struct(results)));
+        fclose(fid);
+    case '.csv'
+        writetable(results, filename);
+    otherwise
+        error('Unsupported results file: %s', filename);
+    end
+end
+
+function reset_peak_memory()
+    % resets peak resident memory of process (Linux only)
+    if isunix() && ~ismac()
+        fid = fopen('/proc/self/clear_refs', 'w');
+        if fid >= 0
+            fprintf(fid, '5');
+            fclose(fid);
+        end
+    end
+end
+
+function mb = peak_memory()
+    mb = nan;
+    if isunix() && ~ismac()
+        try
+            tokens = regexp(fileread('/proc/self/status'), 'VmHWM:\s*(\d+)\s*kB', 'tokens', 'once');
+            mb = str2double(tokens{1}) / 1024;
+        catch
+        end
+    elseif ispc()
+        try
+            m = memory();
+            mb = m.MemUsedMATLAB / 1024 / 1024;
+        catch
+        end
+    end
+end
+
+function print_header()
+    fprintf('%-20s | %3s | %-13s | %-12s | %3s | %3s | %10s %12s | %10s %12s | %8s | %s\n', ...
+        'file', 'idx', 'format', 'values', 'srt', 'cmp', 'read s', 'read rec/s', 'write s', ...
+        'write rec/s', 'peak MB', 'status');
+    fprintf('%s\n', repmat('-', 1, 140));
+end
+
+function print_row(results, i)
+    fprintf('%-20s | %3d | %-13s | %-12s | %3d | %3d | %10.3f %12.0f | %10.3f %12.0f | %8.0f | %s\n', ...
+        results.file{i}, results.indexed{i}, results.format{i}, results.values{i}, ...
+        results.sorted{i}, results.compress{i}, results.read_time{i}, results.read_rate{i}, ...
+        results.write_time{i}, results.write_rate{i}, ...
+        max(results.read_peak_mb{i}, results.write_peak_mb{i}), results.status{i});
+end
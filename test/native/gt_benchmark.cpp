@@ -0,0 +1,638 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Native benchmark of the GDX read / write MEX kernels
+ *
+ * Runs gt_gdx_read and gt_gdx_write (compiled against the native MEX shim in
+ * mex.h) on generated GDX files without Matlab. Each scenario is one
+ * combination of the given parameter lists and is reported as one result row
+ * (CSV or JSON). See README.md for usage.
+ */
+
+#include "mex.h"
+#include "gt_utils.h"
+#include "gt_generator.h"
+
+#ifdef HAS_GDX_SOURCE
+#define NO_SET_LOAD_PATH_DEF
+#include "gdxcwrap.hpp"
+#else
+#include "gdxcc.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/* MEX entry points (renamed at compile time, see CMakeLists.txt) */
+extern "C" void gt_gdx_read_mex(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+extern "C" void gt_gdx_write_mex(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+
+typedef struct
+{
+    std::string     format;         /* records format */
+    std::string     type;           /* symbol type: parameter or variable */
+    int             dim;            /* symbol dimension */
+    double          density;        /* share of records in domain cross product */
+    int             uels;           /* number of UELs (= records of each domain set) */
+    double          sv_share;       /* share of special values in level values */
+} Scenario;
+
+typedef struct
+{
+    std::vector<std::string> formats;
+    std::vector<std::string> types;
+    std::vector<int> dims;
+    std::vector<double> densities;
+    std::vector<int> uels;
+    std::vector<double> sv_shares;
+    int             repeat;         /* number of timed runs */
+    double          max_cells;      /* skip dense scenarios with more matrix cells */
+    uint64_t        seed;           /* random seed */
+    std::string     output;         /* csv or json */
+    std::string     workdir;        /* directory for generated files */
+    bool            keep;           /* keep generated files */
+} Options;
+
+typedef struct
+{
+    std::string     status;         /* ok, skipped or error */
+    std::string     message;        /* reason for skipped or error */
+    size_t          nrecs;          /* records of benchmarked symbol */
+    size_t          file_bytes;     /* size of generated GDX file */
+    double          gen_time;       /* time to generate GDX file */
+    double          read_min;       /* minimal read time */
+    double          read_median;    /* median read time */
+    double          write_min;      /* minimal write time */
+    double          write_median;   /* median write time */
+} Result;
+
+static double now(void)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static double median(
+    std::vector<double> values      /** values (copied for sorting) */
+)
+{
+    if (values.empty())
+        return NAN;
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    return (n % 2) ? values[n/2] : 0.5 * (values[n/2-1] + values[n/2]);
+}
+
+static void split(
+    const char*     str,            /** comma separated list */
+    std::vector<std::string>* values/** list values */
+)
+{
+    std::string s(str), item;
+    size_t start = 0, end;
+
+    values->clear();
+    while ((end = s.find(',', start)) != std::string::npos)
+    {
+        values->push_back(s.substr(start, end - start));
+        start = end + 1;
+    }
+    values->push_back(s.substr(start));
+}
+
+static void usage(void)
+{
+    printf(
+        "Usage: gt_benchmark [options]\n"
+        "  --format LIST     records formats: struct,dense_matrix,sparse_matrix,sparse_tensor\n"
+        "                    (default: struct)\n"
+        "  --type LIST       symbol types: parameter,variable (default: parameter)\n"
+        "  --dim LIST        symbol dimensions (default: 2)\n"
+        "  --density LIST    share of records in domain cross product (default: 0.1)\n"
+        "  --uels LIST       number of UELs per domain (default: 1000)\n"
+        "  --sv LIST         share of special values (default: 0)\n"
+        "  --repeat N        number of timed runs per scenario (default: 3)\n"
+        "  --max-cells N     skip dense / sparse matrix scenarios with more cells (default: 1e8)\n"
+        "  --seed N          random seed (default: 1)\n"
+        "  --output FORMAT   csv or json (default: csv)\n"
+        "  --workdir DIR     directory for generated GDX files (default: .)\n"
+        "  --keep            keep generated GDX files\n");
+}
+
+static bool parse_options(
+    int             argc,           /** number of arguments */
+    char**          argv,           /** arguments */
+    Options*        opts            /** parsed options */
+)
+{
+    std::vector<std::string> values;
+
+    opts->formats = {"struct"};
+    opts->types = {"parameter"};
+    opts->dims = {2};
+    opts->densities = {0.1};
+    opts->uels = {1000};
+    opts->sv_shares = {0.0};
+    opts->repeat = 3;
+    opts->max_cells = 1e8;
+    opts->seed = 1;
+    opts->output = "csv";
+    opts->workdir = ".";
+    opts->keep = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--keep")
+        {
+            opts->keep = true;
+            continue;
+        }
+        if (arg == "--help" || i + 1 >= argc)
+            return false;
+        const char* value = argv[++i];
+        split(value, &values);
+
+        if (arg == "--format")
+            opts->formats = values;
+        else if (arg == "--type")
+            opts->types = values;
+        else if (arg == "--dim")
+        {
+            opts->dims.clear();
+            for (const std::string& v : values)
+                opts->dims.push_back(atoi(v.c_str()));
+        }
+        else if (arg == "--density")
+        {
+            opts->densities.clear();
+            for (const std::string& v : values)
+                opts->densities.push_back(atof(v.c_str()));
+        }
+        else if (arg == "--uels")
+        {
+            opts->uels.clear();
+            for (const std::string& v : values)
+                opts->uels.push_back(atoi(v.c_str()));
+        }
+        else if (arg == "--sv")
+        {
+            opts->sv_shares.clear();
+            for (const std::string& v : values)
+                opts->sv_shares.push_back(atof(v.c_str()));
+        }
+        else if (arg == "--repeat")
+            opts->repeat = std::max(1, atoi(value));
+        else if (arg == "--max-cells")
+            opts->max_cells = atof(value);
+        else if (arg == "--seed")
+            opts->seed = strtoull(value, NULL, 10);
+        else if (arg == "--output")
+            opts->output = value;
+        else if (arg == "--workdir")
+            opts->workdir = value;
+        else
+            return false;
+    }
+
+    for (const std::string& f : opts->formats)
+        if (f != "struct" && f != "dense_matrix" && f != "sparse_matrix" && f != "sparse_tensor")
+            return false;
+    for (const std::string& t : opts->types)
+        if (t != "parameter" && t != "variable")
+            return false;
+    for (int d : opts->dims)
+        if (d < 0 || d > GLOBAL_MAX_INDEX_DIM)
+            return false;
+    for (double d : opts->densities)
+        if (d <= 0 || d > 1)
+            return false;
+    for (int u : opts->uels)
+        if (u < 1)
+            return false;
+    return opts->output == "csv" || opts->output == "json";
+}
+
+static int format_id(
+    const std::string& format       /** records format name */
+)
+{
+    if (format == "dense_matrix")
+        return GT_FORMAT_DENSEMAT;
+    if (format == "sparse_matrix")
+        return GT_FORMAT_SPARSEMAT;
+    if (format == "sparse_tensor")
+        return GT_FORMAT_SPARSETENSOR;
+    return GT_FORMAT_STRUCT;
+}
+
+/** getAxisLabels(symbol, dim) replacement: returns stored UELs of symbol */
+static int get_axis_labels(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    mxArray*        prhs[]
+)
+{
+    mxArray* mx_arr_labels = NULL;
+
+    if (nlhs != 1 || nrhs != 2)
+        return 1;
+    mx_arr_labels = mxGetField(prhs[0], 0, "axis_labels_");
+    if (!mx_arr_labels)
+        return 1;
+    plhs[0] = mxDuplicateArray(mxGetCell(mx_arr_labels, (size_t) mxGetScalar(prhs[1]) - 1));
+    return 0;
+}
+
+static void set_property(
+    mxArray*        mx_obj,         /** object */
+    const char*     name,           /** property name */
+    mxArray*        mx_value        /** property value */
+)
+{
+    mxSetFieldByNumber(mx_obj, 0, mxAddField(mx_obj, name), mx_value);
+}
+
+/** creates symbol objects (as needed by gt_gdx_write) from gt_gdx_read output; symbol objects
+ *  only refer to the read records, so they must be released with release_write_input */
+static mxArray* create_write_input(
+    mxArray*        mx_arr_read     /** output of gt_gdx_read */
+)
+{
+    mxArray* mx_arr_symbols = mxCreateStructMatrix(1, 1, 0, NULL);
+
+    for (int i = 0; i < mxGetNumberOfFields(mx_arr_read); i++)
+    {
+        mxArray* mx_arr_sym = mxGetFieldByNumber(mx_arr_read, 0, i);
+        mxArray* mx_arr_domain = mxGetField(mx_arr_sym, 0, "domain");
+        mxArray* mx_arr_uels = mxGetField(mx_arr_sym, 0, "uels");
+        mxArray* mx_obj = NULL;
+        mxArray* mx_def = NULL;
+        mxArray* mx_data = NULL;
+        mxArray* mx_domains = NULL;
+        mxArray* mx_type = NULL;
+        const char* data_class = NULL;
+        int type = (int) mxGetScalar(mxGetField(mx_arr_sym, 0, "symbol_type"));
+        size_t dim = (size_t) mxGetScalar(mxGetField(mx_arr_sym, 0, "dimension"));
+        char name[GMS_SSSIZE];
+
+        switch ((int) mxGetScalar(mxGetField(mx_arr_sym, 0, "format")))
+        {
+            case GT_FORMAT_DENSEMAT: data_class = "gams.transfer.symbol.data.DenseMatrix"; break;
+            case GT_FORMAT_SPARSEMAT: data_class = "gams.transfer.symbol.data.SparseMatrix"; break;
+            case GT_FORMAT_SPARSETENSOR: data_class = "gams.transfer.symbol.data.SparseTensor"; break;
+            default: data_class = "gams.transfer.symbol.data.Struct"; break;
+        }
+
+        switch (type)
+        {
+            case GMS_DT_SET:
+                mx_obj = gt_shim_create_object("gams.transfer.symbol.Set", true);
+                mx_def = gt_shim_create_object("gams.transfer.symbol.definition.Set", false);
+                set_property(mx_def, "is_singleton_", mxDuplicateArray(mxGetField(mx_arr_sym, 0, "is_singleton")));
+                break;
+            case GMS_DT_PAR:
+                mx_obj = gt_shim_create_object("gams.transfer.symbol.Parameter", true);
+                mx_def = gt_shim_create_object("gams.transfer.symbol.definition.Parameter", false);
+                break;
+            case GMS_DT_VAR:
+                mx_obj = gt_shim_create_object("gams.transfer.symbol.Variable", true);
+                mx_def = gt_shim_create_object("gams.transfer.symbol.definition.Variable", false);
+                mx_type = gt_shim_create_object("gams.transfer.VariableType", false);
+                set_property(mx_type, "value_", mxDuplicateArray(mxGetField(mx_arr_sym, 0, "type")));
+                set_property(mx_def, "type_", mx_type);
+                break;
+            default:
+                continue;
+        }
+
+        /* domains: regular domains refer to symbol handles, only their name is needed */
+        mx_domains = mxCreateCellMatrix(1, dim);
+        for (size_t j = 0; j < dim; j++)
+        {
+            mxArray* mx_dom = NULL;
+            mxGetString(mxGetCell(mx_arr_domain, j), name, sizeof(name));
+            if (!strcmp(name, "*"))
+            {
+                mx_dom = gt_shim_create_object("gams.transfer.symbol.domain.Relaxed", false);
+                set_property(mx_dom, "name_", mxCreateString(name));
+            }
+            else
+            {
+                mxArray* mx_dom_sym = gt_shim_create_object("gams.transfer.symbol.Set", true);
+                set_property(mx_dom_sym, "name_", mxCreateString(name));
+                mx_dom = gt_shim_create_object("gams.transfer.symbol.domain.Regular", false);
+                set_property(mx_dom, "symbol_", mx_dom_sym);
+            }
+            mxSetCell(mx_domains, j, mx_dom);
+        }
+        set_property(mx_def, "domains_", mx_domains);
+
+        mx_data = gt_shim_create_object(data_class, true);
+        set_property(mx_data, "records_", mxGetField(mx_arr_sym, 0, "records"));
+
+        set_property(mx_obj, "name_", mxDuplicateArray(mxGetField(mx_arr_sym, 0, "name")));
+        set_property(mx_obj, "description_", mxDuplicateArray(mxGetField(mx_arr_sym, 0, "description")));
+        set_property(mx_obj, "def_", mx_def);
+        set_property(mx_obj, "data_", mx_data);
+        set_property(mx_obj, "axis_labels_", mx_arr_uels ? mxDuplicateArray(mx_arr_uels) : mxCreateCellMatrix(1, 0));
+
+        set_property(mx_arr_symbols, mxGetFieldNameByNumber(mx_arr_read, i), mx_obj);
+    }
+
+    return mx_arr_symbols;
+}
+
+static void release_write_input(
+    mxArray*        mx_arr_symbols  /** output of create_write_input */
+)
+{
+    /* detach records owned by the read output */
+    for (int i = 0; i < mxGetNumberOfFields(mx_arr_symbols); i++)
+    {
+        mxArray* mx_data = mxGetField(mxGetFieldByNumber(mx_arr_symbols, 0, i), 0, "data_");
+        mxSetField(mx_data, 0, "records_", NULL);
+    }
+    mxDestroyArray(mx_arr_symbols);
+}
+
+static void run_scenario(
+    const Options&  opts,           /** options */
+    const Scenario& s,              /** scenario */
+    size_t          nr,             /** scenario number */
+    Result*         res             /** result */
+)
+{
+    std::string read_file = opts.workdir + "/gt_benchmark_" + std::to_string(nr) + ".gdx";
+    std::string write_file = opts.workdir + "/gt_benchmark_" + std::to_string(nr) + "_write.gdx";
+    std::vector<double> read_times, write_times;
+    std::vector<size_t> nrecs;
+    GT_GEN_SPEC spec;
+    mxArray* plhs[1] = {NULL};
+    mxArray* mx_arr_read = NULL;
+    mxArray* mx_arr_symbols = NULL;
+    double t, ncells;
+    FILE* fp;
+
+    res->status = "ok";
+    res->nrecs = 0;
+    res->file_bytes = 0;
+    res->gen_time = res->read_min = res->read_median = res->write_min = res->write_median = NAN;
+
+    ncells = pow((double) s.uels, s.dim);
+    if (s.format == "sparse_matrix" && s.dim > 2)
+    {
+        res->status = "skipped";
+        res->message = "sparse_matrix requires dim <= 2";
+        return;
+    }
+    if ((s.format == "dense_matrix" || s.format == "sparse_matrix") && ncells > opts.max_cells)
+    {
+        res->status = "skipped";
+        res->message = "matrix exceeds max-cells";
+        return;
+    }
+
+    /* generate */
+    gt_gen_spec_init(&spec);
+    spec.type = gt_gen_type(s.type);
+    spec.dim = s.dim;
+    spec.density = s.density;
+    spec.n_uels = s.uels;
+    spec.sv_share = s.sv_share;
+    spec.seed = opts.seed;
+    t = now();
+    if (!gt_gen_write(read_file.c_str(), &spec, &nrecs, &res->message))
+    {
+        res->status = "error";
+        return;
+    }
+    res->nrecs = nrecs[0];
+    res->gen_time = now() - t;
+    if ((fp = fopen(read_file.c_str(), "rb")))
+    {
+        fseek(fp, 0, SEEK_END);
+        res->file_bytes = (size_t) ftell(fp);
+        fclose(fp);
+    }
+
+    /* read: gt_gdx_read(filename, symbols, format, records, values, categorical, setget) */
+    {
+        mxArray* mx_arr_values = mxCreateLogicalMatrix(1, 5);
+        mxArray* mx_arr_format = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);
+        const mxArray* prhs[7];
+
+        for (size_t i = 0; i < 5; i++)
+            mxGetLogicals(mx_arr_values)[i] = true;
+        mxGetInt32s(mx_arr_format)[0] = format_id(s.format);
+        prhs[0] = mxCreateString(read_file.c_str());
+        prhs[1] = mxCreateCellMatrix(1, 0);
+        prhs[2] = mx_arr_format;
+        prhs[3] = mxCreateLogicalScalar(true);
+        prhs[4] = mx_arr_values;
+        prhs[5] = mxCreateLogicalScalar(false);
+        prhs[6] = mxCreateLogicalScalar(false);
+
+        for (int r = 0; r < opts.repeat && res->status == "ok"; r++)
+        {
+            t = now();
+            if (!gt_shim_call(gt_gdx_read_mex, 1, plhs, 7, prhs))
+            {
+                res->status = "error";
+                res->message = gt_shim_last_error();
+                break;
+            }
+            read_times.push_back(now() - t);
+            mxDestroyArray(mx_arr_read);
+            mx_arr_read = plhs[0];
+        }
+        for (size_t i = 0; i < 7; i++)
+            mxDestroyArray((mxArray*) prhs[i]);
+    }
+
+    /* write: gt_gdx_write(filename, symbols, enable, uel_priority, compress, sorted, eps_to_zero,
+     * support_table, support_categorical, source, copy) */
+    if (res->status == "ok")
+    {
+        size_t nsyms;
+        const mxArray* prhs[11];
+
+        mx_arr_symbols = create_write_input(mx_arr_read);
+        nsyms = mxGetNumberOfFields(mx_arr_symbols);
+        prhs[0] = mxCreateString(write_file.c_str());
+        prhs[1] = mx_arr_symbols;
+        prhs[2] = mxCreateLogicalMatrix(1, nsyms);
+        prhs[3] = mxCreateCellMatrix(1, 0);
+        prhs[4] = mxCreateLogicalScalar(false);
+        prhs[5] = mxCreateLogicalScalar(true);
+        prhs[6] = mxCreateLogicalScalar(false);
+        prhs[7] = mxCreateLogicalScalar(false);
+        prhs[8] = mxCreateLogicalScalar(false);
+        prhs[9] = mxCreateString("");
+        prhs[10] = mxCreateLogicalMatrix(1, nsyms);
+        for (size_t i = 0; i < nsyms; i++)
+            mxGetLogicals(prhs[2])[i] = true;
+
+        for (int r = 0; r < opts.repeat; r++)
+        {
+            t = now();
+            if (!gt_shim_call(gt_gdx_write_mex, 0, plhs, 11, prhs))
+            {
+                res->status = "error";
+                res->message = gt_shim_last_error();
+                break;
+            }
+            write_times.push_back(now() - t);
+        }
+
+        release_write_input(mx_arr_symbols);
+        for (size_t i = 0; i < 11; i++)
+            if (i != 1)
+                mxDestroyArray((mxArray*) prhs[i]);
+    }
+    mxDestroyArray(mx_arr_read);
+
+    if (!read_times.empty())
+    {
+        res->read_min = *std::min_element(read_times.begin(), read_times.end());
+        res->read_median = median(read_times);
+    }
+    if (!write_times.empty())
+    {
+        res->write_min = *std::min_element(write_times.begin(), write_times.end());
+        res->write_median = median(write_times);
+    }
+
+    if (!opts.keep)
+    {
+        remove(read_file.c_str());
+        remove(write_file.c_str());
+    }
+}
+
+static std::string json_escape(
+    const std::string& str          /** string to be escaped */
+)
+{
+    std::string out;
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        if ((unsigned char) c < 0x20)
+            continue;
+        out += c;
+    }
+    return out;
+}
+
+static void print_result(
+    const Options&  opts,           /** options */
+    const Scenario& s,              /** scenario */
+    const Result&   r,              /** result */
+    bool            first           /** true if first result */
+)
+{
+    double read_rate = r.nrecs / r.read_min;
+    double write_rate = r.nrecs / r.write_min;
+
+    if (opts.output == "json")
+    {
+        printf("%s\n  {\"format\": \"%s\", \"type\": \"%s\", \"dim\": %d, \"density\": %g, "
+            "\"uels\": %d, \"sv_share\": %g, \"records\": %zu, \"file_bytes\": %zu, "
+            "\"status\": \"%s\", \"message\": \"%s\"", first ? "[" : ",",
+            s.format.c_str(), s.type.c_str(), s.dim, s.density, s.uels, s.sv_share, r.nrecs,
+            r.file_bytes, r.status.c_str(), json_escape(r.message).c_str());
+        /* JSON has no NaN: missing timings are null */
+        const char* keys[] = {"read_min_s", "read_median_s", "read_records_per_s",
+            "write_min_s", "write_median_s", "write_records_per_s"};
+        double vals[] = {r.read_min, r.read_median, read_rate, r.write_min, r.write_median, write_rate};
+        for (size_t i = 0; i < 6; i++)
+            if (isfinite(vals[i]))
+                printf(", \"%s\": %.9g", keys[i], vals[i]);
+            else
+                printf(", \"%s\": null", keys[i]);
+        printf("}");
+    }
+    else
+    {
+        if (first)
+            printf("format,type,dim,density,uels,sv_share,records,file_bytes,read_min_s,"
+                "read_median_s,read_records_per_s,write_min_s,write_median_s,"
+                "write_records_per_s,status,message\n");
+        printf("%s,%s,%d,%g,%d,%g,%zu,%zu,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%s,\"%s\"\n",
+            s.format.c_str(), s.type.c_str(), s.dim, s.density, s.uels, s.sv_share, r.nrecs,
+            r.file_bytes, r.read_min, r.read_median, read_rate, r.write_min, r.write_median,
+            write_rate, r.status.c_str(), r.message.c_str());
+    }
+    fflush(stdout);
+}
+
+int main(
+    int             argc,
+    char**          argv
+)
+{
+    Options opts;
+    size_t nr = 0;
+    bool any_error = false;
+
+    if (!parse_options(argc, argv, &opts))
+    {
+        usage();
+        return 2;
+    }
+
+    gt_shim_set_warnings(false);
+    gt_shim_register_function("getAxisLabels", get_axis_labels);
+
+    for (const std::string& format : opts.formats)
+    for (const std::string& type : opts.types)
+    for (int dim : opts.dims)
+    for (double density : opts.densities)
+    for (int uels : opts.uels)
+    for (double sv_share : opts.sv_shares)
+    {
+        Scenario s = {format, type, dim, density, uels, sv_share};
+        Result r;
+
+        run_scenario(opts, s, nr, &r);
+        print_result(opts, s, r, nr == 0);
+        any_error = any_error || r.status == "error";
+        nr++;
+    }
+    if (opts.output == "json")
+        printf("%s]\n", nr == 0 ? "[" : "\n");
+
+    return any_error ? 1 : 0;
+}
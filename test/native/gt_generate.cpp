@@ -0,0 +1,148 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Synthetic GDX file generator (command line)
+ *
+ * Writes a GDX file of the given specification (see gt_generator.h) and prints
+ * a summary line. See README.md for usage.
+ */
+
+#include "gt_generator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+static void usage(void)
+{
+    printf(
+        "Usage: gt_generate [options] FILE\n"
+        "  --symbols N        number of symbols (default: 1)\n"
+        "  --type TYPE        symbol type: set,parameter,variable,equation (default: parameter)\n"
+        "  --dim N            symbol dimension (default: 2)\n"
+        "  --density D        share of records in domain cross product (default: 0.1)\n"
+        "  --uels N           number of UELs per dimension (default: 1000)\n"
+        "  --domain MODE      domain structure: regular,relaxed,universe (default: regular)\n"
+        "  --text S           share of set records with element text (default: 0)\n"
+        "  --sv S             share of special values (default: 0)\n"
+        "  --acronyms N       number of acronyms (default: 0)\n"
+        "  --acronym-share S  share of acronyms in level values (default: 0)\n"
+        "  --compress         write compressed GDX file\n"
+        "  --seed N           random seed (default: 1)\n");
+}
+
+static bool parse_options(
+    int             argc,           /** number of arguments */
+    char**          argv,           /** arguments */
+    GT_GEN_SPEC*    spec,           /** parsed specification */
+    std::string*    filename        /** GDX filename */
+)
+{
+    gt_gen_spec_init(spec);
+    filename->clear();
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--compress")
+        {
+            spec->compress = 1;
+            continue;
+        }
+        if (arg.compare(0, 2, "--"))
+        {
+            if (!filename->empty())
+                return false;
+            *filename = arg;
+            continue;
+        }
+        if (arg == "--help" || i + 1 >= argc)
+            return false;
+        const char* value = argv[++i];
+
+        if (arg == "--symbols")
+            spec->n_symbols = atoi(value);
+        else if (arg == "--type")
+            spec->type = gt_gen_type(value);
+        else if (arg == "--dim")
+            spec->dim = atoi(value);
+        else if (arg == "--density")
+            spec->density = atof(value);
+        else if (arg == "--uels")
+            spec->n_uels = atoi(value);
+        else if (arg == "--domain")
+        {
+            int domain = gt_gen_domain(value);
+            if (domain < 0)
+                return false;
+            spec->domain = (GT_GEN_DOMAIN) domain;
+        }
+        else if (arg == "--text")
+            spec->text_share = atof(value);
+        else if (arg == "--sv")
+            spec->sv_share = atof(value);
+        else if (arg == "--acronyms")
+            spec->n_acronyms = atoi(value);
+        else if (arg == "--acronym-share")
+            spec->acronym_share = atof(value);
+        else if (arg == "--seed")
+            spec->seed = strtoull(value, NULL, 10);
+        else
+            return false;
+    }
+
+    return !filename->empty();
+}
+
+int main(
+    int             argc,
+    char**          argv
+)
+{
+    GT_GEN_SPEC spec;
+    std::string filename, msg;
+    std::vector<size_t> nrecs;
+    size_t total = 0;
+
+    if (!parse_options(argc, argv, &spec, &filename))
+    {
+        usage();
+        return 2;
+    }
+    if (!gt_gen_write(filename.c_str(), &spec, &nrecs, &msg))
+    {
+        fprintf(stderr, "gt_generate: %s\n", msg.c_str());
+        return 1;
+    }
+
+    for (size_t n : nrecs)
+        total += n;
+    printf("%s: %zu symbols, %zu records\n", filename.c_str(), nrecs.size(), total);
+
+    return 0;
+}
@@ -0,0 +1,317 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gt_generator.h"
+
+#ifdef HAS_GDX_SOURCE
+#define NO_SET_LOAD_PATH_DEF
+#include "gdxcwrap.hpp"
+#else
+#include "gdxcc.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/** xorshift64* pseudo random numbers (reproducible across platforms) */
+static double rand_uniform(
+    uint64_t*       state           /** random state (nonzero) */
+)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return (double) ((*state * 0x2545F4914F6CDD1DULL) >> 11) / 9007199254740992.0;
+}
+
+void gt_gen_spec_init(
+    GT_GEN_SPEC*    spec            /** specification */
+)
+{
+    spec->n_symbols = 1;
+    spec->type = GMS_DT_PAR;
+    spec->dim = 2;
+    spec->density = 0.1;
+    spec->n_uels = 1000;
+    spec->domain = GT_GEN_DOMAIN_REGULAR;
+    spec->text_share = 0;
+    spec->sv_share = 0;
+    spec->n_acronyms = 0;
+    spec->acronym_share = 0;
+    spec->compress = 0;
+    spec->seed = 1;
+}
+
+int gt_gen_type(
+    const std::string& name         /** symbol type name */
+)
+{
+    if (name == "set")
+        return GMS_DT_SET;
+    if (name == "parameter")
+        return GMS_DT_PAR;
+    if (name == "variable")
+        return GMS_DT_VAR;
+    if (name == "equation")
+        return GMS_DT_EQU;
+    return -1;
+}
+
+int gt_gen_domain(
+    const std::string& name         /** domain structure name */
+)
+{
+    if (name == "regular")
+        return GT_GEN_DOMAIN_REGULAR;
+    if (name == "relaxed")
+        return GT_GEN_DOMAIN_RELAXED;
+    if (name == "universe")
+        return GT_GEN_DOMAIN_UNIVERSE;
+    return -1;
+}
+
+bool gt_gen_check(
+    const GT_GEN_SPEC* spec,        /** specification */
+    std::string*    msg             /** error message */
+)
+{
+    if (spec->n_symbols < 1)
+        *msg = "number of symbols must be positive";
+    else if (spec->type != GMS_DT_SET && spec->type != GMS_DT_PAR && spec->type != GMS_DT_VAR &&
+        spec->type != GMS_DT_EQU)
+        *msg = "invalid symbol type";
+    else if (spec->dim < 0 || spec->dim > GLOBAL_MAX_INDEX_DIM)
+        *msg = "invalid dimension";
+    else if (spec->density <= 0 || spec->density > 1)
+        *msg = "density must be in (0,1]";
+    else if (spec->n_uels < 1)
+        *msg = "number of UELs must be positive";
+    else if (pow((double) spec->n_uels, spec->dim) > 9007199254740992.0)
+        *msg = "domain cross product too large";
+    else if (spec->text_share < 0 || spec->text_share > 1 || spec->sv_share < 0 ||
+        spec->sv_share > 1 || spec->acronym_share < 0 || spec->acronym_share > 1)
+        *msg = "shares must be in [0,1]";
+    else if (spec->n_acronyms < 0 || (spec->acronym_share > 0 && spec->n_acronyms == 0))
+        *msg = "acronym share requires a positive number of acronyms";
+    else
+        return true;
+    return false;
+}
+
+/** sets msg to last GDX error and returns false */
+static bool gdx_error(
+    gdxHandle_t     gdx,            /** GDX handle */
+    std::string*    msg             /** error message */
+)
+{
+    char buf[GMS_SSSIZE];
+
+    gdxErrorStr(gdx, gdxGetLastError(gdx), buf);
+    *msg = std::string("GDX error: ") + buf;
+    return false;
+}
+
+/** writes one symbol; records are drawn with geometric gaps to get the requested density in
+ *  row-major (sorted) order without scanning the full cross product */
+static bool write_symbol(
+    gdxHandle_t     gdx,            /** GDX handle */
+    const GT_GEN_SPEC* spec,        /** specification */
+    const char*     name,           /** symbol name */
+    int             symbol_nr,      /** symbol number in file */
+    uint64_t*       state,          /** random state */
+    size_t*         nrecs,          /** number of written records */
+    std::string*    msg             /** error message */
+)
+{
+    const double sv[5] = {GMS_SV_UNDEF, GMS_SV_NA, GMS_SV_PINF, GMS_SV_MINF, GMS_SV_EPS};
+    char buf[GMS_SSSIZE];
+    int subtype = 0, text_id;
+    bool is_var = spec->type == GMS_DT_VAR;
+    bool is_equ = spec->type == GMS_DT_EQU;
+    double ncells, lin;
+    gdxUelIndex_t keys;
+    gdxValues_t values;
+    gdxStrIndex_t domains;
+    gdxStrIndexPtrs_t domains_ptr;
+
+    GDXSTRINDEXPTRS_INIT(domains, domains_ptr);
+
+    if (is_var)
+        subtype = GMS_VARTYPE_POSITIVE;
+    else if (is_equ)
+        subtype = GMS_EQUTYPE_E + GMS_EQU_USERINFO_BASE;
+
+    if (!gdxDataWriteRawStart(gdx, name, "generated symbol", spec->dim, spec->type, subtype))
+        return gdx_error(gdx, msg);
+    for (int k = 0; k < spec->dim; k++)
+        strcpy(domains_ptr[k], "i");
+    if (spec->dim > 0 && spec->domain == GT_GEN_DOMAIN_REGULAR &&
+        !gdxSymbolSetDomain(gdx, (const char**) domains_ptr))
+        return gdx_error(gdx, msg);
+    if (spec->dim > 0 && spec->domain == GT_GEN_DOMAIN_RELAXED &&
+        !gdxSymbolSetDomainX(gdx, symbol_nr, (const char**) domains_ptr))
+        return gdx_error(gdx, msg);
+
+    ncells = pow((double) spec->n_uels, spec->dim);
+    *nrecs = 0;
+    lin = -1;
+    while (true)
+    {
+        if (spec->density >= 1)
+            lin += 1;
+        else
+            lin += 1 + floor(log(1 - rand_uniform(state)) / log(1 - spec->density));
+        if (lin >= ncells)
+            break;
+
+        double rem = lin;
+        for (int k = spec->dim - 1; k >= 0; k--)
+        {
+            keys[k] = (int) fmod(rem, spec->n_uels) + 1;
+            rem = floor(rem / spec->n_uels);
+        }
+
+        memset(values, 0, sizeof(values));
+        if (spec->type == GMS_DT_SET)
+        {
+            if (spec->text_share > 0 && rand_uniform(state) < spec->text_share)
+            {
+                snprintf(buf, sizeof(buf), "%.63s text %zu", name, *nrecs + 1);
+                if (!gdxAddSetText(gdx, buf, &text_id))
+                    return gdx_error(gdx, msg);
+                values[GMS_VAL_LEVEL] = text_id;
+            }
+        }
+        else
+        {
+            values[GMS_VAL_LEVEL] = 1 + floor(rand_uniform(state) * 1000);
+            if (spec->sv_share > 0 && rand_uniform(state) < spec->sv_share)
+                values[GMS_VAL_LEVEL] = sv[(int) (rand_uniform(state) * 5) % 5];
+            else if (spec->acronym_share > 0 && rand_uniform(state) < spec->acronym_share)
+                values[GMS_VAL_LEVEL] = GMS_SV_ACR *
+                    (1 + (int) (rand_uniform(state) * spec->n_acronyms) % spec->n_acronyms);
+            if (is_var || is_equ)
+            {
+                values[GMS_VAL_MARGINAL] = floor(rand_uniform(state) * 10);
+                values[GMS_VAL_UPPER] = is_var ? GMS_SV_PINF : 0;
+                values[GMS_VAL_SCALE] = 1;
+            }
+        }
+
+        if (!gdxDataWriteRaw(gdx, keys, values))
+            return gdx_error(gdx, msg);
+        (*nrecs)++;
+    }
+    if (!gdxDataWriteDone(gdx))
+        return gdx_error(gdx, msg);
+    return true;
+}
+
+bool gt_gen_write(
+    const char*     filename,       /** GDX filename */
+    const GT_GEN_SPEC* spec,        /** specification */
+    std::vector<size_t>* nrecs,     /** number of generated records per symbol (can be NULL) */
+    std::string*    msg             /** error message */
+)
+{
+    char buf[GMS_SSSIZE], name[GMS_SSSIZE];
+    int status, uel_id, symbol_nr = 0;
+    uint64_t state = spec->seed ? spec->seed : 1;
+    size_t n;
+    gdxHandle_t gdx = NULL;
+    gdxUelIndex_t keys;
+    gdxValues_t values;
+
+    if (!gt_gen_check(spec, msg))
+        return false;
+    if (nrecs)
+        nrecs->clear();
+
+    if (!gdxCreate(&gdx, buf, sizeof(buf)))
+    {
+        *msg = std::string("GDX init failed: ") + buf;
+        return false;
+    }
+    if (!gdxOpenWriteEx(gdx, filename, "GAMS Transfer Matlab generator", spec->compress, &status))
+    {
+        gdxErrorStr(gdx, status, buf);
+        *msg = std::string("GDX error: ") + buf;
+        gdxFree(&gdx);
+        return false;
+    }
+
+    /* UELs */
+    gdxUELRegisterStrStart(gdx);
+    for (int i = 0; i < spec->n_uels; i++)
+    {
+        snprintf(buf, sizeof(buf), "i%d", i + 1);
+        gdxUELRegisterStr(gdx, buf, &uel_id);
+    }
+    gdxUELRegisterDone(gdx);
+
+    /* acronyms (level values are multiples of GMS_SV_ACR) */
+    for (int i = 0; i < spec->n_acronyms; i++)
+    {
+        snprintf(name, sizeof(name), "acr%d", i + 1);
+        snprintf(buf, sizeof(buf), "acronym %d", i + 1);
+        gdxAcronymAdd(gdx, name, buf, i + 1);
+    }
+
+    /* domain set */
+    if (spec->domain == GT_GEN_DOMAIN_REGULAR)
+    {
+        memset(values, 0, sizeof(values));
+        gdxDataWriteRawStart(gdx, "i", "generated domain", 1, GMS_DT_SET, 0);
+        for (int i = 0; i < spec->n_uels; i++)
+        {
+            keys[0] = i + 1;
+            gdxDataWriteRaw(gdx, keys, values);
+        }
+        gdxDataWriteDone(gdx);
+        symbol_nr++;
+    }
+
+    /* generated symbols */
+    for (int i = 0; i < spec->n_symbols; i++)
+    {
+        if (spec->n_symbols == 1)
+            strcpy(name, "x");
+        else
+            snprintf(name, sizeof(name), "x%d", i + 1);
+        if (!write_symbol(gdx, spec, name, ++symbol_nr, &state, &n, msg))
+        {
+            gdxClose(gdx);
+            gdxFree(&gdx);
+            return false;
+        }
+        if (nrecs)
+            nrecs->push_back(n);
+    }
+
+    gdxClose(gdx);
+    gdxFree(&gdx);
+    return true;
+}
@@ -0,0 +1,99 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Synthetic GDX file generator
+ *
+ * Writes GDX files with a controlled number of symbols, dimension, density,
+ * UEL cardinality, domain structure, set element text share, special values
+ * and acronyms through gdxDataWriteRaw. Records are drawn from a seeded
+ * xorshift64* generator, so a given specification yields the same file on
+ * every platform. Used by gt_generate and gt_benchmark.
+ */
+
+#ifndef _GAMS_TRANSFER_NATIVE_GT_GENERATOR_H_
+#define _GAMS_TRANSFER_NATIVE_GT_GENERATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+/** domain structure of generated symbols */
+typedef enum
+{
+    GT_GEN_DOMAIN_REGULAR,          /** domain set i is written and referenced */
+    GT_GEN_DOMAIN_RELAXED,          /** domain i is referenced by name only (set not written) */
+    GT_GEN_DOMAIN_UNIVERSE,         /** no domain information (universe *) */
+} GT_GEN_DOMAIN;
+
+typedef struct
+{
+    int             n_symbols;      /** number of symbols (named x or x1, x2, ...) */
+    int             type;           /** symbol type: GMS_DT_SET, _PAR, _VAR or _EQU */
+    int             dim;            /** symbol dimension */
+    double          density;        /** share of records in domain cross product (0,1] */
+    int             n_uels;         /** number of UELs per dimension (= records of domain set) */
+    GT_GEN_DOMAIN   domain;         /** domain structure */
+    double          text_share;     /** share of set records with element text */
+    double          sv_share;       /** share of special values in level values */
+    int             n_acronyms;     /** number of acronyms defined in file */
+    double          acronym_share;  /** share of acronyms in level values */
+    int             compress;       /** compression flag of GDX file */
+    uint64_t        seed;           /** random seed */
+} GT_GEN_SPEC;
+
+/** initializes generator specification with defaults (one 2-dim parameter of density 0.1
+ *  over 1000 UELs with regular domain) */
+void gt_gen_spec_init(
+    GT_GEN_SPEC*    spec            /** specification */
+);
+
+/** parses a symbol type name (set, parameter, variable, equation); returns -1 if invalid */
+int gt_gen_type(
+    const std::string& name         /** symbol type name */
+);
+
+/** parses a domain structure name (regular, relaxed, universe); returns -1 if invalid */
+int gt_gen_domain(
+    const std::string& name         /** domain structure name */
+);
+
+/** checks specification; returns false and sets msg if invalid */
+bool gt_gen_check(
+    const GT_GEN_SPEC* spec,        /** specification */
+    std::string*    msg             /** error message */
+);
+
+/** writes GDX file of given specification; returns false and sets msg on error */
+bool gt_gen_write(
+    const char*     filename,       /** GDX filename */
+    const GT_GEN_SPEC* spec,        /** specification */
+    std::vector<size_t>* nrecs,     /** number of generated records per symbol (can be NULL) */
+    std::string*    msg             /** error message */
+);
+
+#endif
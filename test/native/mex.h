@@ -0,0 +1,250 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Native array shim of the MEX API
+ *
+ * Implements the subset of the Matlab MEX API used by the GAMS Transfer MEX
+ * sources (+gams/+transfer/+gdx), such that these sources can be compiled
+ * unchanged into a standalone executable. Arrays are plain heap objects;
+ * Matlab objects are emulated by structs with a class name (see
+ * gt_shim_create_object). Calls into Matlab (mexCallMATLAB) are served by a
+ * few builtin conversions and by handlers registered with
+ * gt_shim_register_function.
+ *
+ * The shim always provides the interleaved complex API (WITH_R2018A_OR_NEWER).
+ */
+
+#ifndef _GAMS_TRANSFER_NATIVE_MEX_H_
+#define _GAMS_TRANSFER_NATIVE_MEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef WITH_R2018A_OR_NEWER
+#define WITH_R2018A_OR_NEWER
+#endif
+
+typedef struct mxArray_tag mxArray;
+
+typedef size_t mwSize;
+typedef size_t mwIndex;
+typedef ptrdiff_t mwSignedIndex;
+
+typedef double mxDouble;
+typedef bool mxLogical;
+typedef uint8_t mxUint8;
+typedef int32_t mxInt32;
+typedef uint64_t mxUint64;
+typedef uint8_t UINT8_T;
+typedef int32_t INT32_T;
+typedef uint64_t UINT64_T;
+
+typedef enum
+{
+    mxREAL,
+    mxCOMPLEX,
+} mxComplexity;
+
+typedef enum
+{
+    mxUNKNOWN_CLASS,
+    mxCELL_CLASS,
+    mxSTRUCT_CLASS,
+    mxLOGICAL_CLASS,
+    mxCHAR_CLASS,
+    mxVOID_CLASS,
+    mxDOUBLE_CLASS,
+    mxSINGLE_CLASS,
+    mxINT8_CLASS,
+    mxUINT8_CLASS,
+    mxINT16_CLASS,
+    mxUINT16_CLASS,
+    mxINT32_CLASS,
+    mxUINT32_CLASS,
+    mxINT64_CLASS,
+    mxUINT64_CLASS,
+    mxFUNCTION_CLASS,
+    mxOPAQUE_CLASS,
+    mxOBJECT_CLASS,
+} mxClassID;
+
+/** handler for mexCallMATLAB (return 0 on success) */
+typedef int (*gt_shim_function_t)(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    mxArray*        prhs[]          /** inputs */
+);
+
+/** MEX entry point as provided by each MEX source */
+typedef void (*gt_shim_mex_t)(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    const mxArray*  prhs[]          /** inputs */
+);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef NDEBUG
+#define mxAssert(expr, msg) ((void) 0)
+#else
+#define mxAssert(expr, msg) do { if (!(expr)) mexErrMsgIdAndTxt("gams:transfer:shim:assert", \
+    "Assertion failed: %s (%s:%d): %s", #expr, __FILE__, __LINE__, msg); } while (0)
+#endif
+
+#if defined(__GNUC__)
+#define GT_SHIM_NORETURN __attribute__((noreturn))
+#else
+#define GT_SHIM_NORETURN
+#endif
+
+/* MEX functions */
+void mexFunction(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[]);
+GT_SHIM_NORETURN void mexErrMsgIdAndTxt(const char* id, const char* fmt, ...);
+void mexWarnMsgIdAndTxt(const char* id, const char* fmt, ...);
+void mexPrintf(const char* fmt, ...);
+int mexCallMATLAB(int nlhs, mxArray* plhs[], int nrhs, mxArray* prhs[], const char* name);
+
+/* memory */
+void* mxMalloc(size_t n);
+void* mxCalloc(size_t n, size_t size);
+void* mxRealloc(void* ptr, size_t size);
+void mxFree(void* ptr);
+
+/* creation / destruction */
+mxArray* mxCreateDoubleMatrix(size_t m, size_t n, mxComplexity flag);
+mxArray* mxCreateDoubleScalar(double value);
+mxArray* mxCreateLogicalMatrix(size_t m, size_t n);
+mxArray* mxCreateLogicalScalar(bool value);
+mxArray* mxCreateNumericMatrix(size_t m, size_t n, mxClassID classid, mxComplexity flag);
+mxArray* mxCreateNumericArray(size_t ndim, const size_t* dims, mxClassID classid, mxComplexity flag);
+mxArray* mxCreateSparse(size_t m, size_t n, size_t nzmax, mxComplexity flag);
+mxArray* mxCreateString(const char* str);
+mxArray* mxCreateCellMatrix(size_t m, size_t n);
+mxArray* mxCreateStructMatrix(size_t m, size_t n, int nfields, const char** fieldnames);
+mxArray* mxDuplicateArray(const mxArray* array);
+void mxDestroyArray(mxArray* array);
+
+/* type queries */
+mxClassID mxGetClassID(const mxArray* array);
+const char* mxGetClassName(const mxArray* array);
+bool mxIsClass(const mxArray* array, const char* name);
+bool mxIsNumeric(const mxArray* array);
+bool mxIsDouble(const mxArray* array);
+bool mxIsLogical(const mxArray* array);
+bool mxIsChar(const mxArray* array);
+bool mxIsCell(const mxArray* array);
+bool mxIsStruct(const mxArray* array);
+bool mxIsSparse(const mxArray* array);
+bool mxIsUint8(const mxArray* array);
+bool mxIsInt32(const mxArray* array);
+bool mxIsUint64(const mxArray* array);
+
+/* dimensions */
+size_t mxGetM(const mxArray* array);
+size_t mxGetN(const mxArray* array);
+void mxSetM(mxArray* array, size_t m);
+size_t mxGetNumberOfDimensions(const mxArray* array);
+const size_t* mxGetDimensions(const mxArray* array);
+size_t mxGetNumberOfElements(const mxArray* array);
+size_t mxGetElementSize(const mxArray* array);
+size_t mxCalcSingleSubscript(const mxArray* array, size_t nsubs, const size_t* subs);
+
+/* data access */
+void* mxGetData(const mxArray* array);
+double* mxGetPr(const mxArray* array);
+mxDouble* mxGetDoubles(const mxArray* array);
+mxLogical* mxGetLogicals(const mxArray* array);
+mxUint8* mxGetUint8s(const mxArray* array);
+mxInt32* mxGetInt32s(const mxArray* array);
+mxUint64* mxGetUint64s(const mxArray* array);
+double mxGetScalar(const mxArray* array);
+int mxGetString(const mxArray* array, char* buf, size_t buflen);
+mwIndex* mxGetIr(const mxArray* array);
+mwIndex* mxGetJc(const mxArray* array);
+size_t mxGetNzmax(const mxArray* array);
+void mxSetNzmax(mxArray* array, size_t nzmax);
+
+/* cells and structs */
+mxArray* mxGetCell(const mxArray* array, size_t idx);
+void mxSetCell(mxArray* array, size_t idx, mxArray* value);
+int mxGetNumberOfFields(const mxArray* array);
+const char* mxGetFieldNameByNumber(const mxArray* array, int fieldnum);
+int mxGetFieldNumber(const mxArray* array, const char* fieldname);
+int mxAddField(mxArray* array, const char* fieldname);
+void mxRemoveField(mxArray* array, int fieldnum);
+mxArray* mxGetField(const mxArray* array, size_t idx, const char* fieldname);
+mxArray* mxGetFieldByNumber(const mxArray* array, size_t idx, int fieldnum);
+void mxSetField(mxArray* array, size_t idx, const char* fieldname, mxArray* value);
+void mxSetFieldByNumber(mxArray* array, size_t idx, int fieldnum, mxArray* value);
+mxArray* mxGetProperty(const mxArray* array, size_t idx, const char* propname);
+
+/* special values */
+double mxGetInf(void);
+double mxGetNaN(void);
+bool mxIsInf(double value);
+bool mxIsNaN(double value);
+
+/** creates an emulated Matlab object of given class (properties are added by mxAddField);
+ *  mxGetProperty returns handle objects by reference and copies any other value */
+mxArray* gt_shim_create_object(
+    const char*     classname,      /** full Matlab class name, e.g. gams.transfer.symbol.Set */
+    bool            is_handle       /** true: object is a handle object */
+);
+
+/** registers a handler for mexCallMATLAB; replaces handler of same name */
+void gt_shim_register_function(
+    const char*     name,           /** Matlab function name */
+    gt_shim_function_t func         /** handler */
+);
+
+/** calls a MEX entry point like Matlab does: arrays created during the call that are not
+ *  returned are destroyed afterwards; returns false if the call raised an error */
+bool gt_shim_call(
+    gt_shim_mex_t   func,           /** MEX entry point */
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs (owned by caller on success) */
+    int             nrhs,           /** number of inputs */
+    const mxArray*  prhs[]          /** inputs */
+);
+
+/** returns message of last error raised by mexErrMsgIdAndTxt */
+const char* gt_shim_last_error(void);
+
+/** enables / disables printing of warnings (default: enabled) */
+void gt_shim_set_warnings(
+    bool            enable          /** true: print warnings to stderr */
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
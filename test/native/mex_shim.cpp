@@ -0,0 +1,1040 @@
+/*
+ * GAMS - General Algebraic Modeling System Matlab API
+ *
+ * Copyright (c) 2020-2024 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2020-2024 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <setjmp.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+struct mxArray_tag
+{
+    mxClassID classid;
+    std::string classname;                          /* class name of emulated objects */
+    bool is_handle;                                 /* emulated object is a handle object */
+    std::vector<size_t> dims;
+    size_t elsize;
+    void* data;
+    bool sparse;
+    size_t nzmax;
+    mwIndex* ir;
+    mwIndex* jc;
+    std::vector<std::string> fields;                /* struct fields or object properties */
+    std::vector<std::vector<mxArray*>> values;      /* struct values (per field) or cells (values[0]) */
+};
+
+/* state of current MEX call (Matlab frees temporary arrays and memory after a MEX call) */
+static bool g_in_call = false;
+static jmp_buf g_jmp;
+static std::unordered_set<mxArray*> g_call_arrays;
+static std::unordered_set<void*> g_call_memory;
+static std::unordered_map<std::string, gt_shim_function_t> g_functions;
+static char g_last_error[2048] = "";
+static bool g_warnings = true;
+
+static size_t element_size(
+    mxClassID       classid         /** class id */
+)
+{
+    switch (classid)
+    {
+        case mxLOGICAL_CLASS: return sizeof(mxLogical);
+        case mxCHAR_CLASS: return sizeof(char);
+        case mxDOUBLE_CLASS: return sizeof(double);
+        case mxSINGLE_CLASS: return sizeof(float);
+        case mxINT8_CLASS: return sizeof(int8_t);
+        case mxUINT8_CLASS: return sizeof(uint8_t);
+        case mxINT16_CLASS: return sizeof(int16_t);
+        case mxUINT16_CLASS: return sizeof(uint16_t);
+        case mxINT32_CLASS: return sizeof(int32_t);
+        case mxUINT32_CLASS: return sizeof(uint32_t);
+        case mxINT64_CLASS: return sizeof(int64_t);
+        case mxUINT64_CLASS: return sizeof(uint64_t);
+        default: return 0;
+    }
+}
+
+static size_t numel(
+    const mxArray*  array           /** array */
+)
+{
+    size_t n = 1;
+    for (size_t d : array->dims)
+        n *= d;
+    return n;
+}
+
+static mxArray* create_array(
+    mxClassID       classid,        /** class id */
+    size_t          ndim,           /** number of dimensions */
+    const size_t*   dims            /** dimensions */
+)
+{
+    mxArray* array = new mxArray_tag();
+    array->classid = classid;
+    array->is_handle = false;
+    array->dims.assign(dims, dims + ndim);
+    while (array->dims.size() < 2)
+        array->dims.push_back(1);
+    while (array->dims.size() > 2 && array->dims.back() == 1)
+        array->dims.pop_back();
+    array->elsize = element_size(classid);
+    array->data = NULL;
+    array->sparse = false;
+    array->nzmax = 0;
+    array->ir = NULL;
+    array->jc = NULL;
+
+    size_t n = numel(array);
+    if (array->elsize > 0)
+        array->data = calloc(n > 0 ? n : 1, array->elsize);
+    if (classid == mxCELL_CLASS)
+        array->values.assign(1, std::vector<mxArray*>(n, NULL));
+
+    if (g_in_call)
+        g_call_arrays.insert(array);
+    return array;
+}
+
+static void free_array(
+    mxArray*        array           /** array to be freed (without its elements) */
+)
+{
+    if (g_in_call)
+        g_call_arrays.erase(array);
+    free(array->data);
+    free(array->ir);
+    free(array->jc);
+    delete array;
+}
+
+static void keep_array(
+    mxArray*        array           /** array to be kept after MEX call (with its elements) */
+)
+{
+    if (!array)
+        return;
+    g_call_arrays.erase(array);
+    for (auto& field : array->values)
+        for (mxArray* value : field)
+            keep_array(value);
+}
+
+static void check_class(
+    const mxArray*  array,          /** array */
+    mxClassID       classid,        /** required class id */
+    const char*     func            /** calling function */
+)
+{
+    if (!array || array->classid != classid)
+        mexErrMsgIdAndTxt("gams:transfer:shim:type", "%s: Invalid array type.", func);
+}
+
+static bool has_fields(
+    const mxArray*  array           /** array */
+)
+{
+    return array && (array->classid == mxSTRUCT_CLASS || array->classid == mxOBJECT_CLASS);
+}
+
+/* builtin replacements of Matlab functions used by the MEX sources */
+
+static double to_double(
+    const mxArray*  array,          /** numeric or logical array */
+    size_t          idx             /** linear index */
+)
+{
+    switch (array->classid)
+    {
+        case mxLOGICAL_CLASS: return ((mxLogical*) array->data)[idx];
+        case mxDOUBLE_CLASS: return ((double*) array->data)[idx];
+        case mxSINGLE_CLASS: return ((float*) array->data)[idx];
+        case mxINT8_CLASS: return ((int8_t*) array->data)[idx];
+        case mxUINT8_CLASS: return ((uint8_t*) array->data)[idx];
+        case mxINT16_CLASS: return ((int16_t*) array->data)[idx];
+        case mxUINT16_CLASS: return ((uint16_t*) array->data)[idx];
+        case mxINT32_CLASS: return ((int32_t*) array->data)[idx];
+        case mxUINT32_CLASS: return ((uint32_t*) array->data)[idx];
+        case mxINT64_CLASS: return (double) ((int64_t*) array->data)[idx];
+        case mxUINT64_CLASS: return (double) ((uint64_t*) array->data)[idx];
+        default: return 0.0;
+    }
+}
+
+static int builtin_convert(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    int             nrhs,           /** number of inputs */
+    mxArray*        prhs[],         /** inputs */
+    mxClassID       classid         /** target class */
+)
+{
+    if (nlhs != 1 || nrhs != 1 || !prhs[0] || prhs[0]->sparse || prhs[0]->elsize == 0 ||
+        prhs[0]->classid == mxCHAR_CLASS)
+        return 1;
+
+    size_t n = numel(prhs[0]);
+    plhs[0] = create_array(classid, prhs[0]->dims.size(), prhs[0]->dims.data());
+    for (size_t i = 0; i < n; i++)
+    {
+        double x = round(to_double(prhs[0], i));
+        switch (classid)
+        {
+            case mxINT32_CLASS:
+                x = isnan(x) ? 0 : (x < INT32_MIN ? INT32_MIN : (x > INT32_MAX ? INT32_MAX : x));
+                ((int32_t*) plhs[0]->data)[i] = (int32_t) x;
+                break;
+            case mxUINT64_CLASS:
+                if (prhs[0]->classid == mxUINT64_CLASS)
+                    ((uint64_t*) plhs[0]->data)[i] = ((uint64_t*) prhs[0]->data)[i];
+                else
+                    ((uint64_t*) plhs[0]->data)[i] = (isnan(x) || x < 0) ? 0 : (uint64_t) x;
+                break;
+            default:
+                return 1;
+        }
+    }
+    return 0;
+}
+
+static int builtin_logical(
+    int             nlhs,           /** number of outputs */
+    mxArray*        plhs[],         /** outputs */
+    bool            value           /** result */
+)
+{
+    if (nlhs != 1)
+        return 1;
+    plhs[0] = mxCreateLogicalScalar(value);
+    return 0;
+}
+
+static bool is_cellstr(
+    const mxArray*  array           /** array */
+)
+{
+    if (!mxIsCell(array))
+        return false;
+    for (mxArray* value : array->values[0])
+        if (!value || !mxIsChar(value))
+            return false;
+    return true;
+}
+
+extern "C" {
+
+void mexErrMsgIdAndTxt(
+    const char*     id,
+    const char*     fmt,
+    ...
+)
+{
+    va_list args;
+    int n;
+
+    n = snprintf(g_last_error, sizeof(g_last_error), "%s: ", id);
+    va_start(args, fmt);
+    vsnprintf(g_last_error + n, sizeof(g_last_error) - n, fmt, args);
+    va_end(args);
+
+    if (g_in_call)
+        longjmp(g_jmp, 1);
+
+    fprintf(stderr, "Error: %s\n", g_last_error);
+    abort();
+}
+
+void mexWarnMsgIdAndTxt(
+    const char*     id,
+    const char*     fmt,
+    ...
+)
+{
+    va_list args;
+
+    if (!g_warnings)
+        return;
+    fprintf(stderr, "Warning (%s): ", id);
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+void mexPrintf(
+    const char*     fmt,
+    ...
+)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+int mexCallMATLAB(
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    mxArray*        prhs[],
+    const char*     name
+)
+{
+    auto it = g_functions.find(name);
+    if (it != g_functions.end())
+        return it->second(nlhs, plhs, nrhs, prhs);
+
+    if (!strcmp(name, "int32"))
+        return builtin_convert(nlhs, plhs, nrhs, prhs, mxINT32_CLASS);
+    if (!strcmp(name, "uint64"))
+        return builtin_convert(nlhs, plhs, nrhs, prhs, mxUINT64_CLASS);
+    if (!strcmp(name, "iscellstr") && nrhs == 1)
+        return builtin_logical(nlhs, plhs, is_cellstr(prhs[0]));
+    if (!strcmp(name, "istable") && nrhs == 1)
+        return builtin_logical(nlhs, plhs, false);
+    if (!strcmp(name, "iscategorical") && nrhs == 1)
+        return builtin_logical(nlhs, plhs, false);
+
+    mexErrMsgIdAndTxt("gams:transfer:shim:mexCallMATLAB", "Function '%s' is not available "
+        "without Matlab.", name);
+}
+
+void* mxMalloc(
+    size_t          n
+)
+{
+    void* ptr = malloc(n > 0 ? n : 1);
+    if (!ptr)
+        mexErrMsgIdAndTxt("gams:transfer:shim:memory", "Out of memory.");
+    if (g_in_call)
+        g_call_memory.insert(ptr);
+    return ptr;
+}
+
+void* mxCalloc(
+    size_t          n,
+    size_t          size
+)
+{
+    void* ptr = calloc(n > 0 ? n : 1, size > 0 ? size : 1);
+    if (!ptr)
+        mexErrMsgIdAndTxt("gams:transfer:shim:memory", "Out of memory.");
+    if (g_in_call)
+        g_call_memory.insert(ptr);
+    return ptr;
+}
+
+void* mxRealloc(
+    void*           ptr,
+    size_t          size
+)
+{
+    void* ptr_new = realloc(ptr, size > 0 ? size : 1);
+    if (!ptr_new)
+        mexErrMsgIdAndTxt("gams:transfer:shim:memory", "Out of memory.");
+    if (g_in_call)
+    {
+        g_call_memory.erase(ptr);
+        g_call_memory.insert(ptr_new);
+    }
+    return ptr_new;
+}
+
+void mxFree(
+    void*           ptr
+)
+{
+    if (g_in_call)
+        g_call_memory.erase(ptr);
+    free(ptr);
+}
+
+mxArray* mxCreateDoubleMatrix(
+    size_t          m,
+    size_t          n,
+    mxComplexity    flag
+)
+{
+    return mxCreateNumericMatrix(m, n, mxDOUBLE_CLASS, flag);
+}
+
+mxArray* mxCreateDoubleScalar(
+    double          value
+)
+{
+    mxArray* array = mxCreateNumericMatrix(1, 1, mxDOUBLE_CLASS, mxREAL);
+    *(double*) array->data = value;
+    return array;
+}
+
+mxArray* mxCreateLogicalMatrix(
+    size_t          m,
+    size_t          n
+)
+{
+    size_t dims[2] = {m, n};
+    return create_array(mxLOGICAL_CLASS, 2, dims);
+}
+
+mxArray* mxCreateLogicalScalar(
+    bool            value
+)
+{
+    mxArray* array = mxCreateLogicalMatrix(1, 1);
+    *(mxLogical*) array->data = value;
+    return array;
+}
+
+mxArray* mxCreateNumericMatrix(
+    size_t          m,
+    size_t          n,
+    mxClassID       classid,
+    mxComplexity    flag
+)
+{
+    size_t dims[2] = {m, n};
+    return mxCreateNumericArray(2, dims, classid, flag);
+}
+
+mxArray* mxCreateNumericArray(
+    size_t          ndim,
+    const size_t*   dims,
+    mxClassID       classid,
+    mxComplexity    flag
+)
+{
+    if (flag != mxREAL || element_size(classid) == 0 || classid == mxCHAR_CLASS)
+        mexErrMsgIdAndTxt("gams:transfer:shim:create", "Unsupported numeric array type.");
+    return create_array(classid, ndim, dims);
+}
+
+mxArray* mxCreateSparse(
+    size_t          m,
+    size_t          n,
+    size_t          nzmax,
+    mxComplexity    flag
+)
+{
+    size_t dims[2] = {0, 0};
+    mxArray* array = NULL;
+
+    if (flag != mxREAL)
+        mexErrMsgIdAndTxt("gams:transfer:shim:create", "Unsupported sparse array type.");
+
+    nzmax = nzmax > 0 ? nzmax : 1;
+    array = create_array(mxDOUBLE_CLASS, 2, dims);
+    array->dims[0] = m;
+    array->dims[1] = n;
+    array->sparse = true;
+    array->nzmax = nzmax;
+    array->data = realloc(array->data, nzmax * sizeof(double));
+    array->ir = (mwIndex*) calloc(nzmax, sizeof(mwIndex));
+    array->jc = (mwIndex*) calloc(n + 1, sizeof(mwIndex));
+    return array;
+}
+
+mxArray* mxCreateString(
+    const char*     str
+)
+{
+    size_t dims[2] = {1, strlen(str)};
+    mxArray* array = create_array(mxCHAR_CLASS, 2, dims);
+    memcpy(array->data, str, dims[1]);
+    return array;
+}
+
+mxArray* mxCreateCellMatrix(
+    size_t          m,
+    size_t          n
+)
+{
+    size_t dims[2] = {m, n};
+    return create_array(mxCELL_CLASS, 2, dims);
+}
+
+mxArray* mxCreateStructMatrix(
+    size_t          m,
+    size_t          n,
+    int             nfields,
+    const char**    fieldnames
+)
+{
+    size_t dims[2] = {m, n};
+    mxArray* array = create_array(mxSTRUCT_CLASS, 2, dims);
+    for (int i = 0; i < nfields; i++)
+        mxAddField(array, fieldnames[i]);
+    return array;
+}
+
+mxArray* mxDuplicateArray(
+    const mxArray*  array
+)
+{
+    mxArray* copy = create_array(array->classid, array->dims.size(), array->dims.data());
+    size_t n = array->sparse ? array->nzmax : numel(array);
+
+    copy->classname = array->classname;
+    copy->is_handle = array->is_handle;
+    copy->sparse = array->sparse;
+    copy->nzmax = array->nzmax;
+    if (array->elsize > 0)
+    {
+        copy->data = realloc(copy->data, (n > 0 ? n : 1) * array->elsize);
+        memcpy(copy->data, array->data, n * array->elsize);
+    }
+    if (array->sparse)
+    {
+        copy->ir = (mwIndex*) malloc(array->nzmax * sizeof(mwIndex));
+        copy->jc = (mwIndex*) malloc((array->dims[1] + 1) * sizeof(mwIndex));
+        memcpy(copy->ir, array->ir, array->nzmax * sizeof(mwIndex));
+        memcpy(copy->jc, array->jc, (array->dims[1] + 1) * sizeof(mwIndex));
+    }
+    copy->fields = array->fields;
+    copy->values = array->values;
+    for (auto& field : copy->values)
+        for (mxArray*& value : field)
+            if (value)
+                value = mxDuplicateArray(value);
+    return copy;
+}
+
+void mxDestroyArray(
+    mxArray*        array
+)
+{
+    if (!array)
+        return;
+    for (auto& field : array->values)
+        for (mxArray* value : field)
+            mxDestroyArray(value);
+    free_array(array);
+}
+
+mxClassID mxGetClassID(
+    const mxArray*  array
+)
+{
+    return array->classid;
+}
+
+const char* mxGetClassName(
+    const mxArray*  array
+)
+{
+    switch (array->classid)
+    {
+        case mxCELL_CLASS: return "cell";
+        case mxSTRUCT_CLASS: return "struct";
+        case mxLOGICAL_CLASS: return "logical";
+        case mxCHAR_CLASS: return "char";
+        case mxDOUBLE_CLASS: return "double";
+        case mxSINGLE_CLASS: return "single";
+        case mxINT8_CLASS: return "int8";
+        case mxUINT8_CLASS: return "uint8";
+        case mxINT16_CLASS: return "int16";
+        case mxUINT16_CLASS: return "uint16";
+        case mxINT32_CLASS: return "int32";
+        case mxUINT32_CLASS: return "uint32";
+        case mxINT64_CLASS: return "int64";
+        case mxUINT64_CLASS: return "uint64";
+        case mxOBJECT_CLASS: return array->classname.c_str();
+        default: return "unknown";
+    }
+}
+
+bool mxIsClass(
+    const mxArray*  array,
+    const char*     name
+)
+{
+    return array && !strcmp(mxGetClassName(array), name);
+}
+
+bool mxIsNumeric(
+    const mxArray*  array
+)
+{
+    return array && array->elsize > 0 && array->classid != mxLOGICAL_CLASS &&
+        array->classid != mxCHAR_CLASS;
+}
+
+bool mxIsDouble(const mxArray* array) { return array && array->classid == mxDOUBLE_CLASS; }
+bool mxIsLogical(const mxArray* array) { return array && array->classid == mxLOGICAL_CLASS; }
+bool mxIsChar(const mxArray* array) { return array && array->classid == mxCHAR_CLASS; }
+bool mxIsCell(const mxArray* array) { return array && array->classid == mxCELL_CLASS; }
+bool mxIsStruct(const mxArray* array) { return array && array->classid == mxSTRUCT_CLASS; }
+bool mxIsSparse(const mxArray* array) { return array && array->sparse; }
+bool mxIsUint8(const mxArray* array) { return array && array->classid == mxUINT8_CLASS; }
+bool mxIsInt32(const mxArray* array) { return array && array->classid == mxINT32_CLASS; }
+bool mxIsUint64(const mxArray* array) { return array && array->classid == mxUINT64_CLASS; }
+
+size_t mxGetM(
+    const mxArray*  array
+)
+{
+    return array->dims[0];
+}
+
+size_t mxGetN(
+    const mxArray*  array
+)
+{
+    size_t n = 1;
+    for (size_t i = 1; i < array->dims.size(); i++)
+        n *= array->dims[i];
+    return n;
+}
+
+void mxSetM(
+    mxArray*        array,
+    size_t          m
+)
+{
+    /* like Matlab, the data buffer is not reallocated */
+    array->dims[0] = m;
+}
+
+size_t mxGetNumberOfDimensions(
+    const mxArray*  array
+)
+{
+    return array->dims.size();
+}
+
+const size_t* mxGetDimensions(
+    const mxArray*  array
+)
+{
+    return array->dims.data();
+}
+
+size_t mxGetNumberOfElements(
+    const mxArray*  array
+)
+{
+    return numel(array);
+}
+
+size_t mxGetElementSize(
+    const mxArray*  array
+)
+{
+    /* Matlab reports pointer size for cell and struct arrays */
+    if (array->classid == mxCELL_CLASS || array->classid == mxSTRUCT_CLASS)
+        return sizeof(mxArray*);
+    return array->elsize;
+}
+
+size_t mxCalcSingleSubscript(
+    const mxArray*  array,
+    size_t          nsubs,
+    const size_t*   subs
+)
+{
+    size_t idx = 0, stride = 1;
+    for (size_t i = 0; i < nsubs && i < array->dims.size(); i++)
+    {
+        idx += subs[i] * stride;
+        stride *= array->dims[i];
+    }
+    return idx;
+}
+
+void* mxGetData(
+    const mxArray*  array
+)
+{
+    return array->data;
+}
+
+double* mxGetPr(
+    const mxArray*  array
+)
+{
+    check_class(array, mxDOUBLE_CLASS, "mxGetPr");
+    return (double*) array->data;
+}
+
+mxDouble* mxGetDoubles(
+    const mxArray*  array
+)
+{
+    check_class(array, mxDOUBLE_CLASS, "mxGetDoubles");
+    return (mxDouble*) array->data;
+}
+
+mxLogical* mxGetLogicals(
+    const mxArray*  array
+)
+{
+    check_class(array, mxLOGICAL_CLASS, "mxGetLogicals");
+    return (mxLogical*) array->data;
+}
+
+mxUint8* mxGetUint8s(
+    const mxArray*  array
+)
+{
+    check_class(array, mxUINT8_CLASS, "mxGetUint8s");
+    return (mxUint8*) array->data;
+}
+
+mxInt32* mxGetInt32s(
+    const mxArray*  array
+)
+{
+    check_class(array, mxINT32_CLASS, "mxGetInt32s");
+    return (mxInt32*) array->data;
+}
+
+mxUint64* mxGetUint64s(
+    const mxArray*  array
+)
+{
+    check_class(array, mxUINT64_CLASS, "mxGetUint64s");
+    return (mxUint64*) array->data;
+}
+
+double mxGetScalar(
+    const mxArray*  array
+)
+{
+    if (!array->data || (array->sparse ? array->jc[array->dims[1]] == 0 : numel(array) == 0))
+        return 0.0;
+    if (array->classid == mxCHAR_CLASS)
+        return ((char*) array->data)[0];
+    return to_double(array, 0);
+}
+
+int mxGetString(
+    const mxArray*  array,
+    char*           buf,
+    size_t          buflen
+)
+{
+    size_t n;
+
+    if (!mxIsChar(array) || buflen == 0)
+        return 1;
+    n = numel(array);
+    if (n > buflen - 1)
+    {
+        memcpy(buf, array->data, buflen - 1);
+        buf[buflen - 1] = '\0';
+        return 1;
+    }
+    memcpy(buf, array->data, n);
+    buf[n] = '\0';
+    return 0;
+}
+
+mwIndex* mxGetIr(
+    const mxArray*  array
+)
+{
+    return array->ir;
+}
+
+mwIndex* mxGetJc(
+    const mxArray*  array
+)
+{
+    return array->jc;
+}
+
+size_t mxGetNzmax(
+    const mxArray*  array
+)
+{
+    return array->nzmax;
+}
+
+void mxSetNzmax(
+    mxArray*        array,
+    size_t          nzmax
+)
+{
+    if (!array->sparse)
+        return;
+    nzmax = nzmax > 0 ? nzmax : 1;
+    array->data = realloc(array->data, nzmax * array->elsize);
+    array->ir = (mwIndex*) realloc(array->ir, nzmax * sizeof(mwIndex));
+    array->nzmax = nzmax;
+}
+
+mxArray* mxGetCell(
+    const mxArray*  array,
+    size_t          idx
+)
+{
+    check_class(array, mxCELL_CLASS, "mxGetCell");
+    return array->values[0][idx];
+}
+
+void mxSetCell(
+    mxArray*        array,
+    size_t          idx,
+    mxArray*        value
+)
+{
+    check_class(array, mxCELL_CLASS, "mxSetCell");
+    array->values[0][idx] = value;
+}
+
+int mxGetNumberOfFields(
+    const mxArray*  array
+)
+{
+    return has_fields(array) ? (int) array->fields.size() : 0;
+}
+
+const char* mxGetFieldNameByNumber(
+    const mxArray*  array,
+    int             fieldnum
+)
+{
+    if (!has_fields(array) || fieldnum < 0 || fieldnum >= (int) array->fields.size())
+        return NULL;
+    return array->fields[fieldnum].c_str();
+}
+
+int mxGetFieldNumber(
+    const mxArray*  array,
+    const char*     fieldname
+)
+{
+    if (!has_fields(array))
+        return -1;
+    for (size_t i = 0; i < array->fields.size(); i++)
+        if (array->fields[i] == fieldname)
+            return (int) i;
+    return -1;
+}
+
+int mxAddField(
+    mxArray*        array,
+    const char*     fieldname
+)
+{
+    int fieldnum;
+
+    if (!has_fields(array))
+        return -1;
+    fieldnum = mxGetFieldNumber(array, fieldname);
+    if (fieldnum >= 0)
+        return fieldnum;
+    array->fields.push_back(fieldname);
+    array->values.push_back(std::vector<mxArray*>(numel(array), NULL));
+    return (int) array->fields.size() - 1;
+}
+
+void mxRemoveField(
+    mxArray*        array,
+    int             fieldnum
+)
+{
+    /* like Matlab, the field values are not freed */
+    if (!has_fields(array) || fieldnum < 0 || fieldnum >= (int) array->fields.size())
+        return;
+    array->fields.erase(array->fields.begin() + fieldnum);
+    array->values.erase(array->values.begin() + fieldnum);
+}
+
+mxArray* mxGetField(
+    const mxArray*  array,
+    size_t          idx,
+    const char*     fieldname
+)
+{
+    return mxGetFieldByNumber(array, idx, mxGetFieldNumber(array, fieldname));
+}
+
+mxArray* mxGetFieldByNumber(
+    const mxArray*  array,
+    size_t          idx,
+    int             fieldnum
+)
+{
+    if (!has_fields(array) || fieldnum < 0 || fieldnum >= (int) array->fields.size() ||
+        idx >= numel(array))
+        return NULL;
+    return array->values[fieldnum][idx];
+}
+
+void mxSetField(
+    mxArray*        array,
+    size_t          idx,
+    const char*     fieldname,
+    mxArray*        value
+)
+{
+    mxSetFieldByNumber(array, idx, mxGetFieldNumber(array, fieldname), value);
+}
+
+void mxSetFieldByNumber(
+    mxArray*        array,
+    size_t          idx,
+    int             fieldnum,
+    mxArray*        value
+)
+{
+    if (!has_fields(array) || fieldnum < 0 || fieldnum >= (int) array->fields.size() ||
+        idx >= numel(array))
+        mexErrMsgIdAndTxt("gams:transfer:shim:field", "mxSetFieldByNumber: Invalid field.");
+    array->values[fieldnum][idx] = value;
+}
+
+mxArray* mxGetProperty(
+    const mxArray*  array,
+    size_t          idx,
+    const char*     propname
+)
+{
+    /* like Matlab, a copy of the property value is returned (handles refer to the same object) */
+    mxArray* value = NULL;
+
+    if (!array || array->classid != mxOBJECT_CLASS)
+        return NULL;
+    value = mxGetField(array, idx, propname);
+    if (!value)
+        return NULL;
+    if (value->classid == mxOBJECT_CLASS && value->is_handle)
+        return value;
+    return mxDuplicateArray(value);
+}
+
+double mxGetInf(void)
+{
+    return INFINITY;
+}
+
+double mxGetNaN(void)
+{
+    return NAN;
+}
+
+bool mxIsInf(
+    double          value
+)
+{
+    return isinf(value);
+}
+
+bool mxIsNaN(
+    double          value
+)
+{
+    return isnan(value);
+}
+
+mxArray* gt_shim_create_object(
+    const char*     classname,
+    bool            is_handle
+)
+{
+    size_t dims[2] = {1, 1};
+    mxArray* array = create_array(mxOBJECT_CLASS, 2, dims);
+    array->classname = classname;
+    array->is_handle = is_handle;
+    return array;
+}
+
+void gt_shim_register_function(
+    const char*     name,
+    gt_shim_function_t func
+)
+{
+    g_functions[name] = func;
+}
+
+bool gt_shim_call(
+    gt_shim_mex_t   func,
+    int             nlhs,
+    mxArray*        plhs[],
+    int             nrhs,
+    const mxArray*  prhs[]
+)
+{
+    /* volatile: modified between setjmp and longjmp */
+    volatile bool success = true;
+
+    if (g_in_call)
+        mexErrMsgIdAndTxt("gams:transfer:shim:call", "Nested MEX calls are not supported.");
+
+    for (int i = 0; i < nlhs; i++)
+        plhs[i] = NULL;
+    g_last_error[0] = '\0';
+    g_in_call = true;
+
+    if (setjmp(g_jmp) == 0)
+        func(nlhs, plhs, nrhs, prhs);
+    else
+        success = false;
+
+    /* keep outputs, free temporaries (like Matlab does after a MEX call) */
+    if (success)
+        for (int i = 0; i < nlhs; i++)
+            keep_array(plhs[i]);
+    else
+        for (int i = 0; i < nlhs; i++)
+            plhs[i] = NULL;
+    for (mxArray* array : g_call_arrays)
+    {
+        free(array->data);
+        free(array->ir);
+        free(array->jc);
+        delete array;
+    }
+    g_call_arrays.clear();
+    for (void* ptr : g_call_memory)
+        free(ptr);
+    g_call_memory.clear();
+    g_in_call = false;
+
+    return success;
+}
+
+const char* gt_shim_last_error(void)
+{
+    return g_last_error;
+}
+
+void gt_shim_set_warnings(
+    bool            enable
+)
+{
+    g_warnings = enable;
+}
+
+}
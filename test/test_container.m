@@ -31,6 +31,7 @@ function success = test_container(cfg)
     test_describePartial(t, cfg, 'c');
     test_idx_describe(t, cfg, 'c');
     test_remove(t, cfg);
+    test_manySymbols(t, cfg);
     [~, n_fails1] = t.summary();
 
     t = GAMSTest('container_rc');
@@ -1867,3 +1868,59 @@ function test_remove(t, cfg)
     t.assert(x1.modified);
 
 end
+
+function test_manySymbols(t, cfg)
+
+    n = 1000;
+    names = cell(1, n);
+    gdx = gams.transfer.Container();
+    for i = 1:n
+        names{i} = sprintf('P%d', i);
+        gams.transfer.Parameter(gdx, names{i});
+    end
+
+    t.add('many_symbols_lookup');
+    t.assert(numel(fieldnames(gdx.data)) == n);
+    t.assert(all(gdx.hasSymbols(lower(names))));
+    t.assert(~any(gdx.hasSymbols({'p0', 'p1001'})));
+    t.assertEquals(gdx.getSymbolNames({'p10', 'p5'}), {'P10', 'P5'});
+    symbols = gdx.getSymbols({'p1000'; 'p1'});
+    t.assert(iscell(symbols));
+    t.assertEquals(size(symbols), [2, 1]);
+    t.assertEquals(symbols{1}.name, 'P1000');
+    t.assertEquals(symbols{2}.name, 'P1');
+
+    t.add('many_symbols_remove');
+    gdx.removeSymbols(lower(names(1:2:end)));
+    gdx.removeSymbols(names(2:4:end));
+    fields = fieldnames(gdx.data);
+    t.assert(numel(fields) == n / 4);
+    t.assertEquals(fields{1}, 'P4');
+    t.assertEquals(fields{2}, 'P8');
+    t.assertEquals(fields{end}, 'P1000');
+    t.assert(~gdx.hasSymbols('p2'));
+    t.assert(gdx.hasSymbols('p4'));
+    gams.transfer.Parameter(gdx, 'P1');
+    fields = fieldnames(gdx.data);
+    t.assertEquals(fields{end}, 'P1');
+
+    t.add('many_symbols_rename');
+    gdx.renameSymbol('p8', 'Q8');
+    fields = fieldnames(gdx.data);
+    t.assertEquals(fields{2}, 'Q8');
+    t.assert(~gdx.hasSymbols('p8'));
+    t.assertEquals(gdx.getSymbolNames('q8'), 'Q8');
+    t.assertEquals(gdx.getSymbols('q8').name, 'Q8');
+
+    t.add('many_symbols_remove_single');
+    for i = 12:8:200
+        gdx.removeSymbols(sprintf('P%d', i));
+    end
+    gams.transfer.Parameter(gdx, 'P2');
+    fields = fieldnames(gdx.data);
+    t.assertEquals(fields{3}, 'P16');
+    t.assertEquals(fields{end}, 'P2');
+    t.assert(~gdx.hasSymbols('p12'));
+    t.assertEquals(gdx.getSymbolNames({'p2', 'p16'}), {'P2', 'P16'});
+    t.assertEquals(gdx.getSymbols('p2').name, 'P2');
+end
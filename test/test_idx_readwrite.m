@@ -32,6 +32,7 @@ function success = test_idx_readwrite(cfg)
     test_idx_readWrite(t, cfg);
     test_idx_readWritePartial(t, cfg);
     test_idx_writeEpsToZero(t, cfg);
+    test_idx_readWriteMatrix(t, cfg);
     [~, n_fails1] = t.summary();
 
     t = GAMSTest('idx_readwrite_rc');
@@ -585,3 +586,52 @@ function test_idx_writeEpsToZero(t, cfg)
     % t.assert(gams.transfer.SpecialValues.isEps(gdx.data.p.records.value)); % see special values test above
 
 end
+
+function test_idx_readWriteMatrix(t, cfg)
+
+    write_filename = fullfile(cfg.working_dir, 'write.gdx');
+
+    na = gams.transfer.SpecialValues.NA;
+    a = [1 0 3; 0 0 6; 7 na Inf; 0 -Inf 12];
+    b = sparse([1 0 0; 0 2 0; 0 0 Inf; 4 0 0]);
+    c = reshape(1:24, [2,3,4]);
+    c(2,2,2) = 0;
+    d = sparse([0; 2; 0; 0; 5]);
+
+    gdx = gams.transfer.Container();
+    gams.transfer.Parameter(gdx, 'a', [4,3], 'records', a);
+    gams.transfer.Parameter(gdx, 'b', [4,3], 'records', b);
+    gams.transfer.Parameter(gdx, 'c', [2,3,4], 'records', c);
+    gams.transfer.Parameter(gdx, 'd', 5, 'records', d);
+    gdx.write(write_filename, 'indexed', true);
+
+    t.add('idx_read_write_matrix_struct');
+    gdx = gams.transfer.Container();
+    gdx.read(write_filename, 'format', 'struct', 'indexed', true);
+    t.assert(gdx.data.a.getNumberRecords() == 8);
+    t.assert(gdx.data.b.getNumberRecords() == 4);
+    t.assert(gdx.data.c.getNumberRecords() == 23);
+    t.assert(gdx.data.d.getNumberRecords() == 2);
+    t.assert(isequal(gdx.data.b.records.dim_1, uint64([1; 2; 3; 4])));
+    t.assert(isequal(gdx.data.b.records.dim_2, uint64([1; 2; 3; 1])));
+    t.assert(isequal(gdx.data.b.records.value, [1; 2; Inf; 4]));
+
+    t.add('idx_read_write_matrix_dense');
+    gdx = gams.transfer.Container();
+    gdx.read(write_filename, 'format', 'dense_matrix', 'indexed', true);
+    t.assert(isequaln(gdx.data.a.records.value, a));
+    t.assert(gams.transfer.SpecialValues.isNA(gdx.data.a.records.value(3,2)));
+    t.assert(isequal(gdx.data.b.records.value, full(b)));
+    t.assert(isequal(gdx.data.c.records.value, c));
+    t.assert(isequal(gdx.data.d.records.value, full(d)));
+
+    t.add('idx_read_write_matrix_sparse');
+    gdx = gams.transfer.Container();
+    gdx.read(write_filename, 'symbols', {'b', 'd'}, 'format', 'sparse_matrix', 'indexed', true);
+    t.assert(issparse(gdx.data.b.records.value));
+    t.assert(issparse(gdx.data.d.records.value));
+    t.assert(isequal(gdx.data.b.records.value, b));
+    t.assert(isequal(gdx.data.d.records.value, d));
+    t.assert(nnz(gdx.data.b.records.value) == 4);
+    t.assert(nnz(gdx.data.d.records.value) == 2);
+end
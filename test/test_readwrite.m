@@ -36,6 +36,12 @@ function success = test_readwrite(cfg)
     test_readWrite(t, cfg);
     test_readWritePartial(t, cfg);
     test_readWriteCompress(t, cfg);
+    test_readWriteSource(t, cfg);
+    test_readWriteProfile(t, cfg);
+    test_readCache(t, cfg);
+    test_readSession(t, cfg);
+    test_readRefresh(t, cfg);
+    test_readDiff(t, cfg);
     test_readWriteDomainCheck(t, cfg);
     test_writeEpsToZero(t, cfg);
     test_writeSparse(t, cfg);
@@ -885,6 +891,78 @@ function test_read(t, cfg, container_type)
     t.assertEquals(uels{3}, 'j7');
     t.assertEquals(uels{4}, 'j8');
     t.assertEquals(uels{5}, 'j9');
+
+    switch container_type
+    case 'c'
+        gdx = gams.transfer.Container();
+        gdx.read(cfg.filenames{1}, 'format', 'sparse_tensor');
+    case 'rc'
+        gdx = gams.transfer.Container();
+        gdx.read(cfg.filenames{1}, 'format', 'sparse_tensor');
+        gdx = gams.transfer.Container(gdx);
+    end
+
+    t.add('read_set_records_sparse_tensor');
+    s = gdx.data.i;
+    t.assert(isstruct(s.records));
+    t.assert(strcmp(s.format, 'struct'));
+    t.assert(s.isValid());
+
+    t.add('read_scalar_records_sparse_tensor');
+    s = gdx.data.a;
+    t.assert(isstruct(s.records));
+    t.assert(strcmp(s.format, 'sparse_tensor'));
+    t.assert(s.isValid());
+    t.assert(numel(fieldnames(s.records)) == 3);
+    t.assert(isa(s.records.index, 'uint64'));
+    t.assert(isequal(s.records.index, uint64(1)));
+    t.assert(isequal(s.records.shape, [1 1]));
+    t.assert(isequal(s.records.value, 4));
+
+    t.add('read_parameter_records_sparse_tensor');
+    s = gdx.data.b;
+    t.assert(isstruct(s.records));
+    t.assert(strcmp(s.format, 'sparse_tensor'));
+    t.assert(s.isValid());
+    t.assert(numel(fieldnames(s.records)) == 3);
+    t.assert(isequal(s.records.index, uint64([1; 2; 5])));
+    t.assert(isequal(s.records.shape, [5 1]));
+    t.assert(isequal(s.records.value, [1; 3; 10]));
+    t.assert(s.getNumberRecords() == 3);
+    uels = s.getUELs(1);
+    t.assert(numel(uels) == 5);
+    t.assertEquals(uels{1}, 'i1');
+    t.assertEquals(uels{5}, 'i10');
+
+    t.add('read_variable_records_sparse_tensor');
+    s = gdx.data.x;
+    t.assert(isstruct(s.records));
+    t.assert(strcmp(s.format, 'sparse_tensor'));
+    t.assert(s.isValid());
+    t.assert(numel(fieldnames(s.records)) == 7);
+    t.assert(isequal(s.records.index, uint64([1; 17; 22; 9; 14; 15])));
+    t.assert(isequal(s.records.shape, [5 5]));
+    t.assert(isequal(s.records.level, [2; 0; 9; 0; 0; 7]));
+    t.assert(isequal(s.records.marginal, [0; 8; 0; 5; 0; 0]));
+    t.assert(isequal(s.records.upper, [Inf; Inf; Inf; Inf; 30; Inf]));
+    uels = s.getUELs(2);
+    t.assert(numel(uels) == 5);
+    t.assertEquals(uels{1}, 'j2');
+    t.assertEquals(uels{5}, 'j9');
+
+    t.add('read_variable_records_sparse_tensor_transform');
+    s.transformRecords('dense_matrix');
+    t.assert(s.isValid());
+    t.assert(s.records.level(1,1) == 2);
+    t.assert(s.records.marginal(2,4) == 8);
+    t.assert(s.records.upper(4,3) == 30);
+    s.transformRecords('sparse_tensor');
+    t.assert(s.isValid());
+    t.assert(isequal(sort(s.records.index), uint64([1; 9; 14; 15; 17; 22])));
+    s.transformRecords('struct');
+    t.assert(s.isValid());
+    t.assert(s.getNumberRecords() == 6);
+    t.assert(isequal(s.records.level, [2; 0; 9; 0; 0; 7]));
 end
 
 function test_readEquals(t, cfg, container_type)
@@ -1520,6 +1598,26 @@ function test_readWrite(t, cfg)
             t.testGdxDiff(cfg.filenames{i}, write_filename);
             t.assert(system(sprintf('gdxdump %s -v | grep -q "Compression.*1"', write_filename)));
         end
+
+        t.add(sprintf('read_write_sparse_tensor_%d', i));
+        gdx = gams.transfer.Container();
+        gdx.read(cfg.filenames{i}, 'format', 'sparse_tensor');
+        gdx.write(write_filename);
+        t.testGdxDiff(cfg.filenames{i}, write_filename);
+        t.assert(system(sprintf('gdxdump %s -v | grep -q "Compression.*1"', write_filename)));
+    end
+
+    t.add('read_write_sparse_tensor_sorted');
+    gdx = gams.transfer.Container();
+    gdx.read(cfg.filenames{1}, 'format', 'sparse_tensor');
+    gdx.write(write_filename, 'sorted', true);
+    t.testGdxDiff(cfg.filenames{1}, write_filename);
+    gdx.data.x.records.index = flipud(gdx.data.x.records.index);
+    try
+        t.assert(false);
+        gdx.write(write_filename, 'sorted', true);
+    catch
+        t.reset();
     end
 end
 
@@ -1613,6 +1711,373 @@ function test_readWriteCompress(t, cfg)
         gdx.write(write_filename, 'compress', true);
         t.testGdxDiff(cfg.filenames{i}, write_filename);
         t.assert(~system(sprintf('gdxdump %s -v | grep -q "Compression.*1"', write_filename)));
+
+        t.add(sprintf('read_write_compress_threshold_%d', i));
+        gdx = gams.transfer.Container(cfg.filenames{i});
+        gdx.write(write_filename, 'compress', false);
+        info = dir(write_filename);
+        bytes_uncompressed = info.bytes;
+        gdx.write(write_filename, 'compress', true);
+        info = dir(write_filename);
+        bytes_compressed = info.bytes;
+        t.assert(bytes_compressed ~= bytes_uncompressed);
+        gdx.write(write_filename, 'compress', true, 'compress_threshold', 1);
+        t.testGdxDiff(cfg.filenames{i}, write_filename);
+        info = dir(write_filename);
+        t.assertEquals(info.bytes, bytes_compressed);
+        gdx.write(write_filename, 'compress', true, 'compress_threshold', 1e9);
+        t.testGdxDiff(cfg.filenames{i}, write_filename);
+        info = dir(write_filename);
+        t.assertEquals(info.bytes, bytes_uncompressed);
+
+        t.add(sprintf('read_write_compress_threshold_source_%d', i));
+        gdx = gams.transfer.Container();
+        gdx.read(cfg.filenames{i}, 'records', false);
+        gdx.modified = false;
+        gdx.write(write_filename, 'compress', true, 'compress_threshold', 1, 'source', cfg.filenames{i});
+        t.testGdxDiff(cfg.filenames{i}, write_filename);
+        t.assert(~system(sprintf('gdxdump %s -v | grep -q "Compression.*1"', write_filename)));
+    end
+end
+
+function test_readWriteSource(t, cfg)
+
+    write_filename = fullfile(cfg.working_dir, 'write.gdx');
+
+    for i = [1,2,5,7,9,10]
+        t.add(sprintf('read_write_source_%d', i));
+        gdx = gams.transfer.Container(cfg.filenames{i});
+        gdx.modified = false;
+        gdx.write(write_filename, 'source', cfg.filenames{i});
+        t.testGdxDiff(cfg.filenames{i}, write_filename);
+
+        t.add(sprintf('read_write_source_no_records_%d', i));
+        gdx = gams.transfer.Container();
+        gdx.read(cfg.filenames{i}, 'records', false);
+        gdx.modified = false;
+        gdx.write(write_filename, 'source', cfg.filenames{i});
+        t.testGdxDiff(cfg.filenames{i}, write_filename);
+
+        t.add(sprintf('read_write_source_priority_%d', i));
+        gdx = gams.transfer.Container(cfg.filenames{i});
+        gdx.modified = false;
+        gdx.write(write_filename, 'source', cfg.filenames{i}, 'uel_priority', {'new_uel'});
+        t.testGdxDiff(cfg.filenames{i}, write_filename);
+    end
+
+    t.add('read_write_source_modified');
+    gdx = gams.transfer.Container(cfg.filenames{1});
+    gdx.modified = false;
+    gdx.data.b.records.value(1) = 42;
+    t.assert(gdx.data.b.modified);
+    t.assert(~gdx.data.x.modified);
+    gdx.write(write_filename, 'source', cfg.filenames{1});
+    gdx2 = gams.transfer.Container(write_filename);
+    t.assert(gdx2.data.b.records.value(1) == 42);
+    t.assert(gdx2.data.x.equals(gdx.data.x));
+
+    t.add('read_write_source_eps_to_zero');
+    source_filename = fullfile(cfg.working_dir, 'source.gdx');
+    gdx = gams.transfer.Container();
+    gams.transfer.Parameter(gdx, 'p', {'*'}, 'records', ...
+        {{'a', 'b'}, [gams.transfer.SpecialValues.EPS, 1]});
+    gdx.write(source_filename, 'eps_to_zero', false);
+    gdx = gams.transfer.Container(source_filename);
+    t.assert(gams.transfer.SpecialValues.isEps(gdx.data.p.records.value(1)));
+    gdx.modified = false;
+    gdx.write(write_filename, 'source', source_filename);
+    gdx2 = gams.transfer.Container(write_filename);
+    t.assert(gdx2.data.p.records.value(1) == 0);
+    t.assert(~gams.transfer.SpecialValues.isEps(gdx2.data.p.records.value(1)));
+    gdx.write(write_filename, 'source', source_filename, 'eps_to_zero', false);
+    gdx2 = gams.transfer.Container(write_filename);
+    t.assert(gams.transfer.SpecialValues.isEps(gdx2.data.p.records.value(1)));
+
+    t.add('read_write_source_errors');
+    try
+        t.assert(false);
+        gdx.write(cfg.filenames{1}, 'source', cfg.filenames{1});
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Source GDX must differ from GDX file to write to.');
+    end
+    try
+        t.assert(false);
+        gdx.write(write_filename, 'source', cfg.filenames{1}, 'indexed', true);
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Source GDX not supported for indexed GDX.');
+    end
+
+end
+
+function test_readWriteProfile(t, cfg)
+
+    write_filename = fullfile(cfg.working_dir, 'write.gdx');
+    phases = {'symbol', 'domain', 'records', 'uels', 'text', 'categorical', 'table', 'total'};
+
+    t.add('read_profile');
+    gdx = gams.transfer.Container();
+    profile = gdx.read(cfg.filenames{1}, 'format', 'struct', 'profile', true);
+    t.assert(isstruct(profile));
+    t.assert(isfield(profile, 'i'));
+    t.assert(isfield(profile, 'x'));
+    symbols = fieldnames(profile);
+    for i = 1:numel(symbols)
+        t.assert(isfield(gdx.data, symbols{i}));
+        t.assert(all(isfield(profile.(symbols{i}).time, [phases, {'objects'}])));
+        t.assert(isfield(profile.(symbols{i}), 'number_callbacks'));
+    end
+    t.assert(profile.i.number_records == 5);
+    t.assert(profile.x.number_records == 6);
+    t.assert(profile.x.number_uels > 0);
+    t.assert(profile.x.bytes > 0);
+    t.assert(profile.x.time.total >= profile.x.time.records);
+
+    t.add('read_profile_disabled');
+    gdx = gams.transfer.Container();
+    profile = gdx.read(cfg.filenames{1}, 'format', 'struct');
+    t.assert(isempty(fieldnames(profile)));
+
+    t.add('write_profile');
+    profile = gdx.write(write_filename, 'profile', true);
+    t.testGdxDiff(cfg.filenames{1}, write_filename);
+    t.assert(isfield(profile, 'i'));
+    t.assert(isfield(profile, 'x'));
+    t.assert(all(isfield(profile.x.time, phases)));
+    t.assert(profile.x.number_records == 6);
+    t.assert(profile.x.number_uels > 0);
+    t.assert(profile.x.bytes > 0);
+end
+
+function test_readCache(t, cfg)
+
+    cache_filename = fullfile(cfg.working_dir, 'cache.gdx');
+    snapshot_filename = [cache_filename, '.snapshot'];
+    copyfile(cfg.filenames{1}, cache_filename);
+    if exist(snapshot_filename, 'file')
+        delete(snapshot_filename);
+    end
+
+    formats = {'struct', 'table', 'dense_matrix', 'sparse_matrix'};
+    for i = 1:numel(formats)
+        t.add(sprintf('read_cache_%s', formats{i}));
+        gdx1 = gams.transfer.Container();
+        gdx1.read(cfg.filenames{1}, 'format', formats{i});
+        gdx2 = gams.transfer.Container();
+        gdx2.read(cache_filename, 'format', formats{i}, 'cache', true);
+        t.assert(exist(snapshot_filename, 'file') > 0);
+        gdx3 = gams.transfer.Container();
+        gdx3.read(cache_filename, 'format', formats{i}, 'cache', true);
+        t.assert(gdx1.equals(gdx2));
+        t.assert(gdx1.equals(gdx3));
+        t.assert(isequal(gdx1.listSymbols(), gdx3.listSymbols()));
+    end
+
+    t.add('read_cache_arguments');
+    gdx1 = gams.transfer.Container();
+    gdx1.read(cache_filename, 'symbols', {'x'}, 'format', 'struct', 'values', {'level'}, 'cache', true);
+    t.assert(isequal(gdx1.listSymbols(), {'x'}));
+    t.assert(isfield(gdx1.data.x.records, 'level'));
+    t.assert(~isfield(gdx1.data.x.records, 'marginal'));
+    gdx2 = gams.transfer.Container();
+    gdx2.read(cache_filename, 'cache', true);
+    t.assert(numel(gdx2.listSymbols()) > 1);
+
+    t.add('read_cache_modified');
+    gdx1 = gams.transfer.Container();
+    gdx1.read(cache_filename, 'cache', true);
+    copyfile(cfg.filenames{2}, cache_filename);
+    gdx2 = gams.transfer.Container();
+    gdx2.read(cfg.filenames{2});
+    gdx3 = gams.transfer.Container();
+    gdx3.read(cache_filename, 'cache', true);
+    t.assert(gdx2.equals(gdx3));
+
+    t.add('read_cache_verify');
+    gdx1 = gams.transfer.Container();
+    gdx1.read(cache_filename, 'cache', true, 'cache_verify', true);
+    t.assert(gdx2.equals(gdx1));
+    gdx1 = gams.transfer.Container();
+    gdx1.read(cache_filename, 'cache', true, 'cache_verify', true);
+    t.assert(gdx2.equals(gdx1));
+end
+
+function test_readSession(t, cfg)
+
+    t.add('read_session_all');
+    session = gams.transfer.GDXSession(cfg.filenames{1});
+    t.assert(session.isOpen());
+    t.assertEquals(session.filename, gams.transfer.utils.absolute_path(cfg.filenames{1}));
+    [filedir, filename, fileext] = fileparts(gams.transfer.utils.absolute_path(cfg.filenames{1}));
+    olddir = cd(filedir);
+    session_rel = gams.transfer.GDXSession([filename, fileext]);
+    cd(olddir);
+    t.assertEquals(session_rel.filename, fullfile(filedir, [filename, fileext]));
+    session_rel.close();
+    gdx1 = gams.transfer.Container(cfg.filenames{1});
+    gdx2 = gams.transfer.Container();
+    gdx2.read(session);
+    t.assert(gdx1.equals(gdx2));
+
+    t.add('read_session_symbols');
+    formats = {'struct', 'table', 'dense_matrix', 'sparse_matrix'};
+    symbols = gdx1.listSymbols();
+    for i = 1:numel(symbols)
+        for j = 1:numel(formats)
+            gdx1 = gams.transfer.Container();
+            gdx1.read(cfg.filenames{1}, 'symbols', symbols(i), 'format', formats{j});
+            gdx2 = gams.transfer.Container();
+            gdx2.read(session, 'symbols', symbols(i), 'format', formats{j});
+            t.assert(gdx1.equals(gdx2));
+        end
+    end
+
+    t.add('read_session_close');
+    session.close();
+    t.assert(~session.isOpen());
+    session.close();
+    try
+        t.assert(false);
+        gdx2.read(session);
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Argument ''source'' (at position 1) must be an open GDX session.');
+    end
+
+    t.add('read_session_delete');
+    session = gams.transfer.GDXSession(cfg.filenames{1});
+    gdx1 = gams.transfer.Container();
+    gdx1.read(session, 'symbols', {'x'});
+    clear session;
+    gdx2 = gams.transfer.Container();
+    gdx2.read(cfg.filenames{1}, 'symbols', {'x'});
+    t.assert(gdx1.equals(gdx2));
+end
+
+function test_readRefresh(t, cfg)
+
+    write_filename = fullfile(cfg.working_dir, 'write.gdx');
+    formats = {'struct', 'table', 'dense_matrix', 'sparse_matrix'};
+
+    t.add('read_refresh_values');
+    for i = 1:numel(formats)
+        gdx = gams.transfer.Container(cfg.filenames{1}, 'format', formats{i});
+        x = gdx.data.x;
+        records = x.records;
+        x.records.level = 2 * x.records.level;
+        gdx.read(cfg.filenames{1}, 'symbols', {'x'}, 'format', formats{i}, 'refresh', true);
+        t.assert(gdx.data.x == x);
+        t.assertEquals(x.records, records);
+        t.assert(gdx.data.x.domain{1} == gdx.data.i);
+        t.assert(gdx.data.x.isValid());
+        gdx2 = gams.transfer.Container(cfg.filenames{1}, 'format', formats{i});
+        t.assert(gdx.equals(gdx2));
+    end
+
+    t.add('read_refresh_records');
+    gdx = gams.transfer.Container(cfg.filenames{1}, 'format', 'table');
+    gdx.data.x.records = gdx.data.x.records(1:end-1,:);
+    gdx.write(write_filename);
+    gdx = gams.transfer.Container(cfg.filenames{1}, 'format', 'table');
+    x = gdx.data.x;
+    gdx.read(write_filename, 'symbols', {'x'}, 'format', 'table', 'refresh', true);
+    t.assert(gdx.data.x == x);
+    t.assertEquals(height(x.records), x.getNumberRecords());
+    gdx2 = gams.transfer.Container(write_filename, 'symbols', {'x'}, 'format', 'table');
+    t.assertEquals(x.records, gdx2.data.x.records);
+
+    t.add('read_refresh_new');
+    gdx = gams.transfer.Container(cfg.filenames{1}, 'symbols', {'i', 'j'});
+    gdx.read(cfg.filenames{1}, 'symbols', {'i', 'x'}, 'refresh', true);
+    t.assert(gdx.hasSymbols('x'));
+    t.assert(gdx.data.x.domain{1} == gdx.data.i);
+
+    t.add('read_refresh_mismatch');
+    gdx = gams.transfer.Container();
+    gams.transfer.Parameter(gdx, 'x');
+    try
+        t.assert(false);
+        gdx.read(cfg.filenames{1}, 'symbols', {'x'}, 'refresh', true);
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Symbol ''x'' cannot be refreshed: Symbol type or dimension differs.');
+    end
+end
+
+function test_readDiff(t, cfg)
+
+    write_filename = fullfile(cfg.working_dir, 'write.gdx');
+
+    t.add('read_diff_equal');
+    d = gams.transfer.GDXDiff(cfg.filenames{1}, cfg.filenames{1});
+    t.assert(d.isEqual());
+    t.assertEquals(d.first, gams.transfer.utils.absolute_path(cfg.filenames{1}));
+    t.assertEquals({d.summary.name}, {'i', 'j', 'a', 'b', 'x'});
+    t.assert(isempty(fieldnames(d.records)));
+    t.assertEquals(d.summary(5).symbol_type, 'variable');
+    t.assertEquals(d.summary(5).number_records, [6 6]);
+    t.assertEquals(d.summary(5).max_abs_diff, zeros(1, 5));
+
+    t.add('read_diff_values');
+    gdx = gams.transfer.Container(cfg.filenames{1}, 'format', 'struct');
+    level = gdx.data.x.records.level;
+    gdx.data.x.records.level = 2 * level;
+    gdx.write(write_filename);
+    d = gams.transfer.GDXDiff(cfg.filenames{1}, write_filename, 'symbols', {'x'});
+    t.assert(~d.isEqual());
+    t.assertEquals(numel(d.summary), 1);
+    t.assertEquals(d.summary.status, 'different');
+    t.assertEquals(d.summary.number_changed, sum(level ~= 0));
+    t.assertEquals(d.summary.max_abs_diff(1), max(abs(level)));
+    t.assertEquals(d.summary.max_rel_diff(1), 0.5);
+    t.assert(isfield(d.records, 'x'));
+    x = d.records.x;
+    if gams.transfer.Constants.SUPPORTS_TABLE
+        x = table2struct(x, 'ToScalar', true);
+    end
+    t.assertEquals(numel(x.level_first), sum(level ~= 0));
+    t.assertEquals(x.level_second, 2 * x.level_first);
+    t.assertEquals(x.marginal_first, x.marginal_second);
+    t.assert(all(strcmp(cellstr(x.change), 'changed')));
+    d = gams.transfer.GDXDiff(cfg.filenames{1}, write_filename, 'rtol', 0.5);
+    t.assert(d.isEqual());
+    d = gams.transfer.GDXDiff(cfg.filenames{1}, write_filename, 'rtol', struct('level', 0.4, 'marginal', 1));
+    t.assert(~d.isEqual());
+    d = gams.transfer.GDXDiff(cfg.filenames{1}, write_filename, 'atol', struct('level', max(abs(level))));
+    t.assert(d.isEqual());
+
+    t.add('read_diff_records');
+    gdx = gams.transfer.Container(cfg.filenames{1}, 'format', 'table');
+    gdx.data.x.records = gdx.data.x.records(1:end-1,:);
+    gdx.removeSymbols('b');
+    gdx.write(write_filename);
+    d = gams.transfer.GDXDiff(cfg.filenames{1}, write_filename);
+    t.assertEquals(d.summary(4).status, 'only_first');
+    t.assertEquals(d.summary(4).number_records(1), 1);
+    t.assert(isnan(d.summary(4).number_records(2)));
+    t.assertEquals(d.summary(5).status, 'different');
+    t.assertEquals(d.summary(5).number_only_first, 1);
+    t.assertEquals(d.summary(5).number_changed, 0);
+    d2 = gams.transfer.GDXDiff(write_filename, cfg.filenames{1});
+    t.assertEquals(d2.summary(4).name, 'x');
+    t.assertEquals(d2.summary(4).number_only_second, 1);
+    t.assertEquals(d2.summary(5).status, 'only_second');
+
+    t.add('read_diff_invalid');
+    try
+        t.assert(false);
+        gams.transfer.GDXDiff(cfg.filenames{1}, write_filename, 'atol', -1);
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Argument ''atol'' (at position 4) must be equal to or larger than 0.');
+    end
+    try
+        t.assert(false);
+        gams.transfer.GDXDiff(cfg.filenames{1}, write_filename, 'rtol', struct('text', 1));
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Argument ''rtol'' (at position 4) contains invalid value field ''text''. Must be subset of ''level'', ''value'', ''marginal'', ''lower'', ''upper'', ''scale''.');
     end
 end
 
@@ -1670,6 +2135,24 @@ function test_readWriteDomainCheck(t, cfg)
     gdx2 = gams.transfer.Container(write_filename);
     t.assertEquals(gdx2.data.x.domain_type, 'relaxed');
 
+    t.add('read_write_domain_check_relaxed_read');
+    gdx = gams.transfer.Container(cfg.filenames{1});
+    x = gdx.data.x;
+    x.domain{1} = 'i';
+    x.domain{2} = 'j';
+    gdx.write(write_filename);
+    formats = {'struct', 'table'};
+    for i = 1:numel(formats)
+        gdx2 = gams.transfer.Container(write_filename, 'format', formats{i});
+        t.assertEquals(gdx2.data.x.domain_type, 'relaxed');
+        t.assertEquals(gdx2.data.x.domain, {'i', 'j'});
+        t.assert(gdx2.data.x.isValid());
+        t.assertEquals(gdx2.data.x.getNumberRecords(), 6);
+        gdx2 = gams.transfer.Container(write_filename, 'symbols', {'x'}, 'format', formats{i});
+        t.assertEquals(gdx2.data.x.domain, {'i', 'j'});
+        t.assert(gdx2.data.x.isValid());
+    end
+
 end
 
 function test_writeEpsToZero(t, cfg)
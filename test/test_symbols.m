@@ -37,6 +37,7 @@ function success = test_symbols(cfg)
     test_transformRecords(t, cfg);
     test_dropRecords(t, cfg);
     test_duplicates(t, cfg);
+    test_valueStatistics(t, cfg);
     [~, n_fails] = t.summary();
     success = n_fails == 0;
 end
@@ -1725,6 +1726,28 @@ function test_copySymbol(t, cfg)
         t.assertEquals(ex.message, 'Symbol already exists in destination.');
     end
 
+    t.add('copy_symbol_copy_on_write');
+    q = gams.transfer.Parameter(gdx, 'q', {'k'}, 'records', {{'k1', 'k2'}, [1 2]});
+    gdx2 = gams.transfer.Container();
+    q.copy(gdx2);
+    gdx3 = gams.transfer.Container(gdx2);
+    q2 = gdx2.data.q;
+    q3 = gdx3.data.q;
+    q2.renameUELs(struct('k1', 'l1'));
+    q3.addUELs('k3');
+    q3.records.value(2) = 5;
+    t.assertEquals(reshape(q.getUELs(), 1, []), {'k1', 'k2'});
+    t.assertEquals(reshape(q2.getUELs(), 1, []), {'l1', 'k2'});
+    t.assertEquals(reshape(q3.getUELs(), 1, []), {'k1', 'k2', 'k3'});
+    t.assert(q.records.value(2) == 2);
+    t.assert(q2.records.value(2) == 2);
+    t.assert(q3.records.value(2) == 5);
+    q.removeUELs('k2');
+    t.assertEquals(reshape(q.getUELs(), 1, []), {'k1'});
+    t.assertEquals(reshape(q2.getUELs(), 1, []), {'l1', 'k2'});
+    t.assertEquals(reshape(q3.getUELs(), 1, []), {'k1', 'k2', 'k3'});
+    gdx.removeSymbols('q');
+
 end
 
 function test_defaultvalues(t, cfg)
@@ -2837,6 +2860,43 @@ function test_reorder(t, cfg)
         t.assertEquals(e.message, 'Circular domain set dependency in: [s1].');
     end
 
+    gdx = gams.transfer.Container();
+
+    s1 = gams.transfer.Set(gdx, 's1', 'records', {'i1', 'i2'});
+    s2 = gams.transfer.Set(gdx, 's2', 'records', {'i1', 'i2'});
+    s3 = gams.transfer.Set(gdx, 's3', 'records', {'i1', 'i2'});
+    s4 = gams.transfer.Set(gdx, 's4', 'records', {'i1', 'i2'});
+    s5 = gams.transfer.Set(gdx, 's5', 'records', {'i1', 'i2'});
+    a5 = gams.transfer.Alias(gdx, 'a5', s5);
+    s1.domain = {s2};
+    s2.domain = {s1};
+    s3.domain = {s1};
+    s4.domain = {s4};
+
+    t.add('reorder_6');
+    try
+        t.assert(false);
+        gdx.reorderSymbols();
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Circular domain set dependency in: [s1,s2,s4].');
+    end
+
+    s1.domain = {a5};
+    s2.domain = {s1};
+    s3.domain = {s2};
+    s4.domain = {s3};
+    gdx.reorderSymbols();
+
+    t.add('reorder_7');
+    fields = fieldnames(gdx.data);
+    t.assertEquals(fields{1}, 's5');
+    t.assertEquals(fields{2}, 'a5');
+    t.assertEquals(fields{3}, 's1');
+    t.assertEquals(fields{4}, 's2');
+    t.assertEquals(fields{5}, 's3');
+    t.assertEquals(fields{6}, 's4');
+
 end
 
 function test_transformRecords(t, cfg)
@@ -2928,6 +2988,31 @@ function test_transformRecords(t, cfg)
             t.assertEquals(gdx.data.x.records, x_recs{j});
         end
     end
+
+    t.add('transform_records_eps_duplicates');
+    gdx = gams.transfer.Container();
+    i = gams.transfer.Set(gdx, 'i', {'*'}, 'records', {'i1', 'i2', 'i3'});
+    p = gams.transfer.Parameter(gdx, 'p', {i, i}, 'records', {{'i1', 'i2', 'i3', 'i1'}, ...
+        {'i2', 'i1', 'i3', 'i2'}, [1, gams.transfer.SpecialValues.EPS, 0, 4]});
+    p.transformRecords('dense_matrix');
+    t.assertEquals(size(p.records.value), [3 3]);
+    t.assert(p.records.value(1,2) == 4);
+    t.assert(gams.transfer.SpecialValues.isEps(p.records.value(2,1)));
+    t.assert(p.records.value(3,3) == 0);
+    t.assert(nnz(p.records.value) == 1);
+    p.transformRecords('struct');
+    t.assert(p.getNumberRecords() == 2);
+    t.assert(p.records.value(1) == 4);
+    t.assert(gams.transfer.SpecialValues.isEps(p.records.value(2)));
+    p.transformRecords('sparse_matrix');
+    t.assert(issparse(p.records.value));
+    t.assert(p.records.value(1,2) == 4);
+    t.assert(p.records.value(3,3) == 0);
+    p.transformRecords('struct');
+    t.assert(p.getNumberRecords() == 2);
+    t.assert(p.records.value(1) == 4);
+    t.assert(gams.transfer.SpecialValues.isEps(p.records.value(2)));
+    t.assert(p.isValid());
 end
 
 function test_dropRecords(t, cfg)
@@ -3436,6 +3521,60 @@ function test_dropRecords(t, cfg)
         t.assert(v.records.scale(2,2) == 3);
 
     end
+
+    t.add('drop_records_tabular_multiple_columns');
+    gdx = gams.transfer.Container();
+    i = gams.transfer.Set(gdx, 'i', 'records', {'i1', 'i2', 'i3', 'i4', 'i5'});
+    v = gams.transfer.Variable(gdx, 'v', 'free', {i});
+    recs = struct();
+    recs.i = {'i1', 'i2', 'i3', 'i4', 'i5'};
+    recs.level = [1; gams.transfer.SpecialValues.NA; 3; 4; gams.transfer.SpecialValues.EPS];
+    recs.marginal = [gams.transfer.SpecialValues.UNDEF; 2; 3; gams.transfer.SpecialValues.EPS; 5];
+    v.setRecords(recs);
+    t.assert(v.getNumberRecords() == 5);
+    v.dropNA();
+    t.assert(v.getNumberRecords() == 4);
+    t.assert(gams.transfer.SpecialValues.isUndef(v.records.marginal(1)));
+    v.dropEps();
+    t.assert(v.getNumberRecords() == 2);
+    t.assert(v.records.level(1) == 1);
+    t.assert(v.records.level(2) == 3);
+    v.dropMissing();
+    t.assert(v.getNumberRecords() == 1);
+    t.assert(v.records.level(1) == 3);
+    t.assert(v.records.marginal(1) == 3);
+
+    t.add('drop_records_special_value_classes');
+    x = [0, 1, gams.transfer.SpecialValues.EPS, gams.transfer.SpecialValues.NA, ...
+        gams.transfer.SpecialValues.UNDEF, gams.transfer.SpecialValues.POSINF, ...
+        gams.transfer.SpecialValues.NEGINF];
+    t.assertEquals(gams.transfer.gdx.gt_sv_class(x), uint8([1, 0, 2, 3, 4, 5, 6]));
+    t.assertEquals(gams.transfer.SpecialValues.isEps(x), logical([0, 0, 1, 0, 0, 0, 0]));
+    t.assertEquals(gams.transfer.SpecialValues.isNA(x), logical([0, 0, 0, 1, 0, 0, 0]));
+    t.assertEquals(gams.transfer.SpecialValues.isUndef(x), logical([0, 0, 0, 0, 1, 0, 0]));
+    t.assert(issparse(gams.transfer.SpecialValues.isNA(sparse(x))));
+    t.assertEquals(full(gams.transfer.SpecialValues.isNA(sparse(x))), logical([0, 0, 0, 1, 0, 0, 0]));
+    try
+        t.assert(false);
+        gams.transfer.gdx.gt_sv_class({x}, {'missingX'});
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Argument 2 contains invalid class. Must be one of the following: normal, zero, eps, na, undef, missing, posinf, neginf.');
+    end
+    try
+        t.assert(false);
+        gams.transfer.gdx.gt_sv_class({sparse(x)}, {'zero'});
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Argument 2 must not contain class ''zero'' for sparse arrays.');
+    end
+    try
+        t.assert(false);
+        gams.transfer.gdx.gt_sv_class({sparse(x)}, {'na'}, 0);
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Argument 3 must not be 0 for sparse arrays.');
+    end
 end
 
 function test_duplicates(t, cfg)
@@ -3488,6 +3627,22 @@ function test_duplicates(t, cfg)
     t.assert(idx(1) == 1);
     t.assert(idx(2) == 3);
 
+    t.add('duplicates_find_3')
+    ri = mod((1:1000) * 7, 3) + 1;
+    rj = mod(floor((1:1000) / 3), 3) + 1;
+    i_labels = {'i1', 'i2', 'i3'};
+    j_labels = {'j1', 'j2', 'j3'};
+    d = gams.transfer.Parameter(gdx, 'd', {i, j}, 'records', {i_labels(ri), j_labels(rj), 1:1000});
+    d.transformRecords('struct');
+    [~, ia] = unique([ri(:), rj(:)], 'rows', 'first');
+    idx = d.findDuplicateRecords('keep', 'first');
+    t.assert(isequal(idx, setdiff(1:1000, ia)));
+    [~, ia] = unique([ri(:), rj(:)], 'rows', 'last');
+    idx = d.findDuplicateRecords('keep', 'last');
+    t.assert(isequal(idx, setdiff(1:1000, ia)));
+    t.assert(d.countDuplicateRecords() == 991);
+    gdx.removeSymbols('d');
+
     t.add('duplicates_drop_1')
     gdx_ = gams.transfer.Container(gdx);
     t.assert(gdx_.countDuplicateRecords() == 3);
@@ -3525,3 +3680,59 @@ function test_duplicates(t, cfg)
     end
 
 end
+
+function test_valueStatistics(t, cfg)
+
+    formats = {'struct', 'dense_matrix', 'sparse_matrix'};
+    for k = 1:numel(formats)
+        t.add(sprintf('value_statistics_%s', formats{k}));
+        gdx = gams.transfer.Container();
+        i = gams.transfer.Set(gdx, 'i', 'records', {'i1', 'i2', 'i3', 'i4', 'i5'});
+        p = gams.transfer.Parameter(gdx, 'p', {i}, 'records', {{'i1', 'i2', 'i3', 'i4', 'i5'}, ...
+            [1, gams.transfer.SpecialValues.EPS, gams.transfer.SpecialValues.NA, -inf, 7]});
+        p.transformRecords(formats{k});
+        [value, where] = p.getMaxValue();
+        t.assert(value == 7);
+        t.assertEquals(where, {'i5'});
+        [value, where] = p.getMinValue();
+        t.assert(value == -inf);
+        t.assertEquals(where, {'i4'});
+        [value, where] = p.getMaxAbsValue();
+        t.assert(value == inf);
+        t.assertEquals(where, {'i4'});
+        t.assert(isnan(p.getMeanValue()));
+        t.assert(p.countNA() == 1);
+        t.assert(p.countUndef() == 0);
+        t.assert(p.countEps() == 1);
+        t.assert(p.countPosInf() == 0);
+        t.assert(p.countNegInf() == 1);
+        tbl = gdx.describeParameters();
+        if gams.transfer.Constants.SUPPORTS_TABLE
+            t.assert(height(tbl) == 1);
+            t.assert(tbl{1,'max'} == 7);
+            t.assert(tbl{1,'min'} == -inf);
+            t.assert(isnan(tbl{1,'mean'}));
+            if gams.transfer.Constants.SUPPORTS_CATEGORICAL
+                t.assertEquals(tbl{1,'where_max'}, '[i5]');
+                t.assertEquals(tbl{1,'where_min'}, '[i4]');
+            else
+                t.assertEquals(tbl{1,'where_max'}{1}, '[i5]');
+                t.assertEquals(tbl{1,'where_min'}{1}, '[i4]');
+            end
+        else
+            t.assert(tbl.max(1) == 7);
+            t.assert(tbl.min(1) == -inf);
+            t.assert(isnan(tbl.mean(1)));
+        end
+    end
+
+    t.add('value_statistics_empty');
+    gdx = gams.transfer.Container();
+    i = gams.transfer.Set(gdx, 'i', 'records', {'i1', 'i2'});
+    p = gams.transfer.Parameter(gdx, 'p', {i});
+    [value, where] = p.getMaxValue();
+    t.assert(isnan(value));
+    t.assert(isempty(where));
+    t.assert(isnan(p.getMeanValue()));
+    t.assert(p.countEps() == 0);
+end
@@ -27,6 +27,7 @@ function success = test_uels(cfg)
     t = GAMSTest('uels');
     % test_uniqueelementlist(t, cfg); TODO
     test_symbol_uels(t, cfg);
+    test_ordered_label_set(t, cfg);
     [~, n_fails] = t.summary();
     success = n_fails == 0;
 end
@@ -1365,4 +1366,127 @@ function test_symbol_uels(t, cfg)
     t.assertEquals(uels{4}, 'j8');
     t.assertEquals(uels{5}, 'j9');
 
+    c = gams.transfer.Container();
+    c.read(cfg.filenames{1}, 'format', 'struct');
+    x = c.data.x;
+    i = c.data.i;
+
+    t.add('symbol_uels_lower_upper_5');
+    c.upperUELs();
+    uels = x.getUELs(1);
+    t.assert(numel(uels) == 4);
+    t.assertEquals(uels{1}, 'I1');
+    t.assertEquals(uels{4}, 'I10');
+    uels = i.getUELs(1);
+    t.assert(numel(uels) == 5);
+    t.assertEquals(uels{3}, 'I4');
+    c.lowerUELs('symbols', {'x'});
+    uels = x.getUELs();
+    t.assert(numel(uels) == 9);
+    t.assertEquals(uels{1}, 'i1');
+    t.assertEquals(uels{5}, 'j2');
+    uels = i.getUELs(1);
+    t.assertEquals(uels{1}, 'I1');
+    uels = c.getUELs();
+    t.assert(numel(uels) == 19);
+
+    c = gams.transfer.Container();
+    c.read(cfg.filenames{1}, 'format', 'struct');
+    x = c.data.x;
+    i = c.data.i;
+
+    t.add('symbol_uels_rename_6');
+    c.renameUELs(struct('i1', 'i2', 'i2', 'i3'), 'allow_merge', true);
+    uels = x.getUELs(1);
+    t.assert(numel(uels) == 3);
+    t.assertEquals(uels{1}, 'i3');
+    t.assertEquals(uels{2}, 'i6');
+    t.assertEquals(uels{3}, 'i10');
+    uels = i.getUELs(1);
+    t.assert(numel(uels) == 4);
+    t.assertEquals(uels{1}, 'i3');
+    t.assertEquals(uels{2}, 'i4');
+    c.removeUELs({'i4', 'j5', 'bla'});
+    uels = i.getUELs(1);
+    t.assert(numel(uels) == 3);
+    t.assertEquals(uels{2}, 'i6');
+    uels = x.getUELs(2);
+    t.assert(numel(uels) == 4);
+    t.assertEquals(uels{2}, 'j7');
+
+end
+
+function test_ordered_label_set(t, cfg)
+
+    u = gams.transfer.unique_labels.OrderedLabelSet({'a', 'b', 'c', 'b'});
+
+    t.add('ordered_label_set_add');
+    t.assert(u.count() == 3);
+    u.add({'d', 'a', 'e'});
+    labels = u.get();
+    t.assert(numel(labels) == 5);
+    t.assertEquals(labels{1}, 'a');
+    t.assertEquals(labels{2}, 'b');
+    t.assertEquals(labels{3}, 'c');
+    t.assertEquals(labels{4}, 'd');
+    t.assertEquals(labels{5}, 'e');
+
+    t.add('ordered_label_set_find');
+    [flag, idx] = u.find({'e', 'x', 'a'});
+    t.assert(isequal(flag, [true, false, true]));
+    t.assert(isequal(idx, [5, 0, 1]));
+    [flag, idx] = u.find({'c'; 'd'});
+    t.assert(isequal(flag, [true; true]));
+    t.assert(isequal(idx, [3; 4]));
+
+    t.add('ordered_label_set_remove');
+    [flag, idx] = u.remove({'b', 'x', 'd'});
+    t.assert(isequal(flag, [true, false, true, false, true]));
+    t.assert(isequal(idx, [1, 0, 2, 0, 3]));
+    labels = u.get();
+    t.assert(numel(labels) == 3);
+    t.assertEquals(labels{1}, 'a');
+    t.assertEquals(labels{2}, 'c');
+    t.assertEquals(labels{3}, 'e');
+
+    t.add('ordered_label_set_rename');
+    u.rename({'a', 'x'}, {'aa', 'y'});
+    labels = u.get();
+    t.assert(numel(labels) == 3);
+    t.assertEquals(labels{1}, 'aa');
+    t.assertEquals(labels{2}, 'c');
+    t.assertEquals(labels{3}, 'e');
+    try
+        t.assert(false);
+        u.rename({'aa'}, {'c'});
+    catch e
+        t.reset();
+        t.assertEquals(e.message, 'Unique label ''c'' already exists');
+    end
+    t.assert(u.count() == 3);
+
+    t.add('ordered_label_set_merge');
+    u.merge({'aa', 'c'}, {'e', 'f'});
+    labels = u.get();
+    t.assert(numel(labels) == 2);
+    t.assertEquals(labels{1}, 'f');
+    t.assertEquals(labels{2}, 'e');
+
+    t.add('ordered_label_set_copy');
+    u2 = u.copy();
+    u.clear();
+    t.assert(u.count() == 0);
+    t.assert(u2.count() == 2);
+    t.assert(isequal(u2.get(), {'f', 'e'}));
+
+    t.add('ordered_label_set_invalid_operation');
+    try
+        t.assert(false);
+        gams.transfer.gdx.gt_label_set('countXYZ');
+    catch e
+        t.reset();
+        t.assertEquals(e.message, ['Argument 1 must be one of the following: create, copy, share, ', ...
+            'unshare, delete, count, get, clear, add, set, find, remove, rename, merge.']);
+    end
+
 end